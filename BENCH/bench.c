@@ -0,0 +1,227 @@
+/*
+******************************************************************************
+*
+* Programme : bench.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Mesures de performance sur des chantiers synthétiques de
+*          plusieurs formes et tailles : lecture du fichier (analyse et
+*          construction), construction seule du graphe, calculDates,
+*          chemins critiques et dureeTotale. Chaque temps est le meilleur
+*          des répétitions.
+*          Écrit une ligne CSV par mesure :
+*              forme,taches,aretes,etape,secondes
+*          bench [-n tailleMax] [-r repetitions]
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include "erreurs.h"
+#include "libgraphe.h"
+#include "arene.h"
+#include "pert.h"
+#include "critique.h"
+#include "generation.h"
+
+
+/* Plus petite taille mesurée ; les suivantes sont multipliées par 10 */
+#define TAILLE_MIN_BENCH 1000
+
+/* Nombres d'ouvriers pour lesquels dureeTotale est mesurée */
+#define NB_OUVRIERS_BENCH 2
+static const int ouvriersBench[NB_OUVRIERS_BENCH] = {1, 8};
+
+/* Étapes mesurées, dans l'ordre du tableau temps de mesurerChantier */
+#define NB_ETAPES 6
+static const char *nomsEtapes[NB_ETAPES] = {
+	"lecture", "construction", "calculDates", "cheminsCritiques", "dureeTotale_1", "dureeTotale_8"
+};
+
+
+static int mesurerChantier(FILE*,int,double*,long*);
+static double maintenant(void);
+
+
+int main(int argc, char *argv[]) {
+	TypGeneration generation;  /* Paramètres du chantier mesuré */
+	FILE          *chantier;   /* Chantier généré */
+	double        meilleurs[NB_ETAPES]; /* Meilleur temps de chaque étape */
+	double        temps[NB_ETAPES];
+	const char    *nomsFormes[3] = {"couches", "aleatoire", "chaines"};
+	long          nbAretes;
+	int           tailleMax;
+	int           nbRepetitions;
+	int           option;      /* Option lue par getopt */
+	int           forme, taille, r, e;
+
+	tailleMax = 1000000;
+	nbRepetitions = 3;
+	while ((option = getopt(argc,argv,"n:r:")) != -1) {
+		switch (option) {
+			case 'n' :
+				tailleMax = atoi(optarg);
+				break;
+			case 'r' :
+				nbRepetitions = atoi(optarg);
+				break;
+			default :
+				fprintf(stderr,"Usage : %s [-n tailleMax] [-r repetitions]\n",argv[0]);
+				return 2;
+		}
+	}
+	if (nbRepetitions < 1) {
+		nbRepetitions = 1;
+	}
+
+	printf("forme,taches,aretes,etape,secondes\n");
+	for (forme = 0; forme < 3; forme++) {
+		for (taille = TAILLE_MIN_BENCH; taille <= tailleMax; taille *= 10) {
+			lireForme(nomsFormes[forme],&generation.forme);
+			generation.nbTaches = taille;
+			generation.entrants = 3;
+			generation.loi = LOI_UNIFORME;
+			generation.dureeMoyenne = 5;
+			generation.graine = 1;
+			/* Couches carrées, fenêtre étroite, chaînes de taille / 8 tâches */
+			switch (generation.forme) {
+				case FORME_COUCHES :
+					generation.largeur = (int) sqrt(taille);
+					break;
+				case FORME_ALEATOIRE :
+					generation.largeur = 50;
+					break;
+				case FORME_CHAINES :
+					generation.largeur = 8;
+					break;
+			}
+
+			if ((chantier = tmpfile()) == NULL || genererChantier(&generation,chantier) != 0) {
+				fprintf(stderr,"Impossible de générer le chantier de %d tâches\n",taille);
+				return 1;
+			}
+
+			for (r = 0; r < nbRepetitions; r++) {
+				rewind(chantier);
+				if (mesurerChantier(chantier,taille,temps,&nbAretes) != 0) {
+					fprintf(stderr,"Impossible de lire le chantier de %d tâches\n",taille);
+					fclose(chantier);
+					return 1;
+				}
+				for (e = 0; e < NB_ETAPES; e++) {
+					meilleurs[e] = (r == 0 || temps[e] < meilleurs[e]) ? temps[e] : meilleurs[e];
+				}
+			}
+			fclose(chantier);
+
+			for (e = 0; e < NB_ETAPES; e++) {
+				printf("%s,%d,%ld,%s,%.6f\n",nomsFormes[forme],taille,nbAretes,nomsEtapes[e],meilleurs[e]);
+			}
+			fflush(stdout);
+		}
+	}
+
+	return 0;
+}
+
+
+	/*
+	* Fonction : mesurerChantier
+	*
+	* Paramètres : FILE *chantier, le chantier généré, au début du fichier
+	*              int nbTaches, son nombre de tâches
+	*              double *temps, rempli avec la durée de chaque étape en
+	*                  secondes (voir nomsEtapes)
+	*              long *nbAretes, rempli avec le nombre d'arêtes du graphe
+	*
+	* Retour : int, 0 si les mesures sont faites, ERREUR_FICHIER si le
+	*             chantier n'a pas pu être lu
+	*
+	* Description : La construction est mesurée à part en recréant le
+	*               graphe lu à partir de ses tâches ; les calculs portent
+	*               sur ce second graphe, dont les dates ne sont pas encore
+	*               calculées.
+	*/
+static int mesurerChantier(FILE *chantier, int nbTaches, double *temps, long *nbAretes) {
+	TypGraphePERT       *graphePERT;  /* Le graphe lu */
+	TypGraphePERT       *copie;       /* Le graphe reconstruit */
+	TypArene            *arene;
+	TypTache            **taches;
+	int                 *durees;
+	TypCheminsCritiques *chemins;
+	int                 *chemin;      /* Premier chemin critique */
+	TypVoisins          *liste;
+	double              debut;
+	int                 i;
+
+	debut = maintenant();
+	graphePERT = lireGraphePERT(chantier);
+	temps[0] = maintenant() - debut;
+	if (graphePERT == NULL) {
+		return ERREUR_FICHIER;
+	}
+
+	arene = creerArene((nbTaches + 2) * (sizeof(TypTache) + 8 * sizeof(TypVoisins)));
+	taches = allouerArene(arene,(nbTaches + 2) * sizeof(TypTache*));
+	durees = allouerArene(arene,(nbTaches + 2) * sizeof(int));
+	for (i = 0; i < nbTaches; i++) {
+		taches[i] = creerTache(arene,graphePERT->taches[i]->nom,graphePERT->taches[i]->intitule,
+		                       graphePERT->taches[i]->dependances);
+		durees[i] = graphePERT->duree[i];
+	}
+	debut = maintenant();
+	copie = creerGraphePERT(arene,taches,durees,nbTaches);
+	temps[1] = maintenant() - debut;
+
+	debut = maintenant();
+	calculDates(copie);
+	temps[2] = maintenant() - debut;
+
+	debut = maintenant();
+	nombreCheminsCritiques(copie);
+	chemin = malloc((nbTaches + 2) * sizeof(int));
+	chemins = creerCheminsCritiques(copie,1);
+	cheminCritiqueSuivant(chemins,chemin);
+	deleteCheminsCritiques(chemins);
+	free(chemin);
+	temps[3] = maintenant() - debut;
+
+	for (i = 0; i < NB_OUVRIERS_BENCH; i++) {
+		debut = maintenant();
+		dureeTotale(copie,ouvriersBench[i]);
+		temps[4 + i] = maintenant() - debut;
+	}
+
+	*nbAretes = 0;
+	for (i = 0; i < copie->graphe->nbrMaxSommets; i++) {
+		liste = copie->graphe->listesAdjacences[i];
+		*nbAretes += tailleListe(&liste);
+	}
+
+	deleteGraphePERT(copie);
+	deleteGraphePERT(graphePERT);
+
+	return 0;
+}
+
+
+	/*
+	* Fonction : maintenant
+	*
+	* Retour : double, l'heure d'une horloge monotone, en secondes
+	*/
+static double maintenant(void) {
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC,&t);
+
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
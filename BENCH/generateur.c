@@ -0,0 +1,100 @@
+/*
+******************************************************************************
+*
+* Programme : generateur.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Écrit un chantier synthétique (voir generation.h) :
+*          generateur [-f forme] [-n taches] [-l largeur] [-p profondeur]
+*                     [-e entrants] [-d loi] [-m duree] [-g graine] [fichier]
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <unistd.h>
+#include "generation.h"
+
+
+int main(int argc, char *argv[]) {
+	TypGeneration generation;  /* Paramètres du chantier */
+	FILE          *sortie;     /* Fichier écrit, ou la sortie standard */
+	int           profondeur;  /* 0 : largeur donnée directement */
+	int           option;      /* Option lue par getopt */
+	int           erreur;
+
+	generation.forme = FORME_COUCHES;
+	generation.nbTaches = 1000;
+	generation.largeur = 32;
+	generation.entrants = 3;
+	generation.loi = LOI_UNIFORME;
+	generation.dureeMoyenne = 5;
+	generation.graine = 1;
+	profondeur = 0;
+
+	while ((option = getopt(argc,argv,"f:n:l:p:e:d:m:g:")) != -1) {
+		switch (option) {
+			case 'f' :
+				if (!lireForme(optarg,&generation.forme)) {
+					fprintf(stderr,"Forme inconnue : %s (couches, aleatoire, chaines)\n",optarg);
+					return 2;
+				}
+				break;
+			case 'n' :
+				generation.nbTaches = atoi(optarg);
+				break;
+			case 'l' :
+				generation.largeur = atoi(optarg);
+				break;
+			case 'p' :
+				profondeur = atoi(optarg);
+				break;
+			case 'e' :
+				generation.entrants = atoi(optarg);
+				break;
+			case 'd' :
+				if (!lireLoiDuree(optarg,&generation.loi)) {
+					fprintf(stderr,"Loi inconnue : %s (constante, uniforme, exponentielle)\n",optarg);
+					return 2;
+				}
+				break;
+			case 'm' :
+				generation.dureeMoyenne = atoi(optarg);
+				break;
+			case 'g' :
+				generation.graine = strtoull(optarg,NULL,10);
+				break;
+			default :
+				fprintf(stderr,"Usage : %s [-f forme] [-n taches] [-l largeur] [-p profondeur] "
+					"[-e entrants] [-d loi] [-m duree] [-g graine] [fichier]\n",argv[0]);
+				return 2;
+		}
+	}
+
+	/* La profondeur fixe la largeur des couches ou le nombre de chaînes */
+	if (profondeur > 0) {
+		generation.largeur = (generation.nbTaches + profondeur - 1) / profondeur;
+	}
+
+	sortie = (optind < argc) ? fopen(argv[optind],"w") : stdout;
+	if (sortie == NULL) {
+		fprintf(stderr,"Impossible d'écrire %s\n",argv[optind]);
+		return 1;
+	}
+
+	erreur = genererChantier(&generation,sortie);
+	if (sortie != stdout && fclose(sortie) != 0) {
+		erreur = 1;
+	}
+	if (erreur != 0) {
+		fprintf(stderr,"Paramètres invalides ou écriture impossible\n");
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,257 @@
+/*
+******************************************************************************
+*
+* Programme : generation.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Génération de chantiers synthétiques (couches, graphe
+*          aléatoire sans circuit, longues chaînes) au format des fichiers
+*          de chantier, pour mesurer les performances à grande échelle.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include "montecarlo.h"
+#include "erreurs.h"
+#include "generation.h"
+
+
+static int tirerEntier(TypGenerateur*,int);
+static int tirerDuree(TypGeneration*,TypGenerateur*);
+static int tirerPredecesseurs(TypGenerateur*,int,int,int,int*,int);
+
+
+	/*
+	* Fonction : genererChantier
+	*
+	* Paramètres : TypGeneration *generation, les paramètres du chantier
+	*              FILE *sortie, le fichier où écrire le chantier
+	*
+	* Retour : int, 0, POIDS_INVALIDE si un paramètre est hors de ses
+	*              bornes ou ERREUR_FICHIER si l'écriture échoue
+	*
+	* Description : Écrit nbTaches lignes "T12, 't12', 5, T3, T7". Les
+	*               prédécesseurs d'une tâche la précèdent toujours dans le
+	*               fichier, il n'y a donc pas de circuit. Une même graine
+	*               donne le même chantier.
+	*/
+int genererChantier(TypGeneration *generation, FILE *sortie) {
+	TypGenerateur generateur;  /* Tirages du chantier */
+	int           *pred;       /* Prédécesseurs de la tâche courante */
+	int           nbPred;
+	int           largeur;
+	int           debut;       /* Premier prédécesseur possible */
+	int           i, k;
+
+	if (generation->nbTaches < 1 || generation->largeur < 1 || generation->entrants < 1
+			|| generation->dureeMoyenne < 1) {
+		return POIDS_INVALIDE;
+	}
+
+	initGenerateur(&generateur,generation->graine,0);
+	largeur = generation->largeur;
+	pred = malloc(generation->entrants * sizeof(int));
+
+	fprintf(sortie,"# nom, 'intitule', duree, dependances\n");
+	for (i = 0; i < generation->nbTaches; i++) {
+		nbPred = 0;
+		switch (generation->forme) {
+			case FORME_COUCHES :
+				/* Au moins un prédécesseur dans la couche précédente */
+				if (i >= largeur) {
+					debut = (i / largeur - 1) * largeur;
+					nbPred = tirerPredecesseurs(&generateur,debut,debut + largeur - 1,
+						1 + tirerEntier(&generateur,generation->entrants),pred,0);
+				}
+				break;
+			case FORME_ALEATOIRE :
+				/* Zéro prédécesseur possible : des sources partout */
+				if (i > 0) {
+					debut = (i > largeur) ? i - largeur : 0;
+					nbPred = tirerPredecesseurs(&generateur,debut,i - 1,
+						tirerEntier(&generateur,generation->entrants + 1),pred,0);
+				}
+				break;
+			case FORME_CHAINES :
+				/* La tâche précédente de la chaîne, puis des liens vers les
+				   autres chaînes au rang précédent */
+				if (i >= largeur) {
+					debut = (i / largeur - 1) * largeur;
+					pred[0] = i - largeur;
+					nbPred = tirerPredecesseurs(&generateur,debut,debut + largeur - 1,
+						1 + tirerEntier(&generateur,generation->entrants),pred,1);
+				}
+				break;
+		}
+
+		fprintf(sortie,"T%d, 't%d', %d, ",i + 1,i + 1,tirerDuree(generation,&generateur));
+		if (nbPred == 0) {
+			fprintf(sortie,"-\n");
+		}
+		else {
+			for (k = 0; k < nbPred; k++) {
+				fprintf(sortie,(k == 0) ? "T%d" : ", T%d",pred[k] + 1);
+			}
+			fprintf(sortie,"\n");
+		}
+	}
+
+	free(pred);
+
+	return ferror(sortie) ? ERREUR_FICHIER : 0;
+}
+
+
+	/*
+	* Fonction : lireForme
+	*
+	* Paramètres : const char *texte, "couches", "aleatoire" ou "chaines"
+	*              TypForme *forme, rempli avec la forme lue
+	*
+	* Retour : bool, false si texte ne désigne aucune forme
+	*/
+bool lireForme(const char *texte, TypForme *forme) {
+	if (strcmp(texte,"couches") == 0) {
+		*forme = FORME_COUCHES;
+	}
+	else if (strcmp(texte,"aleatoire") == 0) {
+		*forme = FORME_ALEATOIRE;
+	}
+	else if (strcmp(texte,"chaines") == 0) {
+		*forme = FORME_CHAINES;
+	}
+	else {
+		return false;
+	}
+
+	return true;
+}
+
+
+	/*
+	* Fonction : lireLoiDuree
+	*
+	* Paramètres : const char *texte, "constante", "uniforme" ou
+	*                  "exponentielle"
+	*              TypLoiDuree *loi, rempli avec la loi lue
+	*
+	* Retour : bool, false si texte ne désigne aucune loi
+	*/
+bool lireLoiDuree(const char *texte, TypLoiDuree *loi) {
+	if (strcmp(texte,"constante") == 0) {
+		*loi = LOI_CONSTANTE;
+	}
+	else if (strcmp(texte,"uniforme") == 0) {
+		*loi = LOI_UNIFORME;
+	}
+	else if (strcmp(texte,"exponentielle") == 0) {
+		*loi = LOI_EXPONENTIELLE;
+	}
+	else {
+		return false;
+	}
+
+	return true;
+}
+
+
+	/*
+	* Fonction : tirerEntier
+	*
+	* Paramètres : TypGenerateur *generateur, le générateur
+	*              int n, le nombre de valeurs possibles (>= 1)
+	*
+	* Retour : int, un entier uniforme dans [0, n[
+	*/
+static int tirerEntier(TypGenerateur *generateur, int n) {
+	int r;
+
+	r = (int) (tirageUniforme(generateur) * n);
+
+	return (r < n) ? r : n - 1;
+}
+
+
+	/*
+	* Fonction : tirerDuree
+	*
+	* Paramètres : TypGeneration *generation, les paramètres du chantier
+	*              TypGenerateur *generateur, le générateur
+	*
+	* Retour : int, la durée d'une tâche selon la loi demandée
+	*/
+static int tirerDuree(TypGeneration *generation, TypGenerateur *generateur) {
+	int duree;
+
+	switch (generation->loi) {
+		case LOI_UNIFORME :
+			return 1 + tirerEntier(generateur,2 * generation->dureeMoyenne - 1);
+		case LOI_EXPONENTIELLE :
+			duree = (int) lround(-generation->dureeMoyenne * log(1 - tirageUniforme(generateur)));
+			return (duree > 1) ? duree : 1;
+		default :
+			return generation->dureeMoyenne;
+	}
+}
+
+
+	/*
+	* Fonction : tirerPredecesseurs
+	*
+	* Paramètres : TypGenerateur *generateur, le générateur
+	*              int premier, int dernier, les prédécesseurs possibles
+	*              int nombre, le nombre de prédécesseurs voulus
+	*              int *pred, les prédécesseurs, complétés en sortie
+	*              int nbPred, le nombre de prédécesseurs déjà dans pred
+	*
+	* Retour : int, le nombre de prédécesseurs dans pred
+	*
+	* Description : Complète pred jusqu'à nombre prédécesseurs distincts
+	*               tirés dans [premier, dernier], ou tous s'il n'y en a pas
+	*               assez. Les tirages déjà présents sont rejetés : nombre
+	*               (au plus entrants) reste petit.
+	*/
+static int tirerPredecesseurs(TypGenerateur *generateur, int premier, int dernier, int nombre,
+		int *pred, int nbPred) {
+	int  p, k;
+	bool present;
+
+	if (nombre > dernier - premier + 1) {
+		nombre = dernier - premier + 1;
+	}
+
+	/* Tout l'intervalle : pas de tirage */
+	if (nombre == dernier - premier + 1) {
+		for (p = premier; p <= dernier && nbPred < nombre; p++) {
+			present = false;
+			for (k = 0; k < nbPred && !present; k++) {
+				present = (pred[k] == p);
+			}
+			if (!present) {
+				pred[nbPred++] = p;
+			}
+		}
+		return nbPred;
+	}
+
+	while (nbPred < nombre) {
+		p = premier + tirerEntier(generateur,dernier - premier + 1);
+		present = false;
+		for (k = 0; k < nbPred && !present; k++) {
+			present = (pred[k] == p);
+		}
+		if (!present) {
+			pred[nbPred++] = p;
+		}
+	}
+
+	return nbPred;
+}
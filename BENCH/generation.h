@@ -0,0 +1,53 @@
+#ifndef GENERATION_H
+#define GENERATION_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*
+* Forme du graphe des dépendances d'un chantier généré.
+*/
+typedef enum TypForme {
+	FORME_COUCHES,    /* Couches de largeur tâches, chacune dépendant de
+	                     tâches de la couche précédente */
+	FORME_ALEATOIRE,  /* Graphe sans circuit quelconque : chaque tâche
+	                     dépend de tâches parmi les largeur précédentes */
+	FORME_CHAINES     /* largeur longues chaînes, reliées entre elles
+	                     par quelques dépendances */
+} TypForme;
+
+/*
+* Loi des durées des tâches.
+*/
+typedef enum TypLoiDuree {
+	LOI_CONSTANTE,       /* Toutes les tâches durent dureeMoyenne */
+	LOI_UNIFORME,        /* Uniforme sur [1, 2 * dureeMoyenne - 1] */
+	LOI_EXPONENTIELLE    /* Exponentielle de moyenne dureeMoyenne, au
+	                        moins 1 */
+} TypLoiDuree;
+
+/*
+* Paramètres d'un chantier généré. La profondeur vaut nbTaches / largeur
+* pour les couches et les chaînes.
+*/
+typedef struct TypGeneration {
+	TypForme    forme;
+	int         nbTaches;
+	int         largeur;       /* Voir TypForme (>= 1) */
+	int         entrants;      /* Nombre maximal de prédécesseurs d'une
+	                              tâche (>= 1) */
+	TypLoiDuree loi;
+	int         dureeMoyenne;  /* (>= 1) */
+	uint64_t    graine;
+} TypGeneration;
+
+
+int genererChantier(TypGeneration*,FILE*);
+
+bool lireForme(const char*,TypForme*);
+
+bool lireLoiDuree(const char*,TypLoiDuree*);
+
+#endif
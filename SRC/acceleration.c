@@ -0,0 +1,573 @@
+/*
+******************************************************************************
+*
+* Programme : acceleration.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Compromis temps-coût : les tâches peuvent être raccourcies
+*          moyennant un surcoût ; courbe du coût minimal du chantier en
+*          fonction de sa durée, par coupes minimales du réseau critique.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include "libgraphe.h"
+#include "pert.h"
+#include "acceleration.h"
+
+
+/* Longueur maximale du nom d'une tâche dans le fichier d'accélération */
+#define TAILLE_NOM 64
+
+/* Capacité d'une tâche qui ne peut plus être raccourcie */
+#define CAPACITE_INFINIE 1e30
+
+/* En dessous, une capacité résiduelle est considérée comme nulle */
+#define EPSILON_FLOT 1e-9
+
+
+/*
+* Réseau de flot : chaque sommet critique v est dédoublé en un noeud
+* d'entrée (2k) et un noeud de sortie (2k + 1), reliés par un arc dont la
+* capacité est la pente de la tâche. Les arcs vont par paires : l'arc a ^ 1
+* est l'inverse de a.
+*/
+typedef struct TypReseau {
+	int    nbNoeuds;
+	int    nbArcs;
+	int    *debut;      /* Premier arc partant de chaque noeud (-1 : aucun) */
+	int    *suivant;    /* Arc suivant partant du même noeud */
+	int    *arrivee;    /* Noeud d'arrivée de chaque arc */
+	double *capacite;   /* Capacité résiduelle de chaque arc */
+	int    *niveau;     /* Distance depuis la source (-1 : non atteint) */
+	int    *courant;    /* Prochain arc à essayer depuis chaque noeud */
+	int    *file;       /* File du parcours en largeur, puis chemin
+	                       augmentant (arcs) */
+} TypReseau;
+
+
+static int construireReseau(TypGraphePERT*,TypAcceleration*,TypReseau*,int*,int*);
+static void ajouterNoeud(TypReseau*,int,double);
+static void ajouterArc(TypReseau*,int,int,double);
+static bool niveauxReseau(TypReseau*,int,int);
+static double augmenterFlot(TypReseau*,int,int);
+static double flotMaximal(TypReseau*,int,int);
+static void ajouterPoint(TypCourbeCout*,int*,int,double);
+
+
+	/*
+	* Fonction : lireAcceleration
+	*
+	* Paramètres : FILE *fichier, un fichier d'accélération ouvert en lecture
+	*              TypGraphePERT *graphePERT, le graphe PERT du chantier
+	*
+	* Retour : TypAcceleration*, les données lues, ou NULL si le fichier
+	*              cite une tâche inconnue ou des valeurs incohérentes
+	*
+	* Description : Lit un fichier d'accélération. Les lignes commençant
+	*               par '#' sont ignorées ; les autres sont de la forme :
+	*                   A, 3, 100, 160
+	*               (tâche, durée minimale, coût normal, coût accéléré). La
+	*               durée normale est celle du graphe. Une tâche absente du
+	*               fichier ne coûte rien et ne peut pas être raccourcie.
+	*/
+TypAcceleration* lireAcceleration(FILE *fichier, TypGraphePERT *graphePERT) {
+	TypAcceleration *acceleration;     /* Les données lues */
+	char            ligne[512];        /* Ligne lue dans le fichier */
+	char            nom[TAILLE_NOM];   /* Nom de la tâche */
+	int             dureeMin;          /* Durée minimale lue */
+	double          coutNormal;        /* Coût normal lu */
+	double          coutAccelere;      /* Coût accéléré lu */
+	int             sommet;            /* Indice de la tâche */
+	int             i;
+
+	acceleration = malloc(sizeof(TypAcceleration));
+	acceleration->nbSommets = graphePERT->graphe->nbrMaxSommets;
+	acceleration->dureeMin = malloc(acceleration->nbSommets * sizeof(int));
+	acceleration->coutNormal = calloc(acceleration->nbSommets, sizeof(double));
+	acceleration->pente = calloc(acceleration->nbSommets, sizeof(double));
+	for (i = 0; i < acceleration->nbSommets; i++) {
+		acceleration->dureeMin[i] = graphePERT->duree[i];
+	}
+
+	while (fgets(ligne,sizeof(ligne),fichier) != NULL) {
+		if (ligne[0] == '#'
+				|| sscanf(ligne," %63[^,], %d, %lf, %lf",nom,&dureeMin,&coutNormal,&coutAccelere) != 4) {
+			continue;
+		}
+
+		sommet = chercherTache(graphePERT,nom);
+		if (sommet == -1 || dureeMin < 0 || dureeMin > graphePERT->duree[sommet-1]
+				|| coutAccelere < coutNormal) {
+			deleteAcceleration(acceleration);
+			return NULL;
+		}
+
+		i = sommet - 1;
+		acceleration->dureeMin[i] = dureeMin;
+		acceleration->coutNormal[i] = coutNormal;
+		acceleration->pente[i] = (dureeMin < graphePERT->duree[i])
+			? (coutAccelere - coutNormal) / (graphePERT->duree[i] - dureeMin) : 0;
+	}
+
+	return acceleration;
+}
+
+
+	/*
+	* Fonction : deleteAcceleration
+	*
+	* Paramètres : TypAcceleration *acceleration, les données à supprimer
+	*
+	* Description : Libère la mémoire occupée par les données d'accélération.
+	*/
+void deleteAcceleration(TypAcceleration *acceleration) {
+	free(acceleration->dureeMin);
+	free(acceleration->coutNormal);
+	free(acceleration->pente);
+	free(acceleration);
+}
+
+
+	/*
+	* Fonction : courbeTempsCout
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              TypAcceleration *acceleration, les données d'accélération
+	*                  lues pour ce graphe
+	*
+	* Retour : TypCourbeCout*, la courbe temps-coût du chantier, ou NULL
+	*              si le graphe a des liens typés
+	*
+	* Description : Part des durées normales et raccourcit le chantier pas
+	*               à pas. À chaque pas, les tâches à raccourcir forment une
+	*               coupe de coût minimal du réseau critique (flot maximal
+	*               de Dinic, la pente de chaque tâche servant de capacité) :
+	*               toute chaîne critique y perd au moins un jour par jour
+	*               gagné, au prix le plus bas. Le pas s'arrête dès qu'une
+	*               tâche de la coupe atteint sa durée minimale ou qu'une
+	*               chaîne non critique le devient ; les dates sont alors
+	*               mises à jour par majDates. La courbe s'arrête quand
+	*               toute chaîne critique passe par une tâche incompressible.
+	*               Une tâche raccourcie ne rallonge plus : au-delà du
+	*               premier coude, la courbe est une borne supérieure du
+	*               coût minimal. Le graphe retrouve ses durées et ses dates
+	*               en sortie. Avec des liens typés, raccourcir une tâche
+	*               peut retarder le chantier (dépendance fin-fin) : ce
+	*               modèle ne s'applique pas.
+	*/
+TypCourbeCout* courbeTempsCout(TypGraphePERT *graphePERT, TypAcceleration *acceleration) {
+	TypCourbeCout   *courbe;          /* La courbe construite */
+	TypReseau       reseau;           /* Réseau critique du pas courant */
+	TypModification *modifications;   /* Raccourcissements d'un pas */
+	int             *dureeDepart;     /* Durées du graphe à l'appel */
+	int             *noeud;           /* Indice de chaque sommet dans le
+	                                     réseau (-1 : hors du réseau) */
+	int             *sommets;         /* Sommet de chaque indice du réseau */
+	int             capacitePoints;   /* Taille des tableaux de la courbe */
+	int             nbSommets;        /* Le nombre de sommets du graphe */
+	int             nbAretes;         /* Le nombre d'arêtes du graphe */
+	int             nbCritiques;      /* Sommets du réseau critique */
+	int             nbModifications;
+	int             pas;              /* Jours gagnés pendant le pas */
+	int             marge;            /* Marge totale d'une tâche */
+	double          cout;             /* Coût du chantier */
+	double          penteCoupe;       /* Coût d'un jour gagné sur la coupe */
+	TypVoisins      *liste;
+	int             i, k;
+
+	if (graphePERT->liensTypes) {
+		return NULL;
+	}
+
+	calculDates(graphePERT);
+
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	nbAretes = 0;
+	for (i = 0; i < nbSommets; i++) {
+		liste = graphePERT->graphe->listesAdjacences[i];
+		nbAretes += tailleListe(&liste);
+	}
+
+	reseau.debut = malloc(2 * nbSommets * sizeof(int));
+	reseau.niveau = malloc(2 * nbSommets * sizeof(int));
+	reseau.courant = malloc(2 * nbSommets * sizeof(int));
+	reseau.file = malloc(2 * nbSommets * sizeof(int));
+	reseau.suivant = malloc(2 * (nbSommets + nbAretes) * sizeof(int));
+	reseau.arrivee = malloc(2 * (nbSommets + nbAretes) * sizeof(int));
+	reseau.capacite = malloc(2 * (nbSommets + nbAretes) * sizeof(double));
+
+	modifications = malloc(nbSommets * sizeof(TypModification));
+	dureeDepart = malloc(nbSommets * sizeof(int));
+	sommets = malloc(nbSommets * sizeof(int));
+	noeud = malloc(nbSommets * sizeof(int));
+	cout = 0;
+	for (i = 0; i < nbSommets; i++) {
+		dureeDepart[i] = graphePERT->duree[i];
+		noeud[i] = -1;
+		cout += acceleration->coutNormal[i];
+	}
+
+	courbe = malloc(sizeof(TypCourbeCout));
+	courbe->nbPoints = 0;
+	courbe->duree = NULL;
+	courbe->cout = NULL;
+	capacitePoints = 0;
+	ajouterPoint(courbe,&capacitePoints,graphePERT->dateTot[nbSommets-1],cout);
+
+	while (true) {
+		nbCritiques = construireReseau(graphePERT,acceleration,&reseau,noeud,sommets);
+
+		/* Source : sortie d'alpha ; puits : entrée d'oméga */
+		if (flotMaximal(&reseau,2 * noeud[nbSommets-2] + 1,2 * noeud[nbSommets-1])
+				>= CAPACITE_INFINIE / 2) {
+			break;
+		}
+
+		/* La coupe : tâches dont seule l'entrée est atteinte depuis la source */
+		nbModifications = 0;
+		pas = graphePERT->dateTot[nbSommets-1];
+		penteCoupe = 0;
+		for (k = 0; k < nbCritiques; k++) {
+			if (reseau.niveau[2*k] != -1 && reseau.niveau[2*k+1] == -1) {
+				i = sommets[k] - 1;
+				modifications[nbModifications].type = MODIF_DUREE;
+				modifications[nbModifications].sommet = sommets[k];
+				modifications[nbModifications].predecesseur = 0;
+				nbModifications++;
+				if (graphePERT->duree[i] - acceleration->dureeMin[i] < pas) {
+					pas = graphePERT->duree[i] - acceleration->dureeMin[i];
+				}
+				penteCoupe += acceleration->pente[i];
+			}
+		}
+		for (k = 0; k < nbCritiques; k++) {
+			noeud[sommets[k]-1] = -1;
+		}
+		if (nbModifications == 0) {
+			break;
+		}
+
+		/* Le pas ne dépasse pas la plus petite marge non nulle */
+		for (i = 0; i < nbSommets - 2; i++) {
+			marge = graphePERT->dateTard[i] - graphePERT->dateTot[i];
+			if (marge > 0 && marge < pas) {
+				pas = marge;
+			}
+		}
+
+		for (k = 0; k < nbModifications; k++) {
+			modifications[k].duree = graphePERT->duree[modifications[k].sommet-1] - pas;
+		}
+		majDates(graphePERT,modifications,nbModifications);
+		cout += pas * penteCoupe;
+		ajouterPoint(courbe,&capacitePoints,graphePERT->dateTot[nbSommets-1],cout);
+	}
+
+	/* Retour aux durées de départ */
+	nbModifications = 0;
+	for (i = 0; i < nbSommets - 2; i++) {
+		if (graphePERT->duree[i] != dureeDepart[i]) {
+			modifications[nbModifications].type = MODIF_DUREE;
+			modifications[nbModifications].sommet = i + 1;
+			modifications[nbModifications].predecesseur = 0;
+			modifications[nbModifications].duree = dureeDepart[i];
+			nbModifications++;
+		}
+	}
+	if (nbModifications > 0) {
+		majDates(graphePERT,modifications,nbModifications);
+	}
+
+	free(reseau.debut);
+	free(reseau.niveau);
+	free(reseau.courant);
+	free(reseau.file);
+	free(reseau.suivant);
+	free(reseau.arrivee);
+	free(reseau.capacite);
+	free(modifications);
+	free(dureeDepart);
+	free(sommets);
+	free(noeud);
+
+	return courbe;
+}
+
+
+	/*
+	* Fonction : deleteCourbeCout
+	*
+	* Paramètres : TypCourbeCout *courbe, la courbe à supprimer
+	*
+	* Description : Libère la mémoire occupée par la courbe.
+	*/
+void deleteCourbeCout(TypCourbeCout *courbe) {
+	free(courbe->duree);
+	free(courbe->cout);
+	free(courbe);
+}
+
+
+	/*
+	* Fonction : construireReseau
+	*
+	* Paramètres : TypGraphePERT *graphePERT, graphe PERT dont les dates sont
+	*                  à jour
+	*              TypAcceleration *acceleration, les données d'accélération
+	*              TypReseau *reseau, le réseau à remplir
+	*              int *noeud, indice de chaque sommet dans le réseau (tout à
+	*                  -1 à l'appel)
+	*              int *sommets, rempli avec le sommet de chaque indice
+	*
+	* Retour : int, le nombre de sommets du réseau
+	*
+	* Description : Parcourt en largeur, depuis alpha, les sommets critiques
+	*               reliés par des arêtes serrées (le successeur commence dès
+	*               la fin du prédécesseur). Ce sont exactement les sommets
+	*               et arêtes des chemins critiques. Les arêtes ont une
+	*               capacité infinie, les tâches leur pente, ou une capacité
+	*               infinie si elles sont à leur durée minimale.
+	*/
+static int construireReseau(TypGraphePERT *graphePERT, TypAcceleration *acceleration,
+		TypReseau *reseau, int *noeud, int *sommets) {
+	TypVoisins *liste;   /* Liste des successeurs d'un sommet */
+	TypVoisins *vC;      /* Successeur courant */
+	int        nbSommets;
+	int        nb;       /* Sommets entrés dans le réseau */
+	int        tete;     /* Prochain sommet à parcourir */
+	int        u, v;
+	double     capacite;
+
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	reseau->nbNoeuds = 0;
+	reseau->nbArcs = 0;
+
+	nb = 0;
+	noeud[nbSommets-2] = nb;
+	sommets[nb++] = nbSommets - 1;
+	ajouterNoeud(reseau,nb - 1,CAPACITE_INFINIE);
+
+	for (tete = 0; tete < nb; tete++) {
+		u = sommets[tete];
+		liste = graphePERT->graphe->listesAdjacences[u-1];
+		for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+			v = numeroVoisin(&vC);
+			if (graphePERT->dateTard[v-1] != graphePERT->dateTot[v-1]
+					|| graphePERT->dateTot[u-1] + graphePERT->duree[u-1] != graphePERT->dateTot[v-1]) {
+				continue;
+			}
+			if (noeud[v-1] == -1) {
+				noeud[v-1] = nb;
+				sommets[nb++] = v;
+				capacite = (graphePERT->duree[v-1] > acceleration->dureeMin[v-1])
+					? acceleration->pente[v-1] : CAPACITE_INFINIE;
+				ajouterNoeud(reseau,nb - 1,capacite);
+			}
+			ajouterArc(reseau,2 * noeud[u-1] + 1,2 * noeud[v-1],CAPACITE_INFINIE);
+		}
+	}
+
+	return nb;
+}
+
+
+	/*
+	* Fonction : ajouterNoeud
+	*
+	* Paramètres : TypReseau *reseau, le réseau
+	*              int k, l'indice du sommet ajouté
+	*              double capacite, la capacité de la tâche
+	*
+	* Description : Ajoute l'entrée et la sortie du sommet k, reliées par
+	*               un arc de capacité capacite.
+	*/
+static void ajouterNoeud(TypReseau *reseau, int k, double capacite) {
+	reseau->debut[2*k] = -1;
+	reseau->debut[2*k+1] = -1;
+	reseau->nbNoeuds = 2 * k + 2;
+	ajouterArc(reseau,2 * k,2 * k + 1,capacite);
+}
+
+
+	/*
+	* Fonction : ajouterArc
+	*
+	* Paramètres : TypReseau *reseau, le réseau
+	*              int depart, int arrivee, les extrémités de l'arc
+	*              double capacite, la capacité de l'arc
+	*
+	* Description : Ajoute l'arc et son inverse, de capacité nulle.
+	*/
+static void ajouterArc(TypReseau *reseau, int depart, int arrivee, double capacite) {
+	int a = reseau->nbArcs;
+
+	reseau->arrivee[a] = arrivee;
+	reseau->capacite[a] = capacite;
+	reseau->suivant[a] = reseau->debut[depart];
+	reseau->debut[depart] = a;
+
+	reseau->arrivee[a+1] = depart;
+	reseau->capacite[a+1] = 0;
+	reseau->suivant[a+1] = reseau->debut[arrivee];
+	reseau->debut[arrivee] = a + 1;
+
+	reseau->nbArcs += 2;
+}
+
+
+	/*
+	* Fonction : niveauxReseau
+	*
+	* Paramètres : TypReseau *reseau, le réseau
+	*              int source, int puits
+	*
+	* Retour : bool, true si le puits est atteint
+	*
+	* Description : Parcours en largeur du graphe résiduel depuis la
+	*               source. En fin de flot, les noeuds atteints forment le
+	*               côté source de la coupe minimale.
+	*/
+static bool niveauxReseau(TypReseau *reseau, int source, int puits) {
+	int tete, nb, u, a;
+
+	for (u = 0; u < reseau->nbNoeuds; u++) {
+		reseau->niveau[u] = -1;
+	}
+	reseau->niveau[source] = 0;
+	reseau->file[0] = source;
+	nb = 1;
+	for (tete = 0; tete < nb; tete++) {
+		u = reseau->file[tete];
+		for (a = reseau->debut[u]; a != -1; a = reseau->suivant[a]) {
+			if (reseau->capacite[a] > EPSILON_FLOT && reseau->niveau[reseau->arrivee[a]] == -1) {
+				reseau->niveau[reseau->arrivee[a]] = reseau->niveau[u] + 1;
+				reseau->file[nb++] = reseau->arrivee[a];
+			}
+		}
+	}
+
+	return reseau->niveau[puits] != -1;
+}
+
+
+	/*
+	* Fonction : augmenterFlot
+	*
+	* Paramètres : TypReseau *reseau, le réseau, niveaux calculés
+	*              int source, int puits
+	*
+	* Retour : double, le flot poussé (0 s'il n'y a plus de chemin,
+	*              CAPACITE_INFINIE si le chemin n'a que des arcs infinis)
+	*
+	* Description : Cherche un chemin de la source au puits dans le graphe
+	*               des niveaux et y pousse le plus de flot possible. Le
+	*               parcours en profondeur est itératif (les chemins
+	*               critiques peuvent être longs) ; un noeud sans issue est
+	*               retiré des niveaux.
+	*/
+static double augmenterFlot(TypReseau *reseau, int source, int puits) {
+	int    *chemin = reseau->file;   /* Arcs du chemin en cours */
+	int    profondeur;
+	int    u, a, j;
+	double goulot;
+
+	u = source;
+	profondeur = 0;
+	while (true) {
+		if (u == puits) {
+			goulot = CAPACITE_INFINIE;
+			for (j = 0; j < profondeur; j++) {
+				if (reseau->capacite[chemin[j]] < goulot) {
+					goulot = reseau->capacite[chemin[j]];
+				}
+			}
+			if (goulot >= CAPACITE_INFINIE) {
+				return CAPACITE_INFINIE;
+			}
+			for (j = 0; j < profondeur; j++) {
+				reseau->capacite[chemin[j]] -= goulot;
+				reseau->capacite[chemin[j] ^ 1] += goulot;
+			}
+			return goulot;
+		}
+
+		a = reseau->courant[u];
+		while (a != -1 && (reseau->capacite[a] <= EPSILON_FLOT
+				|| reseau->niveau[reseau->arrivee[a]] != reseau->niveau[u] + 1)) {
+			a = reseau->suivant[a];
+		}
+		reseau->courant[u] = a;
+
+		if (a != -1) {
+			chemin[profondeur++] = a;
+			u = reseau->arrivee[a];
+		}
+		else {
+			reseau->niveau[u] = -1;
+			if (profondeur == 0) {
+				return 0;
+			}
+			u = reseau->arrivee[chemin[--profondeur] ^ 1];
+		}
+	}
+}
+
+
+	/*
+	* Fonction : flotMaximal
+	*
+	* Paramètres : TypReseau *reseau, le réseau
+	*              int source, int puits
+	*
+	* Retour : double, la valeur du flot maximal (au moins
+	*              CAPACITE_INFINIE s'il n'est pas borné)
+	*
+	* Description : Algorithme de Dinic. En sortie, niveau marque le côté
+	*               source de la coupe minimale.
+	*/
+static double flotMaximal(TypReseau *reseau, int source, int puits) {
+	double flot;
+	double pousse;
+	int    u;
+
+	flot = 0;
+	while (niveauxReseau(reseau,source,puits)) {
+		for (u = 0; u < reseau->nbNoeuds; u++) {
+			reseau->courant[u] = reseau->debut[u];
+		}
+		while ((pousse = augmenterFlot(reseau,source,puits)) > 0) {
+			flot += pousse;
+			if (flot >= CAPACITE_INFINIE / 2) {
+				return flot;
+			}
+		}
+	}
+
+	return flot;
+}
+
+
+	/*
+	* Fonction : ajouterPoint
+	*
+	* Paramètres : TypCourbeCout *courbe, la courbe
+	*              int *capacite, taille allouée des tableaux de la courbe
+	*              int duree, double cout, le point ajouté
+	*/
+static void ajouterPoint(TypCourbeCout *courbe, int *capacite, int duree, double cout) {
+	if (courbe->nbPoints == *capacite) {
+		*capacite = (*capacite > 0) ? 2 * *capacite : 16;
+		courbe->duree = realloc(courbe->duree,*capacite * sizeof(int));
+		courbe->cout = realloc(courbe->cout,*capacite * sizeof(double));
+	}
+	courbe->duree[courbe->nbPoints] = duree;
+	courbe->cout[courbe->nbPoints] = cout;
+	courbe->nbPoints++;
+}
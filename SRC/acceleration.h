@@ -0,0 +1,41 @@
+#ifndef ACCELERATION_H
+#define ACCELERATION_H
+
+#include <stdio.h>
+#include "pert.h"
+
+
+/*
+* Données d'accélération des tâches : une tâche peut être raccourcie de sa
+* durée normale (duree du graphe PERT) jusqu'à sa durée minimale ; chaque
+* jour gagné coûte pente, du coût normal jusqu'au coût accéléré. Les
+* tableaux sont indicés par sommet - 1 ; une tâche absente du fichier ne
+* peut pas être raccourcie.
+*/
+typedef struct TypAcceleration {
+	int    nbSommets;
+	int    *dureeMin;
+	double *coutNormal;
+	double *pente;        /* Coût d'un jour gagné sur la tâche */
+} TypAcceleration;
+
+/*
+* Courbe temps-coût : pour chaque durée du chantier, le coût le plus bas
+* trouvé. Entre deux points consécutifs, le coût varie linéairement.
+*/
+typedef struct TypCourbeCout {
+	int    nbPoints;
+	int    *duree;        /* Durées du chantier, décroissantes */
+	double *cout;
+} TypCourbeCout;
+
+
+TypAcceleration* lireAcceleration(FILE*,TypGraphePERT*);
+
+void deleteAcceleration(TypAcceleration*);
+
+TypCourbeCout* courbeTempsCout(TypGraphePERT*,TypAcceleration*);
+
+void deleteCourbeCout(TypCourbeCout*);
+
+#endif
@@ -0,0 +1,178 @@
+/*
+******************************************************************************
+*
+* Programme : arene.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Allocation en arène. Toute la mémoire d'un graphe PERT (tâches,
+*          listes d'adjacence, tables) est prise dans quelques grands
+*          blocs, libérés d'un coup avec le graphe.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "arene.h"
+
+
+/* Taille minimale d'un bloc */
+#define TAILLE_BLOC_MIN 4096
+
+
+static size_t arrondir(size_t);
+static void ajouterBloc(TypArene*,size_t);
+
+
+	/*
+	* Fonction : creerArene
+	*
+	* Paramètres : size_t tailleInitiale, taille estimée de tout ce qui
+	*                  sera alloué (0 si inconnue)
+	*
+	* Retour : TypArene*, l'arène créée, avec un premier bloc de cette
+	*              taille
+	*/
+TypArene* creerArene(size_t tailleInitiale) {
+	TypArene *arene;
+
+	arene = malloc(sizeof(TypArene));
+	arene->bloc = NULL;
+	memset(arene->libres,0,sizeof(arene->libres));
+	arene->tailleBloc = (tailleInitiale > TAILLE_BLOC_MIN) ? tailleInitiale : TAILLE_BLOC_MIN;
+	ajouterBloc(arene,arene->tailleBloc);
+
+	return arene;
+}
+
+
+	/*
+	* Fonction : allouerArene
+	*
+	* Paramètres : TypArene *arene, une arène
+	*              size_t taille, le nombre d'octets demandés
+	*
+	* Retour : void*, un bloc de taille octets, aligné sur ALIGNEMENT_ARENE
+	*
+	* Description : Reprend un petit bloc rendu s'il y en a un de cette
+	*               taille, sinon avance dans le bloc courant. Quand celui-ci
+	*               est plein, un nouveau bloc deux fois plus grand est
+	*               alloué : le nombre de blocs reste logarithmique.
+	*/
+void* allouerArene(TypArene *arene, size_t taille) {
+	void   *resultat;
+	size_t classe;
+
+	taille = arrondir((taille > 0) ? taille : 1);
+	classe = taille / ALIGNEMENT_ARENE - 1;
+	if (classe < NB_CLASSES_ARENE && arene->libres[classe] != NULL) {
+		resultat = arene->libres[classe];
+		arene->libres[classe] = *(void**) resultat;
+		return resultat;
+	}
+
+	if (arene->bloc->taille - arene->bloc->utilise < taille) {
+		arene->tailleBloc *= 2;
+		ajouterBloc(arene,(taille > arene->tailleBloc) ? taille : arene->tailleBloc);
+	}
+	resultat = arene->bloc->donnees + arene->bloc->utilise;
+	arene->bloc->utilise += taille;
+
+	return resultat;
+}
+
+
+	/*
+	* Fonction : allouerAreneZero
+	*
+	* Paramètres : TypArene *arene, une arène
+	*              size_t taille, le nombre d'octets demandés
+	*
+	* Retour : void*, un bloc de taille octets mis à zéro
+	*/
+void* allouerAreneZero(TypArene *arene, size_t taille) {
+	void *resultat;
+
+	resultat = allouerArene(arene,taille);
+	memset(resultat,0,taille);
+
+	return resultat;
+}
+
+
+	/*
+	* Fonction : rendreArene
+	*
+	* Paramètres : TypArene *arene, l'arène d'où vient le bloc
+	*              void *bloc, un bloc alloué par allouerArene
+	*              size_t taille, la taille demandée pour ce bloc
+	*
+	* Description : Un petit bloc rendu est gardé pour la prochaine
+	*               allocation de même taille ; un grand bloc n'est libéré
+	*               qu'avec l'arène.
+	*/
+void rendreArene(TypArene *arene, void *bloc, size_t taille) {
+	size_t classe;
+
+	classe = arrondir((taille > 0) ? taille : 1) / ALIGNEMENT_ARENE - 1;
+	if (classe < NB_CLASSES_ARENE) {
+		*(void**) bloc = arene->libres[classe];
+		arene->libres[classe] = bloc;
+	}
+}
+
+
+	/*
+	* Fonction : deleteArene
+	*
+	* Paramètres : TypArene *arene, une arène
+	*
+	* Description : Libère tous les blocs de l'arène, donc tout ce qui y a
+	*               été alloué, puis l'arène elle-même.
+	*/
+void deleteArene(TypArene *arene) {
+	TypBlocArene *bloc;
+
+	while (arene->bloc != NULL) {
+		bloc = arene->bloc;
+		arene->bloc = bloc->precedent;
+		free(bloc);
+	}
+	free(arene);
+}
+
+
+	/*
+	* Fonction : arrondir
+	*
+	* Paramètres : size_t taille, un nombre d'octets
+	*
+	* Retour : size_t, le premier multiple de ALIGNEMENT_ARENE supérieur ou
+	*              égal
+	*/
+static size_t arrondir(size_t taille) {
+	return (taille + ALIGNEMENT_ARENE - 1) & ~(size_t) (ALIGNEMENT_ARENE - 1);
+}
+
+
+	/*
+	* Fonction : ajouterBloc
+	*
+	* Paramètres : TypArene *arene, une arène
+	*              size_t taille, la taille des données du nouveau bloc
+	*
+	* Description : Alloue un nouveau bloc qui devient le bloc courant. La
+	*               fin de l'ancien bloc n'est plus utilisée.
+	*/
+static void ajouterBloc(TypArene *arene, size_t taille) {
+	TypBlocArene *bloc;
+
+	bloc = malloc(sizeof(TypBlocArene) + taille);
+	bloc->precedent = arene->bloc;
+	bloc->taille = taille;
+	bloc->utilise = 0;
+	arene->bloc = bloc;
+}
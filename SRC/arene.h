@@ -0,0 +1,47 @@
+#ifndef ARENE_H
+#define ARENE_H
+
+#include <stddef.h>
+
+
+/* Alignement de toutes les allocations d'une arène */
+#define ALIGNEMENT_ARENE 8
+
+/* Nombre de classes de petits blocs recyclés (8, 16, ..., 64 octets) */
+#define NB_CLASSES_ARENE 8
+
+/*
+* Bloc de mémoire d'une arène. Les données suivent l'en-tête, qui fait
+* un multiple de ALIGNEMENT_ARENE.
+*/
+typedef struct TypBlocArene {
+	struct TypBlocArene *precedent;  /* Bloc alloué avant celui-ci */
+	size_t              taille;      /* Taille des données */
+	size_t              utilise;     /* Octets déjà distribués */
+	char                donnees[];
+} TypBlocArene;
+
+/*
+* Arène : les allocations sont prises à la suite dans de grands blocs et
+* ne sont libérées qu'ensemble, par deleteArene. Les petits blocs rendus
+* (voisins supprimés d'une liste) sont réutilisés par taille.
+* Une arène n'est pas protégée contre les accès concurrents.
+*/
+typedef struct TypArene {
+	TypBlocArene *bloc;                      /* Bloc courant */
+	size_t       tailleBloc;                 /* Taille du prochain bloc */
+	void         *libres[NB_CLASSES_ARENE];  /* Blocs rendus, par taille */
+} TypArene;
+
+
+TypArene* creerArene(size_t);
+
+void* allouerArene(TypArene*,size_t);
+
+void* allouerAreneZero(TypArene*,size_t);
+
+void rendreArene(TypArene*,void*,size_t);
+
+void deleteArene(TypArene*);
+
+#endif
@@ -0,0 +1,548 @@
+/*
+******************************************************************************
+*
+* Programme : binaire.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Format compilé des chantiers. Le fichier contient le tableau
+*          des tâches, les prédécesseurs de chaque sommet et le type de
+*          chaque dépendance sous forme compacte, un ordre topologique, la table des noms et, si elles
+*          ont été calculées, les dates et les marges. Il se charge sans
+*          aucune analyse de texte : les chaînes pointent directement dans
+*          le fichier projeté en mémoire.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include "libgraphe.h"
+#include "libliste.h"
+#include "pert.h"
+#include "erreurs.h"
+#include "binaire.h"
+
+
+static uint64_t aligner(uint64_t);
+static bool sectionValide(uint64_t,uint64_t,size_t,size_t);
+static bool enteteValide(const TypEnteteBinaire*,size_t);
+static bool contenuValide(const char*,const TypEnteteBinaire*);
+static bool ecrireSection(FILE*,uint64_t*,uint64_t,const void*,size_t);
+
+
+	/*
+	* Fonction : estGraphePERTBinaire
+	*
+	* Paramètres : const char *donnees, le contenu d'un fichier
+	*              size_t taille, la taille de ce contenu
+	*
+	* Retour : bool, true si le contenu commence comme un chantier compilé
+	*/
+bool estGraphePERTBinaire(const char *donnees, size_t taille) {
+	return taille >= sizeof(TypEnteteBinaire)
+	    && memcmp(donnees,MAGIQUE_BINAIRE,sizeof(MAGIQUE_BINAIRE)) == 0;
+}
+
+
+	/*
+	* Fonction : chargerGraphePERTBinaire
+	*
+	* Paramètres : char *donnees, le contenu d'un chantier compilé, aligné
+	*                  sur 8 octets (projection ou tampon alloué)
+	*              size_t taille, la taille de ce contenu
+	*
+	* Retour : TypGraphePERT*, le graphe PERT, ou NULL si le fichier est
+	*              d'une autre version ou incohérent
+	*
+	* Description : Reconstruit le graphe PERT sans analyse : les noms,
+	*               intitulés et dépendances pointent dans donnees, qui doit
+	*               rester valide aussi longtemps que le graphe (l'appelant
+	*               le range dans graphePERT->texte). L'ordre topologique
+	*               est repris tel quel ; si les dates sont présentes,
+	*               calculDates n'a rien à refaire.
+	*/
+TypGraphePERT* chargerGraphePERTBinaire(char *donnees, size_t taille) {
+	TypGraphePERT             *graphePERT;
+	const TypEnteteBinaire    *entete;
+	const TypTacheBinaire     *tachesBinaires;
+	const int32_t             *debutPred;
+	const int32_t             *pred;
+	const int32_t             *liens;
+	const int32_t             *ordre;
+	const int32_t             *marges;
+	const TypEntreeNomBinaire *tableNoms;
+	char                      *chaines;
+	TypArene                  *arene;
+	int                       nbSommets;
+	int                       s, j, p;
+
+	entete = (const TypEnteteBinaire*) donnees;
+	if (! enteteValide(entete,taille) || ! contenuValide(donnees,entete)) {
+		return NULL;
+	}
+
+	nbSommets = entete->nbSommets;
+	tachesBinaires = (const TypTacheBinaire*) (donnees + entete->taches);
+	debutPred = (const int32_t*) (donnees + entete->debutPred);
+	pred = (const int32_t*) (donnees + entete->pred);
+	liens = (const int32_t*) (donnees + entete->liens);
+	ordre = (const int32_t*) (donnees + entete->ordreTopo);
+	marges = (const int32_t*) (donnees + entete->marges);
+	tableNoms = (const TypEntreeNomBinaire*) (donnees + entete->tableNoms);
+	chaines = donnees + entete->chaines;
+
+	/* Tout le graphe est pris dans une arène dimensionnée d'après l'en-tête */
+	arene = creerArene(sizeof(TypGraphePERT) + 2 * sizeof(TypGraphe)
+	                   + nbSommets * (sizeof(TypTache) + sizeof(TypTache*) + 2 * sizeof(TypVoisins)
+	                                  + 2 * sizeof(TypVoisins*) + 5 * sizeof(int))
+	                   + 2 * (size_t) entete->nbAretes * sizeof(TypVoisins)
+	                   + entete->tailleTableNoms * sizeof(TypEntreeNom));
+	graphePERT = allouerArene(arene,sizeof(TypGraphePERT));
+	graphePERT->arene = arene;
+	graphePERT->texte = NULL;
+	graphePERT->tailleTexte = 0;
+	graphePERT->texteProjete = false;
+	graphePERT->datesCalculees = (entete->avecDates != 0);
+	graphePERT->liensTypes = false;
+	graphePERT->sommeDurees = 0;
+
+	/* Tâches, alpha et oméga compris */
+	graphePERT->taches = allouerArene(arene,nbSommets * sizeof(TypTache*));
+	graphePERT->duree = allouerArene(arene,nbSommets * sizeof(int));
+	graphePERT->dureeOptimiste = allouerArene(arene,nbSommets * sizeof(int));
+	graphePERT->dureePessimiste = allouerArene(arene,nbSommets * sizeof(int));
+	graphePERT->dateTot = allouerArene(arene,nbSommets * sizeof(int));
+	graphePERT->dateTard = allouerArene(arene,nbSommets * sizeof(int));
+	for (s = 0; s < nbSommets; s++) {
+		graphePERT->taches[s] = creerTache(arene,chaines + tachesBinaires[s].nom,
+		                                   chaines + tachesBinaires[s].intitule,
+		                                   chaines + tachesBinaires[s].dependances);
+		graphePERT->duree[s] = tachesBinaires[s].duree;
+		graphePERT->sommeDurees += graphePERT->duree[s];
+		graphePERT->dureeOptimiste[s] = tachesBinaires[s].dureeOptimiste;
+		graphePERT->dureePessimiste[s] = tachesBinaires[s].dureePessimiste;
+		graphePERT->dateTot[s] = tachesBinaires[s].dateTot;
+		graphePERT->dateTard[s] = tachesBinaires[s].dateTard;
+	}
+
+	/* Arêtes, dans l'ordre où creerGraphePERT les avait insérées,
+	   pondérées comme par relierSommets (voir TypGraphePERT) */
+	graphePERT->graphe = creerGrapheArene(nbSommets,arene);
+	graphePERT->grapheInverse = creerGrapheArene(nbSommets,arene);
+	for (s = 1; s <= nbSommets; s++) {
+		insertionSommet(graphePERT->graphe,s);
+		insertionSommet(graphePERT->grapheInverse,s);
+	}
+	for (s = 1; s <= nbSommets; s++) {
+		for (j = debutPred[s-1]; j < debutPred[s]; j++) {
+			p = pred[j];
+			ajouterVoisinArene(&(graphePERT->graphe->listesAdjacences[p-1]),s,
+			                   ecartLien(liens[j],graphePERT->duree[p-1],graphePERT->duree[s-1]),arene);
+			ajouterVoisinArene(&(graphePERT->grapheInverse->listesAdjacences[s-1]),p,liens[j],arene);
+			if (liens[j] != LIEN_SIMPLE) {
+				graphePERT->liensTypes = true;
+			}
+			graphePERT->sommeDurees += llabs(DECALAGE_LIEN(liens[j]));
+		}
+	}
+
+	/* Ordre topologique et marges */
+	graphePERT->ordreTopo = allouerArene(arene,nbSommets * sizeof(int));
+	graphePERT->rangTopo = allouerArene(arene,nbSommets * sizeof(int));
+	for (j = 0; j < nbSommets; j++) {
+		graphePERT->ordreTopo[j] = ordre[j];
+		graphePERT->rangTopo[ordre[j]-1] = j;
+	}
+	graphePERT->margeTotale = allouerAreneZero(arene,nbSommets * sizeof(int));
+	graphePERT->margeLibre = allouerAreneZero(arene,nbSommets * sizeof(int));
+	graphePERT->margeIndependante = allouerAreneZero(arene,nbSommets * sizeof(int));
+	if (entete->avecDates) {
+		for (s = 0; s < nbSommets; s++) {
+			graphePERT->margeTotale[s] = marges[s];
+			graphePERT->margeLibre[s] = marges[nbSommets + s];
+			graphePERT->margeIndependante[s] = marges[2 * nbSommets + s];
+		}
+	}
+
+	/* Table des noms */
+	graphePERT->tailleTableNoms = entete->tailleTableNoms;
+	graphePERT->tableNoms = allouerArene(arene,entete->tailleTableNoms * sizeof(TypEntreeNom));
+	for (j = 0; j < (int) entete->tailleTableNoms; j++) {
+		graphePERT->tableNoms[j].nom = chaines + tableNoms[j].nom;
+		graphePERT->tableNoms[j].sommet = tableNoms[j].sommet;
+	}
+
+	return graphePERT;
+}
+
+
+	/*
+	* Fonction : ecrireGraphePERTBinaire
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              FILE *fichier, fichier ouvert en écriture binaire
+	*
+	* Retour : int, 0 si le graphe est écrit, ERREUR_FICHIER sinon
+	*
+	* Description : Écrit le graphe au format compilé. Les dates et les
+	*               marges ne sont écrites que si elles sont à jour.
+	*/
+int ecrireGraphePERTBinaire(TypGraphePERT *graphePERT, FILE *fichier) {
+	TypEnteteBinaire    entete;
+	TypTacheBinaire     *tachesBinaires;
+	int32_t             *debutPred;
+	int32_t             *pred;
+	int32_t             *liens;
+	int32_t             *ordre;
+	int32_t             *marges;
+	TypEntreeNomBinaire *tableNoms;
+	char                *chaines;
+	TypTache            *tache;
+	TypVoisins          *liste;
+	TypVoisins          *vC;
+	uint64_t            position;   /* Octets déjà écrits */
+	size_t              taille;
+	int                 nbSommets;
+	int                 nbAretes;
+	int                 s, j;
+	bool                ecrit;
+
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+
+	/* Chaînes et tâches */
+	taille = 0;
+	for (s = 0; s < nbSommets; s++) {
+		tache = graphePERT->taches[s];
+		taille += strlen(tache->nom) + strlen(tache->intitule) + strlen(tache->dependances) + 3;
+	}
+	chaines = malloc(taille);
+	tachesBinaires = calloc(nbSommets, sizeof(TypTacheBinaire));
+	taille = 0;
+	for (s = 0; s < nbSommets; s++) {
+		tache = graphePERT->taches[s];
+		tachesBinaires[s].nom = taille;
+		strcpy(chaines + taille,tache->nom);
+		taille += strlen(tache->nom) + 1;
+		tachesBinaires[s].intitule = taille;
+		strcpy(chaines + taille,tache->intitule);
+		taille += strlen(tache->intitule) + 1;
+		tachesBinaires[s].dependances = taille;
+		strcpy(chaines + taille,tache->dependances);
+		taille += strlen(tache->dependances) + 1;
+		tachesBinaires[s].duree = graphePERT->duree[s];
+		tachesBinaires[s].dureeOptimiste = graphePERT->dureeOptimiste[s];
+		tachesBinaires[s].dureePessimiste = graphePERT->dureePessimiste[s];
+		if (graphePERT->datesCalculees) {
+			tachesBinaires[s].dateTot = graphePERT->dateTot[s];
+			tachesBinaires[s].dateTard = graphePERT->dateTard[s];
+		}
+	}
+
+	/* Prédécesseurs et dépendances, lus dans le graphe inverse */
+	debutPred = malloc((nbSommets + 1) * sizeof(int32_t));
+	nbAretes = 0;
+	for (s = 1; s <= nbSommets; s++) {
+		debutPred[s-1] = nbAretes;
+		nbAretes += degreSommet(graphePERT->grapheInverse,s);
+	}
+	debutPred[nbSommets] = nbAretes;
+	pred = malloc((nbAretes + 1) * sizeof(int32_t));
+	liens = malloc((nbAretes + 1) * sizeof(int32_t));
+	for (s = 1; s <= nbSommets; s++) {
+		j = debutPred[s-1];
+		liste = graphePERT->grapheInverse->listesAdjacences[s-1];
+		for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+			liens[j] = poidsVoisin(&vC);
+			pred[j++] = numeroVoisin(&vC);
+		}
+	}
+
+	/* Ordre topologique, marges et table des noms */
+	ordre = malloc(nbSommets * sizeof(int32_t));
+	marges = calloc(3 * (size_t) nbSommets, sizeof(int32_t));
+	for (s = 0; s < nbSommets; s++) {
+		ordre[s] = graphePERT->ordreTopo[s];
+		if (graphePERT->datesCalculees) {
+			marges[s] = graphePERT->margeTotale[s];
+			marges[nbSommets + s] = graphePERT->margeLibre[s];
+			marges[2 * nbSommets + s] = graphePERT->margeIndependante[s];
+		}
+	}
+	tableNoms = calloc(graphePERT->tailleTableNoms, sizeof(TypEntreeNomBinaire));
+	for (j = 0; j < graphePERT->tailleTableNoms; j++) {
+		s = graphePERT->tableNoms[j].sommet;
+		if (s != 0) {
+			tableNoms[j].nom = tachesBinaires[s-1].nom;
+			tableNoms[j].sommet = s;
+		}
+	}
+
+	/* En-tête : chaque section commence sur un multiple de 8 octets */
+	memset(&entete,0,sizeof(TypEnteteBinaire));
+	memcpy(entete.magique,MAGIQUE_BINAIRE,sizeof(MAGIQUE_BINAIRE));
+	entete.version = VERSION_BINAIRE;
+	entete.nbSommets = nbSommets;
+	entete.nbAretes = nbAretes;
+	entete.tailleTableNoms = graphePERT->tailleTableNoms;
+	entete.avecDates = graphePERT->datesCalculees ? 1 : 0;
+	entete.taches = aligner(sizeof(TypEnteteBinaire));
+	entete.debutPred = aligner(entete.taches + nbSommets * sizeof(TypTacheBinaire));
+	entete.pred = aligner(entete.debutPred + (nbSommets + 1) * sizeof(int32_t));
+	entete.liens = aligner(entete.pred + nbAretes * sizeof(int32_t));
+	entete.ordreTopo = aligner(entete.liens + nbAretes * sizeof(int32_t));
+	entete.marges = aligner(entete.ordreTopo + nbSommets * sizeof(int32_t));
+	entete.tableNoms = aligner(entete.marges + 3 * nbSommets * sizeof(int32_t));
+	entete.chaines = aligner(entete.tableNoms + entete.tailleTableNoms * sizeof(TypEntreeNomBinaire));
+	entete.tailleChaines = taille;
+
+	position = 0;
+	ecrit = ecrireSection(fichier,&position,0,&entete,sizeof(TypEnteteBinaire))
+	     && ecrireSection(fichier,&position,entete.taches,tachesBinaires,nbSommets * sizeof(TypTacheBinaire))
+	     && ecrireSection(fichier,&position,entete.debutPred,debutPred,(nbSommets + 1) * sizeof(int32_t))
+	     && ecrireSection(fichier,&position,entete.pred,pred,nbAretes * sizeof(int32_t))
+	     && ecrireSection(fichier,&position,entete.liens,liens,nbAretes * sizeof(int32_t))
+	     && ecrireSection(fichier,&position,entete.ordreTopo,ordre,nbSommets * sizeof(int32_t))
+	     && ecrireSection(fichier,&position,entete.marges,marges,3 * nbSommets * sizeof(int32_t))
+	     && ecrireSection(fichier,&position,entete.tableNoms,tableNoms,entete.tailleTableNoms * sizeof(TypEntreeNomBinaire))
+	     && ecrireSection(fichier,&position,entete.chaines,chaines,taille);
+
+	free(chaines);
+	free(tachesBinaires);
+	free(debutPred);
+	free(pred);
+	free(liens);
+	free(ordre);
+	free(marges);
+	free(tableNoms);
+
+	return ecrit ? 0 : ERREUR_FICHIER;
+}
+
+
+	/*
+	* Fonction : compilerGraphePERT
+	*
+	* Paramètres : const char *source, chemin d'un chantier (texte ou déjà
+	*                  compilé)
+	*              const char *destination, chemin du fichier compilé
+	*
+	* Retour : int, 0 si le chantier est compilé, ERREUR_FICHIER si la
+	*             source est introuvable ou invalide ou si l'écriture échoue
+	*
+	* Description : Lit le chantier, calcule ses dates et l'écrit au format
+	*               compilé. Le fichier est écrit sous un nom temporaire
+	*               puis renommé, pour qu'un lecteur ne voie jamais de
+	*               fichier incomplet.
+	*/
+int compilerGraphePERT(const char *source, const char *destination) {
+	TypGraphePERT *graphePERT;
+	FILE          *fichier;
+	char          *temporaire;  /* Chemin du fichier temporaire */
+	int           retour;
+
+	if ((fichier = fopen(source,"r")) == NULL) {
+		return ERREUR_FICHIER;
+	}
+	graphePERT = lireGraphePERT(fichier);
+	fclose(fichier);
+	if (graphePERT == NULL) {
+		return ERREUR_FICHIER;
+	}
+	calculDates(graphePERT);
+
+	temporaire = malloc(strlen(destination) + 24);
+	sprintf(temporaire,"%s.%ld.tmp",destination,(long) getpid());
+	retour = ERREUR_FICHIER;
+	if ((fichier = fopen(temporaire,"wb")) != NULL) {
+		retour = ecrireGraphePERTBinaire(graphePERT,fichier);
+		if (fclose(fichier) != 0) {
+			retour = ERREUR_FICHIER;
+		}
+		if (retour == 0 && rename(temporaire,destination) != 0) {
+			retour = ERREUR_FICHIER;
+		}
+		if (retour != 0) {
+			remove(temporaire);
+		}
+	}
+
+	free(temporaire);
+	deleteGraphePERT(graphePERT);
+
+	return retour;
+}
+
+
+	/*
+	* Fonction : aligner
+	*
+	* Paramètres : uint64_t position, une position dans le fichier
+	*
+	* Retour : uint64_t, le premier multiple de 8 supérieur ou égal
+	*/
+static uint64_t aligner(uint64_t position) {
+	return (position + 7) & ~(uint64_t) 7;
+}
+
+
+	/*
+	* Fonction : sectionValide
+	*
+	* Paramètres : uint64_t debut, position de la section
+	*              uint64_t nombre, nombre d'éléments de la section
+	*              size_t tailleElement, taille d'un élément
+	*              size_t taille, taille du fichier
+	*
+	* Retour : bool, true si la section est alignée et tient dans le fichier
+	*/
+static bool sectionValide(uint64_t debut, uint64_t nombre, size_t tailleElement, size_t taille) {
+	return debut % 8 == 0
+	    && debut <= taille
+	    && nombre <= (taille - debut) / tailleElement;
+}
+
+
+	/*
+	* Fonction : enteteValide
+	*
+	* Paramètres : const TypEnteteBinaire *entete, l'en-tête du fichier
+	*              size_t taille, taille du fichier
+	*
+	* Retour : bool, true si la version est connue et que toutes les
+	*             sections tiennent dans le fichier
+	*/
+static bool enteteValide(const TypEnteteBinaire *entete, size_t taille) {
+	uint32_t n;
+
+	n = entete->nbSommets;
+	return entete->version == VERSION_BINAIRE
+	    && n >= 2 && n < INT32_MAX / 4
+	    && entete->nbAretes < INT32_MAX
+	    && entete->tailleTableNoms > 0
+	    && (entete->tailleTableNoms & (entete->tailleTableNoms - 1)) == 0
+	    && sectionValide(entete->taches,n,sizeof(TypTacheBinaire),taille)
+	    && sectionValide(entete->debutPred,(uint64_t) n + 1,sizeof(int32_t),taille)
+	    && sectionValide(entete->pred,entete->nbAretes,sizeof(int32_t),taille)
+	    && sectionValide(entete->liens,entete->nbAretes,sizeof(int32_t),taille)
+	    && sectionValide(entete->ordreTopo,n,sizeof(int32_t),taille)
+	    && sectionValide(entete->marges,3 * (uint64_t) n,sizeof(int32_t),taille)
+	    && sectionValide(entete->tableNoms,entete->tailleTableNoms,sizeof(TypEntreeNomBinaire),taille)
+	    && sectionValide(entete->chaines,entete->tailleChaines,1,taille)
+	    && entete->tailleChaines > 0;
+}
+
+
+	/*
+	* Fonction : contenuValide
+	*
+	* Paramètres : const char *donnees, le contenu du fichier
+	*              const TypEnteteBinaire *entete, son en-tête (valide)
+	*
+	* Retour : bool, true si les chaînes, les prédécesseurs, l'ordre
+	*             topologique et la table des noms sont cohérents, et que
+	*             les durées et décalages respectent DUREE_MAX_CHANTIER
+	*
+	* Description : Un fichier abîmé ne doit pas faire lire hors des
+	*               sections : chaque position et chaque sommet est vérifié,
+	*               ainsi que le fait que l'ordre soit bien topologique.
+	*/
+static bool contenuValide(const char *donnees, const TypEnteteBinaire *entete) {
+	const TypTacheBinaire     *taches;
+	const int32_t             *debutPred;
+	const int32_t             *pred;
+	const int32_t             *liens;
+	const int32_t             *ordre;
+	const TypEntreeNomBinaire *tableNoms;
+	int                       *rang;
+	long long                 sommeDurees; /* Voir TypGraphePERT */
+	int                       n;
+	int                       s, j;
+	bool                      valide;
+
+	n = entete->nbSommets;
+	taches = (const TypTacheBinaire*) (donnees + entete->taches);
+	debutPred = (const int32_t*) (donnees + entete->debutPred);
+	pred = (const int32_t*) (donnees + entete->pred);
+	liens = (const int32_t*) (donnees + entete->liens);
+	ordre = (const int32_t*) (donnees + entete->ordreTopo);
+	tableNoms = (const TypEntreeNomBinaire*) (donnees + entete->tableNoms);
+
+	valide = (donnees[entete->chaines + entete->tailleChaines - 1] == '\0');
+	sommeDurees = 0;
+	for (s = 0; s < n && valide; s++) {
+		valide = taches[s].nom < entete->tailleChaines
+		      && taches[s].intitule < entete->tailleChaines
+		      && taches[s].dependances < entete->tailleChaines
+		      && taches[s].duree >= 0;
+		sommeDurees += taches[s].duree;
+	}
+	for (j = 0; j < (int) entete->nbAretes && valide; j++) {
+		sommeDurees += llabs(DECALAGE_LIEN(liens[j]));
+	}
+	valide = valide && sommeDurees <= DUREE_MAX_CHANTIER;
+	for (j = 0; j < (int) entete->tailleTableNoms && valide; j++) {
+		valide = tableNoms[j].nom < entete->tailleChaines
+		      && tableNoms[j].sommet >= 0 && tableNoms[j].sommet <= n;
+	}
+
+	/* ordre doit être une permutation des sommets */
+	rang = malloc(n * sizeof(int));
+	for (s = 0; s < n; s++) {
+		rang[s] = -1;
+	}
+	for (j = 0; j < n && valide; j++) {
+		valide = ordre[j] >= 1 && ordre[j] <= n && rang[ordre[j]-1] == -1;
+		if (valide) {
+			rang[ordre[j]-1] = j;
+		}
+	}
+
+	/* Chaque prédécesseur doit être rangé avant son successeur */
+	valide = valide && debutPred[0] == 0 && debutPred[n] == (int32_t) entete->nbAretes;
+	for (s = 1; s <= n && valide; s++) {
+		valide = debutPred[s-1] <= debutPred[s];
+		for (j = debutPred[s-1]; j < debutPred[s] && valide; j++) {
+			valide = pred[j] >= 1 && pred[j] <= n && rang[pred[j]-1] < rang[s-1];
+		}
+	}
+	free(rang);
+
+	return valide;
+}
+
+
+	/*
+	* Fonction : ecrireSection
+	*
+	* Paramètres : FILE *fichier, le fichier compilé
+	*              uint64_t *position, octets déjà écrits (mis à jour)
+	*              uint64_t debut, position de la section
+	*              const void *section, size_t taille, son contenu
+	*
+	* Retour : bool, true si l'écriture a réussi
+	*
+	* Description : Complète par des zéros jusqu'au début de la section
+	*               puis l'écrit.
+	*/
+static bool ecrireSection(FILE *fichier, uint64_t *position, uint64_t debut, const void *section, size_t taille) {
+	bool ecrit;
+
+	ecrit = true;
+	while (*position < debut && ecrit) {
+		ecrit = (fputc(0,fichier) != EOF);
+		(*position)++;
+	}
+	if (ecrit && taille > 0) {
+		ecrit = (fwrite(section,1,taille,fichier) == taille);
+	}
+	*position += taille;
+
+	return ecrit;
+}
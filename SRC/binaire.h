@@ -0,0 +1,73 @@
+#ifndef BINAIRE_H
+#define BINAIRE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "pert.h"
+
+
+/* Début de tout fichier compilé */
+#define MAGIQUE_BINAIRE "PERTBIN"
+
+/* Incrémentée à chaque changement de format */
+#define VERSION_BINAIRE 2
+
+/*
+* En-tête d'un fichier compilé. Les sections suivent, alignées sur 8
+* octets ; leur position est donnée depuis le début du fichier. Les
+* entiers sont écrits dans l'ordre de la machine qui a compilé.
+*/
+typedef struct TypEnteteBinaire {
+	char     magique[8];         /* MAGIQUE_BINAIRE */
+	uint32_t version;            /* VERSION_BINAIRE */
+	uint32_t nbSommets;          /* Alpha et oméga compris */
+	uint32_t nbAretes;
+	uint32_t tailleTableNoms;    /* Puissance de 2 */
+	uint32_t avecDates;          /* 1 si dates et marges sont présentes */
+	uint32_t reserve;
+	uint64_t taches;             /* TypTacheBinaire[nbSommets] */
+	uint64_t debutPred;          /* int32_t[nbSommets+1] : prédécesseurs de
+	                                s en pred[debutPred[s-1]] à
+	                                pred[debutPred[s]-1] */
+	uint64_t pred;               /* int32_t[nbAretes] */
+	uint64_t liens;              /* int32_t[nbAretes] : code de chaque
+	                                dépendance de pred (voir LIEN) */
+	uint64_t ordreTopo;          /* int32_t[nbSommets] */
+	uint64_t marges;             /* int32_t[3*nbSommets] : totale, libre,
+	                                indépendante (si avecDates) */
+	uint64_t tableNoms;          /* TypEntreeNomBinaire[tailleTableNoms] */
+	uint64_t chaines;            /* Chaînes terminées par '\0' */
+	uint64_t tailleChaines;
+} TypEnteteBinaire;
+
+/*
+* Tâche d'un fichier compilé : les chaînes sont données par leur position
+* dans la section des chaînes.
+*/
+typedef struct TypTacheBinaire {
+	uint32_t nom;
+	uint32_t intitule;
+	uint32_t dependances;
+	int32_t  duree;
+	int32_t  dureeOptimiste;
+	int32_t  dureePessimiste;
+	int32_t  dateTot;
+	int32_t  dateTard;
+} TypTacheBinaire;
+
+typedef struct TypEntreeNomBinaire {
+	uint32_t nom;     /* Position du nom dans les chaînes */
+	int32_t  sommet;  /* 0 : case vide */
+} TypEntreeNomBinaire;
+
+
+bool estGraphePERTBinaire(const char*,size_t);
+
+TypGraphePERT* chargerGraphePERTBinaire(char*,size_t);
+
+int ecrireGraphePERTBinaire(TypGraphePERT*,FILE*);
+
+int compilerGraphePERT(const char*,const char*);
+
+#endif
@@ -0,0 +1,441 @@
+/*
+******************************************************************************
+*
+* Programme : cache.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Cache des résultats de requêtes, indexé par le contenu du
+*          chantier. Un chantier modifié a une autre empreinte : les anciens
+*          résultats ne sont plus jamais trouvés et finissent retirés par
+*          la politique LRU.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "libgraphe.h"
+#include "pert.h"
+#include "cache.h"
+
+
+/* Paramètres de l'empreinte FNV-1a sur 64 bits */
+#define FNV_BASE  0xCBF29CE484222325ULL
+#define FNV_PRIME 0x100000001B3ULL
+
+
+static TypEntreeCache* trouverEntree(TypCache*,uint64_t);
+static void placerEnTete(TypCache*,TypEntreeCache*);
+static void retirerDeListe(TypCache*,TypEntreeCache*);
+static void insererEntree(TypCache*,uint64_t,const char*);
+static char* lireFichierCache(TypCache*,uint64_t);
+static void ecrireFichierCache(TypCache*,uint64_t,const char*);
+
+
+	/*
+	* Fonction : creerCache
+	*
+	* Paramètres : int capacite, le nombre maximal d'entrées en mémoire
+	*              const char *repertoire, répertoire (existant) où
+	*                  recopier les entrées, ou NULL
+	*
+	* Retour : TypCache*, le cache créé, vide
+	*/
+TypCache* creerCache(int capacite, const char *repertoire) {
+	TypCache *cache;
+
+	cache = malloc(sizeof(TypCache));
+	cache->capacite = (capacite > 0) ? capacite : 1;
+	cache->nbEntrees = 0;
+	cache->nbAlveoles = 2 * cache->capacite;
+	cache->alveoles = calloc(cache->nbAlveoles, sizeof(TypEntreeCache*));
+	cache->plusRecente = NULL;
+	cache->plusAncienne = NULL;
+	cache->repertoire = NULL;
+	if (repertoire != NULL) {
+		cache->repertoire = malloc(strlen(repertoire) + 1);
+		strcpy(cache->repertoire,repertoire);
+	}
+	cache->nbSucces = 0;
+	cache->nbEchecs = 0;
+	pthread_mutex_init(&cache->verrou,NULL);
+
+	return cache;
+}
+
+
+	/*
+	* Fonction : deleteCache
+	*
+	* Paramètres : TypCache *cache, le cache à supprimer
+	*
+	* Description : Libère la mémoire du cache. Les fichiers du répertoire
+	*               sont conservés.
+	*/
+void deleteCache(TypCache *cache) {
+	TypEntreeCache *entree;
+	TypEntreeCache *suivante;
+
+	for (entree = cache->plusRecente; entree != NULL; entree = suivante) {
+		suivante = entree->plusAncienne;
+		free(entree->valeur);
+		free(entree);
+	}
+	free(cache->alveoles);
+	free(cache->repertoire);
+	pthread_mutex_destroy(&cache->verrou);
+	free(cache);
+}
+
+
+	/*
+	* Fonction : chercherCache
+	*
+	* Paramètres : TypCache *cache, un cache
+	*              uint64_t cle, la clé cherchée
+	*
+	* Retour : char*, une copie du résultat associé à la clé (à libérer par
+	*              l'appelant), ou NULL s'il est absent
+	*
+	* Description : Cherche d'abord en mémoire, puis dans le répertoire.
+	*               L'entrée trouvée devient la plus récemment utilisée.
+	*               Le fichier est lu sans garder le verrou : les autres
+	*               threads continuent d'utiliser le cache pendant la
+	*               lecture.
+	*/
+char* chercherCache(TypCache *cache, uint64_t cle) {
+	TypEntreeCache *entree;
+	char           *valeur;  /* La copie renvoyée */
+
+	pthread_mutex_lock(&cache->verrou);
+	entree = trouverEntree(cache,cle);
+	if (entree != NULL) {
+		placerEnTete(cache,entree);
+		valeur = malloc(strlen(entree->valeur) + 1);
+		strcpy(valeur,entree->valeur);
+		cache->nbSucces++;
+		pthread_mutex_unlock(&cache->verrou);
+		return valeur;
+	}
+	pthread_mutex_unlock(&cache->verrou);
+
+	valeur = lireFichierCache(cache,cle);
+
+	pthread_mutex_lock(&cache->verrou);
+	if (valeur != NULL) {
+		/* Un autre thread a pu ajouter la clé pendant la lecture */
+		entree = trouverEntree(cache,cle);
+		if (entree != NULL) {
+			placerEnTete(cache,entree);
+		}
+		else {
+			insererEntree(cache,cle,valeur);
+		}
+		cache->nbSucces++;
+	}
+	else {
+		cache->nbEchecs++;
+	}
+	pthread_mutex_unlock(&cache->verrou);
+
+	return valeur;
+}
+
+
+	/*
+	* Fonction : ajouterCache
+	*
+	* Paramètres : TypCache *cache, un cache
+	*              uint64_t cle, la clé du résultat
+	*              const char *valeur, le résultat (recopié)
+	*
+	* Description : Ajoute ou remplace le résultat associé à la clé, et le
+	*               recopie dans le répertoire s'il y en a un, après avoir
+	*               rendu le verrou.
+	*/
+void ajouterCache(TypCache *cache, uint64_t cle, const char *valeur) {
+	TypEntreeCache *entree;
+
+	pthread_mutex_lock(&cache->verrou);
+
+	entree = trouverEntree(cache,cle);
+	if (entree != NULL) {
+		free(entree->valeur);
+		entree->valeur = malloc(strlen(valeur) + 1);
+		strcpy(entree->valeur,valeur);
+		placerEnTete(cache,entree);
+	}
+	else {
+		insererEntree(cache,cle,valeur);
+	}
+
+	pthread_mutex_unlock(&cache->verrou);
+
+	ecrireFichierCache(cache,cle,valeur);
+}
+
+
+	/*
+	* Fonction : empreinteGraphePERT
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*
+	* Retour : uint64_t, l'empreinte du contenu du chantier
+	*
+	* Description : Empreinte FNV-1a du nom, des durées et des dépendances
+	*               de chaque tâche. Elle ne dépend que de ce qui a été lu :
+	*               elle peut être calculée avant calculDates.
+	*/
+uint64_t empreinteGraphePERT(TypGraphePERT *graphePERT) {
+	TypTache *tache;
+	uint64_t empreinte;
+	int      i;
+
+	empreinte = FNV_BASE;
+	for (i = 0; i < graphePERT->graphe->nbrMaxSommets; i++) {
+		tache = graphePERT->taches[i];
+		empreinte = empreinteAjouter(empreinte,tache->nom,strlen(tache->nom) + 1);
+		empreinte = empreinteAjouter(empreinte,&graphePERT->duree[i],sizeof(int));
+		empreinte = empreinteAjouter(empreinte,&graphePERT->dureeOptimiste[i],sizeof(int));
+		empreinte = empreinteAjouter(empreinte,&graphePERT->dureePessimiste[i],sizeof(int));
+		/* Le '\0' sépare les dépendances de la tâche suivante */
+		empreinte = empreinteAjouter(empreinte,tache->dependances,strlen(tache->dependances) + 1);
+	}
+
+	return empreinte;
+}
+
+
+	/*
+	* Fonction : empreinteAjouter
+	*
+	* Paramètres : uint64_t empreinte, une empreinte en cours de calcul
+	*              const void *donnees, size_t taille, les octets à ajouter
+	*
+	* Retour : uint64_t, l'empreinte complétée par les octets donnés
+	*/
+uint64_t empreinteAjouter(uint64_t empreinte, const void *donnees, size_t taille) {
+	const unsigned char *octets = donnees;
+	size_t              i;
+
+	for (i = 0; i < taille; i++) {
+		empreinte ^= octets[i];
+		empreinte *= FNV_PRIME;
+	}
+
+	return empreinte;
+}
+
+
+	/*
+	* Fonction : trouverEntree
+	*
+	* Paramètres : TypCache *cache, un cache (verrou pris)
+	*              uint64_t cle, une clé
+	*
+	* Retour : TypEntreeCache*, l'entrée en mémoire de cette clé, ou NULL
+	*/
+static TypEntreeCache* trouverEntree(TypCache *cache, uint64_t cle) {
+	TypEntreeCache *entree;
+
+	entree = cache->alveoles[cle % cache->nbAlveoles];
+	while (entree != NULL && entree->cle != cle) {
+		entree = entree->suivante;
+	}
+
+	return entree;
+}
+
+
+	/*
+	* Fonction : placerEnTete
+	*
+	* Paramètres : TypCache *cache, un cache (verrou pris)
+	*              TypEntreeCache *entree, une entrée du cache
+	*
+	* Description : Fait de l'entrée la plus récemment utilisée.
+	*/
+static void placerEnTete(TypCache *cache, TypEntreeCache *entree) {
+	retirerDeListe(cache,entree);
+
+	entree->plusRecente = NULL;
+	entree->plusAncienne = cache->plusRecente;
+	if (cache->plusRecente != NULL) {
+		cache->plusRecente->plusRecente = entree;
+	}
+	cache->plusRecente = entree;
+	if (cache->plusAncienne == NULL) {
+		cache->plusAncienne = entree;
+	}
+}
+
+
+	/*
+	* Fonction : retirerDeListe
+	*
+	* Paramètres : TypCache *cache, un cache (verrou pris)
+	*              TypEntreeCache *entree, une entrée de la liste LRU (ou
+	*                  une entrée isolée, dont les liens valent NULL)
+	*/
+static void retirerDeListe(TypCache *cache, TypEntreeCache *entree) {
+	if (entree->plusRecente != NULL) {
+		entree->plusRecente->plusAncienne = entree->plusAncienne;
+	}
+	else if (cache->plusRecente == entree) {
+		cache->plusRecente = entree->plusAncienne;
+	}
+	if (entree->plusAncienne != NULL) {
+		entree->plusAncienne->plusRecente = entree->plusRecente;
+	}
+	else if (cache->plusAncienne == entree) {
+		cache->plusAncienne = entree->plusRecente;
+	}
+	entree->plusRecente = NULL;
+	entree->plusAncienne = NULL;
+}
+
+
+	/*
+	* Fonction : insererEntree
+	*
+	* Paramètres : TypCache *cache, un cache (verrou pris)
+	*              uint64_t cle, une clé absente de la mémoire
+	*              const char *valeur, le résultat (recopié)
+	*
+	* Description : Ajoute l'entrée en tête de la liste LRU, après avoir
+	*               retiré la moins récemment utilisée si le cache est plein.
+	*/
+static void insererEntree(TypCache *cache, uint64_t cle, const char *valeur) {
+	TypEntreeCache *entree;
+	TypEntreeCache **lien;   /* Lien vers l'entrée retirée dans son alvéole */
+
+	if (cache->nbEntrees == cache->capacite) {
+		entree = cache->plusAncienne;
+		retirerDeListe(cache,entree);
+		lien = &(cache->alveoles[entree->cle % cache->nbAlveoles]);
+		while (*lien != entree) {
+			lien = &((*lien)->suivante);
+		}
+		*lien = entree->suivante;
+		free(entree->valeur);
+		free(entree);
+		cache->nbEntrees--;
+	}
+
+	entree = malloc(sizeof(TypEntreeCache));
+	entree->cle = cle;
+	entree->valeur = malloc(strlen(valeur) + 1);
+	strcpy(entree->valeur,valeur);
+	entree->plusRecente = NULL;
+	entree->plusAncienne = NULL;
+	entree->suivante = cache->alveoles[cle % cache->nbAlveoles];
+	cache->alveoles[cle % cache->nbAlveoles] = entree;
+	placerEnTete(cache,entree);
+	cache->nbEntrees++;
+}
+
+
+	/*
+	* Fonction : lireFichierCache
+	*
+	* Paramètres : TypCache *cache, un cache (verrou non pris)
+	*              uint64_t cle, une clé
+	*
+	* Retour : char*, le contenu du fichier de la clé dans le répertoire du
+	*              cache (à libérer), ou NULL s'il n'existe pas
+	*/
+static char* lireFichierCache(TypCache *cache, uint64_t cle) {
+	FILE *fichier;
+	char *chemin;   /* Chemin du fichier de la clé */
+	char *valeur;
+	long taille;
+
+	if (cache->repertoire == NULL) {
+		return NULL;
+	}
+
+	chemin = malloc(strlen(cache->repertoire) + 18);
+	sprintf(chemin,"%s/%016llx",cache->repertoire,(unsigned long long) cle);
+	fichier = fopen(chemin,"rb");
+	free(chemin);
+	if (fichier == NULL) {
+		return NULL;
+	}
+
+	fseek(fichier,0,SEEK_END);
+	taille = ftell(fichier);
+	rewind(fichier);
+	valeur = malloc(taille + 1);
+	if (fread(valeur,1,taille,fichier) != (size_t) taille) {
+		free(valeur);
+		valeur = NULL;
+	}
+	else {
+		valeur[taille] = '\0';
+	}
+	fclose(fichier);
+
+	return valeur;
+}
+
+
+	/*
+	* Fonction : ecrireFichierCache
+	*
+	* Paramètres : TypCache *cache, un cache (verrou non pris)
+	*              uint64_t cle, une clé
+	*              const char *valeur, le résultat associé
+	*
+	* Description : Écrit le résultat dans un fichier temporaire propre à
+	*               l'appel puis le renomme, pour qu'un lecteur ne voie
+	*               jamais de fichier incomplet. Appelée sans le verrou :
+	*               deux threads peuvent écrire la même clé en même temps,
+	*               chacun dans son fichier temporaire.
+	*/
+static void ecrireFichierCache(TypCache *cache, uint64_t cle, const char *valeur) {
+	FILE *fichier;
+	char *chemin;      /* Chemin du fichier de la clé */
+	char *temporaire;  /* Chemin du fichier temporaire */
+	int  descripteur;  /* Descripteur du fichier temporaire */
+	bool ecrit;
+
+	if (cache->repertoire == NULL) {
+		return;
+	}
+
+	chemin = malloc(strlen(cache->repertoire) + 18);
+	temporaire = malloc(strlen(cache->repertoire) + 30);
+	sprintf(chemin,"%s/%016llx",cache->repertoire,(unsigned long long) cle);
+	sprintf(temporaire,"%s.XXXXXX",chemin);
+
+	/* mkstemp crée le fichier en 0600 : les entrées restent lisibles par
+	   les autres utilisateurs du répertoire, comme avec fopen */
+	descripteur = mkstemp(temporaire);
+	if (descripteur >= 0) {
+		fchmod(descripteur,0644);
+	}
+	fichier = (descripteur >= 0) ? fdopen(descripteur,"wb") : NULL;
+	if (fichier == NULL && descripteur >= 0) {
+		close(descripteur);
+		remove(temporaire);
+	}
+	if (fichier != NULL) {
+		ecrit = (fputs(valeur,fichier) != EOF);
+		ecrit = (fclose(fichier) == 0) && ecrit;
+		if (! ecrit || rename(temporaire,chemin) != 0) {
+			remove(temporaire);
+		}
+	}
+
+	free(chemin);
+	free(temporaire);
+}
@@ -0,0 +1,52 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stdint.h>
+#include <pthread.h>
+#include "pert.h"
+
+
+/*
+* Entrée du cache : un résultat indexé par une empreinte du chantier et
+* des paramètres de la requête.
+*/
+typedef struct TypEntreeCache {
+	uint64_t              cle;
+	char                  *valeur;
+	struct TypEntreeCache *plusRecente;  /* Liste LRU, doublement chaînée */
+	struct TypEntreeCache *plusAncienne;
+	struct TypEntreeCache *suivante;     /* Entrée suivante de l'alvéole */
+} TypEntreeCache;
+
+/*
+* Cache des résultats, borné à capacite entrées (la moins récemment
+* utilisée est retirée en premier) et éventuellement recopié dans un
+* répertoire, un fichier par clé. Il peut être partagé entre threads.
+*/
+typedef struct TypCache {
+	int             capacite;     /* Nombre maximal d'entrées en mémoire */
+	int             nbEntrees;
+	int             nbAlveoles;   /* Taille de la table de hachage */
+	TypEntreeCache  **alveoles;
+	TypEntreeCache  *plusRecente; /* Tête de la liste LRU */
+	TypEntreeCache  *plusAncienne;
+	char            *repertoire;  /* NULL : pas de copie sur disque */
+	long            nbSucces;     /* Requêtes trouvées dans le cache */
+	long            nbEchecs;
+	pthread_mutex_t verrou;
+} TypCache;
+
+
+TypCache* creerCache(int,const char*);
+
+void deleteCache(TypCache*);
+
+char* chercherCache(TypCache*,uint64_t);
+
+void ajouterCache(TypCache*,uint64_t,const char*);
+
+uint64_t empreinteGraphePERT(TypGraphePERT*);
+
+uint64_t empreinteAjouter(uint64_t,const void*,size_t);
+
+#endif
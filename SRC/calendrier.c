@@ -0,0 +1,534 @@
+/*
+******************************************************************************
+*
+* Programme : calendrier.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Calendriers de travail (jours ouvrés de la semaine, jours
+*          fériés) et dates des tâches selon le calendrier de chacune.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include "libgraphe.h"
+#include "pert.h"
+#include "calendrier.h"
+
+
+/* Longueur maximale d'un champ du fichier de calendriers */
+#define TAILLE_NOM 64
+
+/* Nombre de jours ajoutés aux tables, en plus du doublement */
+#define JOURS_INITIAUX 512
+
+
+static TypCalendrier* creerCalendrier(const char*,const char*);
+static void deleteCalendrier(TypCalendrier*);
+static void etendreCalendrier(TypCalendrier*,int);
+static int chercherCalendrier(TypCalendriers*,const char*);
+static bool lireDate(const char*,int*);
+static int joursDepuisEpoque(int,int,int);
+static int comparerJours(const void*, const void*);
+
+
+	/*
+	* Fonction : lireCalendriers
+	*
+	* Paramètres : FILE *fichier, un fichier de calendriers ouvert en lecture
+	*              TypGraphePERT *graphePERT, le graphe PERT du chantier
+	*
+	* Retour : TypCalendriers*, les calendriers lus, ou NULL si le fichier
+	*              est incohérent (date de début absente, date invalide,
+	*              calendrier sans jour ouvré, tâche ou calendrier inconnu)
+	*
+	* Description : Lit un fichier de calendriers. Les lignes commençant par
+	*               '#' sont ignorées ; les autres sont de la forme :
+	*                   debut, 2026-11-02             (date du jour 0)
+	*                   calendrier, bureau, 1111100   (jours ouvrés, du
+	*                                                  lundi au dimanche)
+	*                   ferie, bureau, 2026-12-25
+	*                   tache, A, bureau
+	*               Un calendrier doit être déclaré avant d'être cité. Sans
+	*               calendrier déclaré, tous les jours sont ouvrés.
+	*/
+TypCalendriers* lireCalendriers(FILE *fichier, TypGraphePERT *graphePERT) {
+	TypCalendriers *calendriers;       /* Les calendriers lus */
+	TypCalendrier  *calendrier;
+	char           ligne[512];         /* Ligne lue dans le fichier */
+	char           champ1[TAILLE_NOM]; /* Champs de la ligne */
+	char           champ2[TAILLE_NOM];
+	char           champ3[TAILLE_NOM];
+	int            nbChamps;
+	bool           debutLu;            /* true si la date de début est lue */
+	bool           valide;
+	int            jour;
+	int            c, i, sommet;
+
+	calendriers = malloc(sizeof(TypCalendriers));
+	calendriers->jourDebut = 0;
+	calendriers->nbCalendriers = 0;
+	calendriers->calendriers = NULL;
+	calendriers->nbSommets = graphePERT->graphe->nbrMaxSommets;
+	calendriers->calendrierSommet = calloc(calendriers->nbSommets, sizeof(int));
+
+	debutLu = false;
+	valide = true;
+	while (valide && fgets(ligne,sizeof(ligne),fichier) != NULL) {
+		if (ligne[0] == '#') {
+			continue;
+		}
+		nbChamps = sscanf(ligne," %63[^,], %63[^,], %63s",champ1,champ2,champ3);
+		if (nbChamps < 2) {
+			continue;
+		}
+		if (nbChamps == 2) {
+			/* Sans troisième champ, le deuxième va jusqu'à la fin de ligne */
+			champ2[strcspn(champ2," \t\r\n")] = '\0';
+		}
+
+		if (strcmp(champ1,"debut") == 0 && nbChamps == 2) {
+			valide = lireDate(champ2,&calendriers->jourDebut);
+			debutLu = true;
+		}
+		else if (strcmp(champ1,"calendrier") == 0 && nbChamps == 3) {
+			calendrier = creerCalendrier(champ2,champ3);
+			if (calendrier == NULL || chercherCalendrier(calendriers,champ2) != -1) {
+				if (calendrier != NULL) {
+					deleteCalendrier(calendrier);
+				}
+				valide = false;
+			}
+			else {
+				calendriers->calendriers = realloc(calendriers->calendriers,
+					(calendriers->nbCalendriers + 1) * sizeof(TypCalendrier*));
+				calendriers->calendriers[calendriers->nbCalendriers++] = calendrier;
+			}
+		}
+		else if (strcmp(champ1,"ferie") == 0 && nbChamps == 3) {
+			c = chercherCalendrier(calendriers,champ2);
+			if (c == -1 || !lireDate(champ3,&jour)) {
+				valide = false;
+			}
+			else {
+				calendrier = calendriers->calendriers[c];
+				calendrier->feries = realloc(calendrier->feries,(calendrier->nbFeries + 1) * sizeof(int));
+				calendrier->feries[calendrier->nbFeries++] = jour;
+			}
+		}
+		else if (strcmp(champ1,"tache") == 0 && nbChamps == 3) {
+			sommet = chercherTache(graphePERT,champ2);
+			c = chercherCalendrier(calendriers,champ3);
+			if (sommet == -1 || c == -1) {
+				valide = false;
+			}
+			else {
+				calendriers->calendrierSommet[sommet-1] = c;
+			}
+		}
+		else {
+			valide = false;
+		}
+	}
+
+	if (!valide || !debutLu) {
+		deleteCalendriers(calendriers);
+		return NULL;
+	}
+
+	if (calendriers->nbCalendriers == 0) {
+		calendriers->calendriers = malloc(sizeof(TypCalendrier*));
+		calendriers->calendriers[calendriers->nbCalendriers++] = creerCalendrier("continu","1111111");
+	}
+
+	/* Jours fériés comptés depuis le jour 0, jour de la semaine du jour 0 */
+	for (c = 0; c < calendriers->nbCalendriers; c++) {
+		calendrier = calendriers->calendriers[c];
+		for (i = 0; i < calendrier->nbFeries; i++) {
+			calendrier->feries[i] -= calendriers->jourDebut;
+		}
+		qsort(calendrier->feries,calendrier->nbFeries,sizeof(int),comparerJours);
+		/* Le 01/01/1970 était un jeudi */
+		calendrier->jourSemaine0 = ((calendriers->jourDebut + 3) % 7 + 7) % 7;
+	}
+
+	return calendriers;
+}
+
+
+	/*
+	* Fonction : deleteCalendriers
+	*
+	* Paramètres : TypCalendriers *calendriers, les calendriers à supprimer
+	*
+	* Description : Libère la mémoire occupée par les calendriers.
+	*/
+void deleteCalendriers(TypCalendriers *calendriers) {
+	int c;
+
+	for (c = 0; c < calendriers->nbCalendriers; c++) {
+		deleteCalendrier(calendriers->calendriers[c]);
+	}
+	free(calendriers->calendriers);
+	free(calendriers->calendrierSommet);
+	free(calendriers);
+}
+
+
+	/*
+	* Fonction : rangOuvre
+	*
+	* Paramètres : TypCalendrier *calendrier, un calendrier
+	*              int jour, un jour (>= 0)
+	*
+	* Retour : int, le nombre de jours ouvrés avant jour, c'est-à-dire le
+	*              rang du premier jour ouvré à partir de jour
+	*/
+int rangOuvre(TypCalendrier *calendrier, int jour) {
+	if (jour > calendrier->nbJours) {
+		etendreCalendrier(calendrier,(jour > 2 * calendrier->nbJours + JOURS_INITIAUX)
+			? jour : 2 * calendrier->nbJours + JOURS_INITIAUX);
+	}
+
+	return calendrier->cumul[jour];
+}
+
+
+	/*
+	* Fonction : jourOuvre
+	*
+	* Paramètres : TypCalendrier *calendrier, un calendrier
+	*              int rang, un rang (>= 0)
+	*
+	* Retour : int, le jour du rang-ième jour ouvré (à partir de 0)
+	*/
+int jourOuvre(TypCalendrier *calendrier, int rang) {
+	while (rang >= calendrier->nbOuvres) {
+		etendreCalendrier(calendrier,2 * calendrier->nbJours + JOURS_INITIAUX);
+	}
+
+	return calendrier->ouvres[rang];
+}
+
+
+	/*
+	* Fonction : calculDatesCalendrier
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              TypCalendriers *calendriers, les calendriers lus pour ce
+	*                  graphe
+	*
+	* Retour : TypDatesCalendrier*, les dates de chaque sommet, ou NULL si
+	*              le graphe a des liens typés (le calendrier dans lequel
+	*              compter un décalage n'est pas défini)
+	*
+	* Description : Passes avant et arrière dans l'ordre topologique. Une
+	*               tâche commence au premier jour ouvré de son calendrier
+	*               qui suit la fin de ses prédécesseurs, et finit après
+	*               duree jours ouvrés ; au plus tard, elle finit au dernier
+	*               jour ouvré avant le début de ses successeurs. Chaque
+	*               tâche coûte O(1) hors de ses arêtes grâce aux tables des
+	*               calendriers. Une tâche de durée nulle ne dépend pas du
+	*               calendrier. Les dates du graphe ne sont pas modifiées.
+	*/
+TypDatesCalendrier* calculDatesCalendrier(TypGraphePERT *graphePERT, TypCalendriers *calendriers) {
+	TypDatesCalendrier *dates;   /* Les dates calculées */
+	TypCalendrier      *calendrier;
+	TypVoisins         *liste;
+	TypVoisins         *vC;
+	int                nbSommets;
+	int                limite;   /* Fin des prédécesseurs, ou début des
+	                                successeurs */
+	int                rang;
+	int                duree;
+	int                k, s, v;
+
+	if (graphePERT->liensTypes) {
+		return NULL;
+	}
+
+	calculDates(graphePERT);
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+
+	dates = malloc(sizeof(TypDatesCalendrier));
+	dates->nbSommets = nbSommets;
+	dates->debutTot = malloc(nbSommets * sizeof(int));
+	dates->finTot = malloc(nbSommets * sizeof(int));
+	dates->debutTard = malloc(nbSommets * sizeof(int));
+	dates->finTard = malloc(nbSommets * sizeof(int));
+
+	/* Passe avant */
+	for (k = 0; k < nbSommets; k++) {
+		s = graphePERT->ordreTopo[k];
+		limite = 0;
+		liste = graphePERT->grapheInverse->listesAdjacences[s-1];
+		for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+			v = numeroVoisin(&vC) - 1;
+			limite = (dates->finTot[v] > limite) ? dates->finTot[v] : limite;
+		}
+
+		duree = graphePERT->duree[s-1];
+		if (duree > 0) {
+			calendrier = calendriers->calendriers[calendriers->calendrierSommet[s-1]];
+			rang = rangOuvre(calendrier,limite);
+			dates->debutTot[s-1] = jourOuvre(calendrier,rang);
+			dates->finTot[s-1] = jourOuvre(calendrier,rang + duree - 1) + 1;
+		}
+		else {
+			dates->debutTot[s-1] = limite;
+			dates->finTot[s-1] = limite;
+		}
+	}
+
+	/* Passe arrière, depuis la fin au plus tôt du chantier */
+	for (k = nbSommets - 1; k >= 0; k--) {
+		s = graphePERT->ordreTopo[k];
+		limite = dates->finTot[nbSommets-1];
+		liste = graphePERT->graphe->listesAdjacences[s-1];
+		for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+			v = numeroVoisin(&vC) - 1;
+			limite = (dates->debutTard[v] < limite) ? dates->debutTard[v] : limite;
+		}
+
+		duree = graphePERT->duree[s-1];
+		if (duree > 0) {
+			calendrier = calendriers->calendriers[calendriers->calendrierSommet[s-1]];
+			rang = rangOuvre(calendrier,limite) - 1;
+			dates->finTard[s-1] = jourOuvre(calendrier,rang) + 1;
+			dates->debutTard[s-1] = jourOuvre(calendrier,rang - duree + 1);
+		}
+		else {
+			dates->debutTard[s-1] = limite;
+			dates->finTard[s-1] = limite;
+		}
+	}
+
+	return dates;
+}
+
+
+	/*
+	* Fonction : deleteDatesCalendrier
+	*
+	* Paramètres : TypDatesCalendrier *dates, les dates à supprimer
+	*
+	* Description : Libère la mémoire occupée par les dates.
+	*/
+void deleteDatesCalendrier(TypDatesCalendrier *dates) {
+	free(dates->debutTot);
+	free(dates->finTot);
+	free(dates->debutTard);
+	free(dates->finTard);
+	free(dates);
+}
+
+
+	/*
+	* Fonction : jourVersDate
+	*
+	* Paramètres : TypCalendriers *calendriers, les calendriers du chantier
+	*              int jour, un jour depuis le jour 0
+	*              char *date, reçoit la date "AAAA-MM-JJ" (11 caractères)
+	*
+	* Description : Conversion d'un nombre de jours en date civile
+	*               (algorithme de H. Hinnant, sans boucle).
+	*/
+void jourVersDate(TypCalendriers *calendriers, int jour, char *date) {
+	int z, ere, jourEre, anEre, jourAn, m5, j, m, a;
+
+	z = calendriers->jourDebut + jour + 719468;
+	ere = ((z >= 0) ? z : z - 146096) / 146097;
+	jourEre = z - ere * 146097;
+	anEre = (jourEre - jourEre / 1460 + jourEre / 36524 - jourEre / 146096) / 365;
+	jourAn = jourEre - (365 * anEre + anEre / 4 - anEre / 100);
+	m5 = (5 * jourAn + 2) / 153;
+	j = jourAn - (153 * m5 + 2) / 5 + 1;
+	m = (m5 < 10) ? m5 + 3 : m5 - 9;
+	a = anEre + ere * 400 + (m <= 2);
+
+	sprintf(date,"%04d-%02d-%02d",a,m,j);
+}
+
+
+	/*
+	* Fonction : creerCalendrier
+	*
+	* Paramètres : const char *nom, le nom du calendrier
+	*              const char *semaine, sept caractères '0' ou '1', du lundi
+	*                  au dimanche
+	*
+	* Retour : TypCalendrier*, le calendrier créé (tables vides), ou NULL si
+	*              la semaine est invalide ou n'a aucun jour ouvré
+	*/
+static TypCalendrier* creerCalendrier(const char *nom, const char *semaine) {
+	TypCalendrier *calendrier;
+	int           nbOuvresSemaine;
+	int           i;
+
+	if (strlen(semaine) != 7 || strspn(semaine,"01") != 7) {
+		return NULL;
+	}
+	nbOuvresSemaine = 0;
+	for (i = 0; i < 7; i++) {
+		nbOuvresSemaine += (semaine[i] == '1');
+	}
+	if (nbOuvresSemaine == 0) {
+		return NULL;
+	}
+
+	calendrier = malloc(sizeof(TypCalendrier));
+	calendrier->nom = malloc(strlen(nom) + 1);
+	strcpy(calendrier->nom,nom);
+	for (i = 0; i < 7; i++) {
+		calendrier->semaine[i] = (semaine[i] == '1');
+	}
+	calendrier->jourSemaine0 = 0;
+	calendrier->nbFeries = 0;
+	calendrier->feries = NULL;
+	calendrier->nbJours = 0;
+	calendrier->cumul = calloc(1, sizeof(int));
+	calendrier->nbOuvres = 0;
+	calendrier->ouvres = NULL;
+
+	return calendrier;
+}
+
+
+	/*
+	* Fonction : deleteCalendrier
+	*
+	* Paramètres : TypCalendrier *calendrier, le calendrier à supprimer
+	*/
+static void deleteCalendrier(TypCalendrier *calendrier) {
+	free(calendrier->nom);
+	free(calendrier->feries);
+	free(calendrier->cumul);
+	free(calendrier->ouvres);
+	free(calendrier);
+}
+
+
+	/*
+	* Fonction : etendreCalendrier
+	*
+	* Paramètres : TypCalendrier *calendrier, un calendrier
+	*              int nbJours, le nombre de jours à couvrir
+	*
+	* Description : Prolonge les tables cumul et ouvres jusqu'à nbJours
+	*               jours. Seul endroit où les jours sont parcourus un à un.
+	*/
+static void etendreCalendrier(TypCalendrier *calendrier, int nbJours) {
+	int  *ferie;    /* Premier jour férié non encore dépassé */
+	bool ouvre;
+	int  j;
+
+	if (nbJours <= calendrier->nbJours) {
+		return;
+	}
+
+	calendrier->cumul = realloc(calendrier->cumul,(nbJours + 1) * sizeof(int));
+	calendrier->ouvres = realloc(calendrier->ouvres,nbJours * sizeof(int));
+
+	ferie = calendrier->feries;
+	while (ferie < calendrier->feries + calendrier->nbFeries && *ferie < calendrier->nbJours) {
+		ferie++;
+	}
+
+	for (j = calendrier->nbJours; j < nbJours; j++) {
+		while (ferie < calendrier->feries + calendrier->nbFeries && *ferie < j) {
+			ferie++;
+		}
+		ouvre = calendrier->semaine[(calendrier->jourSemaine0 + j) % 7]
+			&& !(ferie < calendrier->feries + calendrier->nbFeries && *ferie == j);
+
+		calendrier->cumul[j+1] = calendrier->cumul[j] + (ouvre ? 1 : 0);
+		if (ouvre) {
+			calendrier->ouvres[calendrier->cumul[j]] = j;
+		}
+	}
+
+	calendrier->nbJours = nbJours;
+	calendrier->nbOuvres = calendrier->cumul[nbJours];
+}
+
+
+	/*
+	* Fonction : chercherCalendrier
+	*
+	* Paramètres : TypCalendriers *calendriers, des calendriers
+	*              const char *nom, le nom d'un calendrier
+	*
+	* Retour : int, l'indice du calendrier, ou -1 s'il n'existe pas
+	*/
+static int chercherCalendrier(TypCalendriers *calendriers, const char *nom) {
+	int c;
+
+	for (c = 0; c < calendriers->nbCalendriers; c++) {
+		if (strcmp(calendriers->calendriers[c]->nom,nom) == 0) {
+			return c;
+		}
+	}
+
+	return -1;
+}
+
+
+	/*
+	* Fonction : lireDate
+	*
+	* Paramètres : const char *texte, une date "AAAA-MM-JJ"
+	*              int *jours, reçoit la date en jours depuis le 01/01/1970
+	*
+	* Retour : bool, false si la date est invalide
+	*/
+static bool lireDate(const char *texte, int *jours) {
+	static const int joursMois[12] = {31,29,31,30,31,30,31,31,30,31,30,31};
+	int a, m, j;
+
+	if (sscanf(texte,"%d-%d-%d",&a,&m,&j) != 3 || m < 1 || m > 12 || j < 1 || j > joursMois[m-1]
+			|| (m == 2 && j == 29 && !(a % 4 == 0 && (a % 100 != 0 || a % 400 == 0)))) {
+		return false;
+	}
+	*jours = joursDepuisEpoque(a,m,j);
+
+	return true;
+}
+
+
+	/*
+	* Fonction : joursDepuisEpoque
+	*
+	* Paramètres : int a, int m, int j, une date valide
+	*
+	* Retour : int, le nombre de jours depuis le 01/01/1970 (algorithme de
+	*              H. Hinnant)
+	*/
+static int joursDepuisEpoque(int a, int m, int j) {
+	int ere, anEre, jourAn, jourEre;
+
+	a -= (m <= 2);
+	ere = ((a >= 0) ? a : a - 399) / 400;
+	anEre = a - ere * 400;
+	jourAn = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + j - 1;
+	jourEre = anEre * 365 + anEre / 4 - anEre / 100 + jourAn;
+
+	return ere * 146097 + jourEre - 719468;
+}
+
+
+	/*
+	* Fonction : comparerJours
+	*
+	* Paramètres : const void *a, const void *b, pointeurs sur deux jours
+	*
+	* Retour : int, négatif, nul ou positif selon l'ordre des jours
+	*/
+static int comparerJours(const void *a, const void *b) {
+	return *(const int*) a - *(const int*) b;
+}
@@ -0,0 +1,69 @@
+#ifndef CALENDRIER_H
+#define CALENDRIER_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "pert.h"
+
+
+/*
+* Calendrier de travail : jours ouvrés de la semaine et jours fériés. Les
+* jours sont comptés depuis le début du chantier (jour 0). Les tables
+* cumul et ouvres convertissent en O(1) un jour en nombre de jours ouvrés
+* et inversement ; elles sont prolongées à la demande.
+*/
+typedef struct TypCalendrier {
+	char *nom;
+	bool semaine[7];     /* Jours ouvrés de la semaine, lundi d'abord */
+	int  jourSemaine0;   /* Jour de la semaine du jour 0 (0 : lundi) */
+	int  nbFeries;
+	int  *feries;        /* Jours fériés, triés (jours depuis le jour 0) */
+	int  nbJours;        /* Nombre de jours couverts par les tables */
+	int  *cumul;         /* cumul[j] : jours ouvrés dans [0, j[
+	                        (nbJours + 1 cases) */
+	int  nbOuvres;       /* Jours ouvrés couverts (cumul[nbJours]) */
+	int  *ouvres;        /* ouvres[k] : le k-ième jour ouvré */
+} TypCalendrier;
+
+/*
+* Calendriers d'un chantier et calendrier de chaque tâche. Le premier
+* calendrier déclaré est celui des tâches qui n'en précisent pas.
+*/
+typedef struct TypCalendriers {
+	int           jourDebut;        /* Date du jour 0, en jours depuis le
+	                                   01/01/1970 */
+	int           nbCalendriers;
+	TypCalendrier **calendriers;
+	int           nbSommets;
+	int           *calendrierSommet; /* Indice du calendrier de chaque
+	                                    sommet (sommet - 1) */
+} TypCalendriers;
+
+/*
+* Dates des tâches selon leur calendrier, en jours depuis le jour 0. Une
+* tâche occupe [debut, fin[ ; sa durée est comptée en jours ouvrés.
+*/
+typedef struct TypDatesCalendrier {
+	int nbSommets;
+	int *debutTot;
+	int *finTot;
+	int *debutTard;
+	int *finTard;
+} TypDatesCalendrier;
+
+
+TypCalendriers* lireCalendriers(FILE*,TypGraphePERT*);
+
+void deleteCalendriers(TypCalendriers*);
+
+int rangOuvre(TypCalendrier*,int);
+
+int jourOuvre(TypCalendrier*,int);
+
+TypDatesCalendrier* calculDatesCalendrier(TypGraphePERT*,TypCalendriers*);
+
+void deleteDatesCalendrier(TypDatesCalendrier*);
+
+void jourVersDate(TypCalendriers*,int,char*);
+
+#endif
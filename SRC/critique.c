@@ -0,0 +1,239 @@
+/*
+******************************************************************************
+*
+* Programme : critique.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Chemins critiques d'un graphe PERT. Le sous-graphe critique ne
+*          garde que les arêtes u -> v entre tâches sans marge telles que
+*          v commence exactement à l'écart imposé par la dépendance (à la
+*          fin de u pour une dépendance ordinaire). Tout chemin d'alpha à oméga
+*          dans ce sous-graphe est un chemin critique.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <limits.h>
+#include "libgraphe.h"
+#include "pert.h"
+#include "critique.h"
+
+
+static bool areteCritique(TypGraphePERT*,int,int,int);
+
+
+	/*
+	* Fonction : nombreCheminsCritiques
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*                  dont les dates ont été calculées
+	*
+	* Retour : unsigned long long, le nombre de chemins critiques
+	*              (ULLONG_MAX s'il dépasse cette valeur)
+	*
+	* Description : Compte les chemins critiques sans les énumérer : le
+	*               nombre de chemins critiques d'alpha à un sommet est la
+	*               somme de ceux de ses prédécesseurs critiques, calculée
+	*               dans l'ordre topologique.
+	*/
+unsigned long long nombreCheminsCritiques(TypGraphePERT *graphePERT) {
+	unsigned long long *nbChemins;  /* Nb de chemins critiques d'alpha à i */
+	unsigned long long resultat;    /* Nombre de chemins d'alpha à oméga */
+	TypVoisins         *liste;      /* Liste des successeurs d'un sommet */
+	TypVoisins         *vC;         /* Successeur courant */
+	int                nbSommets;   /* Le nombre de sommets du graphe */
+	int                k, s, v;
+
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	nbChemins = calloc(nbSommets, sizeof(unsigned long long));
+	nbChemins[nbSommets-2] = 1;
+
+	for (k = 0; k < nbSommets; k++) {
+		s = graphePERT->ordreTopo[k];
+		if (nbChemins[s-1] == 0) {
+			continue;
+		}
+
+		liste = graphePERT->graphe->listesAdjacences[s-1];
+		for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+			v = numeroVoisin(&vC);
+			if (areteCritique(graphePERT,s,v,poidsVoisin(&vC))) {
+				if (nbChemins[v-1] > ULLONG_MAX - nbChemins[s-1]) {
+					nbChemins[v-1] = ULLONG_MAX;
+				}
+				else {
+					nbChemins[v-1] += nbChemins[s-1];
+				}
+			}
+		}
+	}
+
+	resultat = nbChemins[nbSommets-1];
+	free(nbChemins);
+
+	return resultat;
+}
+
+
+	/*
+	* Fonction : creerCheminsCritiques
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*                  dont les dates ont été calculées
+	*              long limite, le nombre maximal de chemins à produire
+	*                  (< 0 : pas de limite)
+	*
+	* Retour : TypCheminsCritiques*, le parcours des chemins critiques
+	*
+	* Description : Construit le sous-graphe critique sous forme de
+	*               tableaux contigus et prépare son parcours.
+	*/
+TypCheminsCritiques* creerCheminsCritiques(TypGraphePERT *graphePERT, long limite) {
+	TypCheminsCritiques *chemins;   /* Le parcours créé */
+	TypVoisins          *liste;     /* Liste des successeurs d'un sommet */
+	TypVoisins          *vC;        /* Successeur courant */
+	int                 nbSommets;  /* Le nombre de sommets du graphe */
+	int                 nbAretes;   /* Nombre d'arêtes critiques */
+	int                 s;
+
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+
+	chemins = malloc(sizeof(TypCheminsCritiques));
+	chemins->nbSommets = nbSommets;
+	chemins->sommetDepart = nbSommets - 2;
+	chemins->sommetArrivee = nbSommets - 1;
+	chemins->debutSucc = malloc((nbSommets + 1) * sizeof(int));
+	chemins->pile = malloc(nbSommets * sizeof(int));
+	chemins->position = malloc(nbSommets * sizeof(int));
+	chemins->profondeur = 0;
+	chemins->limite = limite;
+	chemins->debut = true;
+
+	/* Comptage puis recopie des arêtes critiques */
+	nbAretes = 0;
+	for (s = 1; s <= nbSommets; s++) {
+		liste = graphePERT->graphe->listesAdjacences[s-1];
+		for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+			if (areteCritique(graphePERT,s,numeroVoisin(&vC),poidsVoisin(&vC))) {
+				nbAretes++;
+			}
+		}
+	}
+	chemins->succ = malloc((nbAretes > 0 ? nbAretes : 1) * sizeof(int));
+
+	nbAretes = 0;
+	for (s = 1; s <= nbSommets; s++) {
+		chemins->debutSucc[s-1] = nbAretes;
+		liste = graphePERT->graphe->listesAdjacences[s-1];
+		for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+			if (areteCritique(graphePERT,s,numeroVoisin(&vC),poidsVoisin(&vC))) {
+				chemins->succ[nbAretes++] = numeroVoisin(&vC) - 1;
+			}
+		}
+	}
+	chemins->debutSucc[nbSommets] = nbAretes;
+
+	return chemins;
+}
+
+
+	/*
+	* Fonction : cheminCritiqueSuivant
+	*
+	* Paramètres : TypCheminsCritiques *chemins, un parcours des chemins
+	*                  critiques
+	*              int *chemin, tableau d'au moins nbSommets cases qui reçoit
+	*                  les indices (dans graphePERT->taches) des tâches du
+	*                  chemin, sans alpha ni oméga
+	*
+	* Retour : int, le nombre de tâches du chemin, ou -1 s'il n'y a plus de
+	*             chemin (ou que la limite est atteinte)
+	*
+	* Description : Produit le chemin critique suivant par un parcours en
+	*               profondeur repris là où l'appel précédent l'avait laissé.
+	*/
+int cheminCritiqueSuivant(TypCheminsCritiques *chemins, int *chemin) {
+	int s;  /* Le sommet en haut de la pile */
+	int k;
+
+	if (chemins->limite == 0) {
+		return -1;
+	}
+
+	if (chemins->debut) {
+		chemins->debut = false;
+		chemins->pile[0] = chemins->sommetDepart;
+		chemins->position[0] = chemins->debutSucc[chemins->sommetDepart];
+		chemins->profondeur = 1;
+	}
+	else if (chemins->profondeur > 0) {
+		/* On repart de l'avant-dernier sommet du chemin précédent */
+		chemins->profondeur--;
+	}
+
+	while (chemins->profondeur > 0) {
+		s = chemins->pile[chemins->profondeur - 1];
+
+		if (s == chemins->sommetArrivee) {
+			for (k = 1; k < chemins->profondeur - 1; k++) {
+				chemin[k-1] = chemins->pile[k];
+			}
+			if (chemins->limite > 0) {
+				chemins->limite--;
+			}
+			return chemins->profondeur - 2;
+		}
+
+		if (chemins->position[chemins->profondeur - 1] < chemins->debutSucc[s+1]) {
+			s = chemins->succ[chemins->position[chemins->profondeur - 1]++];
+			chemins->pile[chemins->profondeur] = s;
+			chemins->position[chemins->profondeur] = chemins->debutSucc[s];
+			chemins->profondeur++;
+		}
+		else {
+			chemins->profondeur--;
+		}
+	}
+
+	return -1;
+}
+
+
+	/*
+	* Fonction : deleteCheminsCritiques
+	*
+	* Paramètres : TypCheminsCritiques *chemins, le parcours à supprimer
+	*
+	* Description : Libère la mémoire occupée par le parcours.
+	*/
+void deleteCheminsCritiques(TypCheminsCritiques *chemins) {
+	free(chemins->debutSucc);
+	free(chemins->succ);
+	free(chemins->pile);
+	free(chemins->position);
+	free(chemins);
+}
+
+
+	/*
+	* Fonction : areteCritique
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int depart, int arrivee, les sommets d'une arête
+	*              int ecart, le poids de l'arête (écart imposé entre les
+	*                  débuts des deux tâches)
+	*
+	* Retour : bool, true si les deux tâches sont sans marge et que la
+	*             tâche d'arrivée commence exactement à l'écart imposé
+	*/
+static bool areteCritique(TypGraphePERT *graphePERT, int depart, int arrivee, int ecart) {
+	return graphePERT->margeTotale[depart-1] == 0
+		&& graphePERT->margeTotale[arrivee-1] == 0
+		&& graphePERT->dateTot[depart-1] + ecart == graphePERT->dateTot[arrivee-1];
+}
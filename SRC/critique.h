@@ -0,0 +1,37 @@
+#ifndef CRITIQUE_H
+#define CRITIQUE_H
+
+#include <stdbool.h>
+#include "pert.h"
+
+
+/*
+* Sous-graphe critique d'un graphe PERT et parcours paresseux de ses
+* chemins d'alpha à oméga. Les sommets sont indicés à partir de 0.
+* Le parcours n'utilise qu'une pile de la longueur d'un chemin, quel que
+* soit le nombre de chemins critiques.
+*/
+typedef struct TypCheminsCritiques {
+	int  nbSommets;
+	int  sommetDepart;   /* Indice de la tâche alpha */
+	int  sommetArrivee;  /* Indice de la tâche oméga */
+	int  *debutSucc;     /* Successeurs critiques de i : succ[debutSucc[i]] */
+	int  *succ;          /*   à succ[debutSucc[i+1]-1] */
+	int  *pile;          /* Sommets du chemin en cours */
+	int  *position;      /* Prochain successeur à essayer pour chaque niveau */
+	int  profondeur;     /* Nombre de sommets dans la pile */
+	long limite;         /* Nombre de chemins restant à produire (< 0 :
+	                        pas de limite) */
+	bool debut;          /* true tant qu'aucun chemin n'a été produit */
+} TypCheminsCritiques;
+
+
+unsigned long long nombreCheminsCritiques(TypGraphePERT*);
+
+TypCheminsCritiques* creerCheminsCritiques(TypGraphePERT*,long);
+
+int cheminCritiqueSuivant(TypCheminsCritiques*,int*);
+
+void deleteCheminsCritiques(TypCheminsCritiques*);
+
+#endif
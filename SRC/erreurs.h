@@ -15,7 +15,9 @@ typedef enum TypError{
 	POIDS_INVALIDE = 10,
 	EST_DANS_LISTE = 11,
 	ARETE_EXISTANTE = 12,
-	ARETE_INEXISTANTE = 13
+	ARETE_INEXISTANTE = 13,
+	CIRCUIT = 14,
+	LIENS_TYPES = 15
 }TypError;
 
 
@@ -36,12 +36,37 @@
 	*               est allouée dans la fonction.
 	*/
 TypGraphe* creerGraphe(int nbrMaxSommets) {
+	return creerGrapheArene(nbrMaxSommets,NULL);
+}
+
+
+	/*
+	* Fonction : creerGrapheArene
+	*
+	* Paramètres : int nbrMaxSommets, le nombre maximal de sommets que pourra 
+	*                 contenir le graphe
+	*              TypArene* arene, l'arène où prendre le graphe et ses
+	*                 listes, ou NULL
+	*
+	* Retour : TypGraphe*, pointeur sur le graphe créé
+	*
+	* Description : Comme creerGraphe. Un graphe pris dans une arène est
+	*               libéré avec elle : deleteGraphe n'a rien à faire.
+	*/
+TypGraphe* creerGrapheArene(int nbrMaxSommets, TypArene* arene) {
 	int        i;      /* Permet le parcours du tableau de listes */
 	TypGraphe* graphe; /* Le graphe créé */
 	
-	graphe = malloc(sizeof(TypGraphe));
+	if (arene != NULL) {
+		graphe = allouerArene(arene,sizeof(TypGraphe));
+		graphe->listesAdjacences = allouerArene(arene,nbrMaxSommets * sizeof(TypVoisins*));
+	}
+	else {
+		graphe = malloc(sizeof(TypGraphe));
+		graphe->listesAdjacences = ( TypVoisins** ) malloc( nbrMaxSommets * sizeof( TypVoisins* ) );
+	}
 	graphe->nbrMaxSommets = nbrMaxSommets;
-	graphe->listesAdjacences = ( TypVoisins** ) malloc( nbrMaxSommets * sizeof( TypVoisins* ) );
+	graphe->arene = arene;
 		
 	for ( i = 0; i < nbrMaxSommets; i++) {
 		graphe->listesAdjacences[i] = NULL;
@@ -70,7 +95,7 @@ int insertionSommet ( TypGraphe *graphe, int idSommet ) {
 	
 	if( (idSommet > 0 ) && ( idSommet <= graphe->nbrMaxSommets ) ) {
 		if ( graphe->listesAdjacences[idSommet-1] == NULL ) {
-            graphe->listesAdjacences[idSommet-1] = creerListe();
+            graphe->listesAdjacences[idSommet-1] = creerListeArene(graphe->arene);
 			return 0;
         }
 		else
@@ -159,10 +184,10 @@ int suppressionSommet ( TypGraphe* graphe, int sommet ) {
 		return GRAPHE_INEXISTANT;
 	else {
 		if (sommetExistant(graphe,sommet) == 0) {
-			supprimerListe(&(graphe->listesAdjacences[sommet-1]));
+			supprimerListeArene(&(graphe->listesAdjacences[sommet-1]),graphe->arene);
 			for (i = 0; i < graphe->nbrMaxSommets; i++) {
 				if (graphe->listesAdjacences[i] != NULL)
-					supprimerVoisin(&(graphe->listesAdjacences[i]),sommet);
+					supprimerVoisinArene(&(graphe->listesAdjacences[i]),sommet,graphe->arene);
 			}
 			return 0;
 		}
@@ -193,7 +218,7 @@ int insertionAreteOriente ( TypGraphe* graphe, int depart, int arrivee, int poid
 		return ARETE_EXISTANTE;
 	else {
 		if (sommetExistant(graphe,depart) == 0 && sommetExistant(graphe,arrivee) == 0) {
-			ajouterVoisin(&(graphe->listesAdjacences[depart-1]),arrivee,poids);
+			ajouterVoisinArene(&(graphe->listesAdjacences[depart-1]),arrivee,poids,graphe->arene);
 			return 0;
 		}
 		else
@@ -223,8 +248,8 @@ int insertionAreteNonOriente ( TypGraphe* graphe, int depart, int arrivee, int p
 		return ARETE_EXISTANTE;
 	else {
 		if (sommetExistant(graphe,depart) == 0 && sommetExistant(graphe,arrivee) == 0) {
-			ajouterVoisin(&(graphe->listesAdjacences[depart-1]),arrivee,poids);
-			ajouterVoisin(&(graphe->listesAdjacences[arrivee-1]),depart,poids);
+			ajouterVoisinArene(&(graphe->listesAdjacences[depart-1]),arrivee,poids,graphe->arene);
+			ajouterVoisinArene(&(graphe->listesAdjacences[arrivee-1]),depart,poids,graphe->arene);
 			return 0;
 		}
 		else
@@ -252,7 +277,7 @@ int suppressionArete ( TypGraphe* graphe, int depart, int arrivee, char orientat
 		if (sommetExistant(graphe,depart) == 0 && sommetExistant(graphe,arrivee) == 0) {
 			if (orientation == 'o') {
 				if (areteExistante(graphe,depart,arrivee) == 0) {
-					supprimerVoisin(&(graphe->listesAdjacences[depart-1]),arrivee);
+					supprimerVoisinArene(&(graphe->listesAdjacences[depart-1]),arrivee,graphe->arene);
 					return 0;
 				}
 				else
@@ -260,8 +285,8 @@ int suppressionArete ( TypGraphe* graphe, int depart, int arrivee, char orientat
 			}
 			else {
 				if (areteExistante(graphe,depart,arrivee) == 0 && areteExistante(graphe,arrivee,depart) == 0) {
-					supprimerVoisin(&(graphe->listesAdjacences[depart-1]),arrivee);
-					supprimerVoisin(&(graphe->listesAdjacences[arrivee-1]),depart);
+					supprimerVoisinArene(&(graphe->listesAdjacences[depart-1]),arrivee,graphe->arene);
+					supprimerVoisinArene(&(graphe->listesAdjacences[arrivee-1]),depart,graphe->arene);
 					return 0;
 				}
 				else
@@ -354,14 +379,21 @@ void sauvegarde (TypGraphe* graphe,FILE *fichier){
 	* Retour : void
 	*
 	* Description : Supprime le graphe passé en paramètre. Toute la mémoire qui 
-	*               lui avait été allouée est libérée.
+	*               lui avait été allouée est libérée. Toutes les listes
+	*               disparaissant, chacune est libérée en un seul parcours
+	*               sans en retirer le sommet des autres listes. Un graphe
+	*               pris dans une arène est libéré avec elle.
 	*/
 void deleteGraphe ( TypGraphe* graphe ) {
 	int i;  /* Permet le parcours des sommets du graphe */
 	
-	/* Suppression de tous les sommets (donc de toutes les listes)*/
+	if (graphe->arene != NULL)
+		return;
+	
+	/* Suppression de toutes les listes */
 	for (i = 0; i < graphe->nbrMaxSommets; i++)
-		suppressionSommet(graphe,i+1);
+		if (graphe->listesAdjacences[i] != NULL)
+			supprimerListe(&(graphe->listesAdjacences[i]));
 		
 	/* Libération de la mémoire occupée par le tableau*/
 	free(graphe->listesAdjacences);
@@ -524,4 +556,29 @@ int poidsArete(TypGraphe* graphe, int depart, int arrivee) {
 	}
   
 	return -1;
-}
\ No newline at end of file
+}
+
+
+	/*
+	* Fonction : modifierPoidsArete
+	*
+	* Paramètres : TypGraphe *graphe, pointeur sur un graphe déjà créé.
+	*	       int depart, le sommet de départ de l'arête
+	*	       int arrivee, le sommet d'arrivée de l'arête
+	*	       int poids, le nouveau poids de l'arête
+	*
+	* Retour : int, renvoie 0 si le poids est modifié sinon renvoie un 
+	*             code d'erreur (voir erreurs.h)
+	*
+	* Description : Modifie le poids d'une arête orientée du graphe
+	*/
+int modifierPoidsArete(TypGraphe* graphe, int depart, int arrivee, int poids) {
+	int erreur;  /* Code renvoyé par areteExistante */
+	
+	erreur = areteExistante(graphe,depart,arrivee);
+	if (erreur != 0)
+		return erreur;
+	
+	modifierPoidsVoisin(&(graphe->listesAdjacences[depart-1]),arrivee,poids);
+	return 0;
+}
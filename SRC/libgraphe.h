@@ -9,10 +9,13 @@
 typedef struct TypGraphe{
 	int nbrMaxSommets; /*Le nombre maximun de sommets du graphe*/
 	struct TypVoisins** listesAdjacences; /*Listes d'ajacence*/
+	TypArene* arene; /*Arène des listes et du graphe, ou NULL*/
 } TypGraphe;
 
 TypGraphe* creerGraphe(int);
 
+TypGraphe* creerGrapheArene(int, TypArene*);
+
 int insertionSommet(TypGraphe *graphe, int idSommet );
 
 int suppressionSommet(TypGraphe*, int);
@@ -41,4 +44,6 @@ TypGraphe* grapheInverse(TypGraphe* graphe);
 
 int poidsArete(TypGraphe* graphe, int depart, int arrivee);
 
+int modifierPoidsArete(TypGraphe* graphe, int depart, int arrivee, int poids);
+
 #endif
@@ -19,6 +19,11 @@
 #include <stdbool.h>
 #include <string.h>
 #include "libliste.h"
+#include "arene.h"
+
+
+static TypVoisins* creerTypVoisins(int,int,TypVoisins**,TypVoisins**,TypArene*);
+static void libererTypVoisins(TypVoisins*,TypArene*);
 
 	
 	/*
@@ -30,6 +35,7 @@
 	*					liste le voisin créé
 	*              TypVoisins** vP, le voisin qui précédera dans
 	*					la liste le voisin créé
+	*              TypArene* arene, l'arène où prendre le voisin, ou NULL
 	*
 	* Retour : TypVoisins*, pointeur sur le voisin nouvellement créé
 	*
@@ -37,10 +43,13 @@
 	*               (numéro et poids) sont passées en paramètres,
 	*               et lie ce voisin aux deux voisins passés en paramètres
 	*/
-static TypVoisins* creerTypVoisins(int voisin, int poids, TypVoisins** vS, TypVoisins** vP) {
+static TypVoisins* creerTypVoisins(int voisin, int poids, TypVoisins** vS, TypVoisins** vP, TypArene* arene) {
 	TypVoisins *res;	/* Pointeur sur le voisin nouvellement créé */
 	
-	res = malloc(sizeof(TypVoisins));
+	if (arene != NULL)
+		res = allouerArene(arene,sizeof(TypVoisins));
+	else
+		res = malloc(sizeof(TypVoisins));
 	res->voisin = voisin;
 	res->poidsVoisin = poids;
 	res->voisinSuivant = *vS;
@@ -50,6 +59,22 @@ static TypVoisins* creerTypVoisins(int voisin, int poids, TypVoisins** vS, TypVo
 }
 
 
+	/*
+	* Fonction : libererTypVoisins
+	*
+	* Paramètres : TypVoisins* voisin, un voisin retiré de sa liste
+	*              TypArene* arene, l'arène d'où il vient, ou NULL
+	*
+	* Description : Libère le voisin, ou le rend à son arène
+	*/
+static void libererTypVoisins(TypVoisins* voisin, TypArene* arene) {
+	if (arene != NULL)
+		rendreArene(arene,voisin,sizeof(TypVoisins));
+	else
+		free(voisin);
+}
+
+
 	/*
 	* Fonction : creerListe
 	*
@@ -60,10 +85,26 @@ static TypVoisins* creerTypVoisins(int voisin, int poids, TypVoisins** vS, TypVo
 	*               La sentinelle y est insérée et a pour numéro et poids -1.
 	*/
 TypVoisins* creerListe() {
+	return creerListeArene(NULL);
+}
+
+
+	/*
+	* Fonction : creerListeArene
+	*
+	* Paramètre : TypArene* arene, l'arène où prendre les voisins de la
+	*				liste, ou NULL pour les allouer un par un
+	*
+	* Retour : TypVoisins*, pointeur sur le début de la liste nouvellement créée
+	*
+	* Description : Comme creerListe. Les voisins d'une liste prise dans une
+	*				arène doivent être ajoutés et supprimés avec la même arène.
+	*/
+TypVoisins* creerListeArene(TypArene* arene) {
 	TypVoisins *res;	/* Pointeur sur la liste créée */
 	
 	/* Création de la sentinelle*/
-	res = creerTypVoisins(-1,-1,&res,&res);
+	res = creerTypVoisins(-1,-1,&res,&res,arene);
 	res->voisinSuivant = res;
 	res->voisinPrecedent = res;
 	
@@ -80,14 +121,29 @@ TypVoisins* creerListe() {
 	*				et désalloue la mémoire de celle-ci.
 	*/
 void supprimerListe(TypVoisins** liste) {
+	supprimerListeArene(liste,NULL);
+}
+
+
+	/*
+	* Fonction : supprimerListeArene
+	*
+	* Paramètres : TypVoisins** liste, le début de la liste à supprimer
+	*              TypArene* arene, l'arène de la liste, ou NULL
+	*
+	* Description : Comme supprimerListe ; les voisins sont rendus à l'arène.
+	*/
+void supprimerListeArene(TypVoisins** liste, TypArene* arene) {
 	TypVoisins *vC;		/* Le voisin courant lors du parcours de la liste */
+	TypVoisins *vS;		/* Le voisin suivant */
 	
 	vC = voisinSuivant(liste);
 	while (vC != *liste) {
-		supprimerVoisin(liste,numeroVoisin(&vC));
-		vC = voisinSuivant(liste);
+		vS = voisinSuivant(&vC);
+		libererTypVoisins(vC,arene);
+		vC = vS;
 	}
-	free(*liste);
+	libererTypVoisins(*liste,arene);
 	*liste = NULL;
 }
 
@@ -104,13 +160,29 @@ void supprimerListe(TypVoisins** liste) {
 	*				en paramètre
 	*/
 void ajouterVoisin(TypVoisins** liste, int voisin, int poids) {
+	ajouterVoisinArene(liste,voisin,poids,NULL);
+}
+
+
+	/*
+	* Fonction : ajouterVoisinArene
+	*
+	* Paramètres : TypVoisins** liste, le début de la liste à laquelle on veut 
+	*					ajouter un nouveau voisin
+	*              int voisin, le numéro du nouveau voisin à insérer
+	*              int poids, le poids du nouveau voisin à insérer
+	*              TypArene* arene, l'arène de la liste, ou NULL
+	*
+	* Description : Comme ajouterVoisin, le voisin étant pris dans l'arène
+	*/
+void ajouterVoisinArene(TypVoisins** liste, int voisin, int poids, TypArene* arene) {
 	TypVoisins *vS;		/* Le voisin suivant le voisin nouvellement créé */
 	TypVoisins *vP;		/* Le voisin précédent le voisin nouvellement créé */
 	TypVoisins *vC;		/* Le nouveau voisin ajouté en fin de liste */
 	
 	vS = *liste;
 	vP = vS->voisinPrecedent;
-	vC = creerTypVoisins(voisin,poids,&vS,&vP);
+	vC = creerTypVoisins(voisin,poids,&vS,&vP,arene);
 	vP->voisinSuivant = vC;
 	vS->voisinPrecedent = vC;
 }
@@ -126,6 +198,20 @@ void ajouterVoisin(TypVoisins** liste, int voisin, int poids) {
 	*				en paramètre. Ne fait rien s'il ne s'y trouve pas.
 	*/
 void supprimerVoisin(TypVoisins** liste, int voisinASupprimer) {
+	supprimerVoisinArene(liste,voisinASupprimer,NULL);
+}
+
+
+	/*
+	* Fonction : supprimerVoisinArene
+	*
+	* Paramètres : TypVoisins** liste, pointeur sur le début d'une liste
+	*              int voisinASupprimer, le numéro du voisin à supprimer
+	*              TypArene* arene, l'arène de la liste, ou NULL
+	*
+	* Description : Comme supprimerVoisin, le voisin étant rendu à l'arène
+	*/
+void supprimerVoisinArene(TypVoisins** liste, int voisinASupprimer, TypArene* arene) {
 	if (voisinASupprimer != -1)
 	{
 		TypVoisins *vC;    /* Le voisin courant lors du parcours de la liste */
@@ -149,12 +235,36 @@ void supprimerVoisin(TypVoisins** liste, int voisinASupprimer) {
 			vS = voisinSuivant(&vC);
 			vP->voisinSuivant = vS;
 			vS->voisinPrecedent = vP;
-			free(vC);
+			libererTypVoisins(vC,arene);
 		}
 	}
 }
 
 
+	/*
+	* Fonction : modifierPoidsVoisin
+	*
+	* Paramètres : TypVoisins** liste, pointeur sur le début d'une liste
+	*              int voisin, le numéro du voisin à modifier
+	*              int poids, le nouveau poids du voisin
+	*
+	* Description : Modifie le poids du voisin demandé dans la liste passée 
+	*				en paramètre. Ne fait rien s'il ne s'y trouve pas.
+	*/
+void modifierPoidsVoisin(TypVoisins** liste, int voisin, int poids) {
+	TypVoisins *vC;    /* Le voisin courant lors du parcours de la liste */
+	
+	vC = voisinSuivant(liste);
+	while (vC != *liste) {
+		if (numeroVoisin(&vC) == voisin) {
+			vC->poidsVoisin = poids;
+			return;
+		}
+		vC = voisinSuivant(&vC);
+	}
+}
+
+
 	/*
 	* Fonction : numeroVoisin
 	*
@@ -2,6 +2,7 @@
 #define LIBLISTE_H
 
 #include <stdbool.h>
+#include "arene.h"
 
 typedef struct TypVoisins {
 	int voisin;
@@ -12,12 +13,22 @@ typedef struct TypVoisins {
 
 TypVoisins* creerListe();
 
+TypVoisins* creerListeArene(TypArene*);
+
 void supprimerListe(TypVoisins**);
 
+void supprimerListeArene(TypVoisins**,TypArene*);
+
 void ajouterVoisin(TypVoisins**,int,int);
 
+void ajouterVoisinArene(TypVoisins**,int,int,TypArene*);
+
 void supprimerVoisin(TypVoisins**,int);
 
+void supprimerVoisinArene(TypVoisins**,int,TypArene*);
+
+void modifierPoidsVoisin(TypVoisins**,int,int);
+
 int numeroVoisin(TypVoisins**);
 
 int poidsVoisin(TypVoisins**);
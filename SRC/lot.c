@@ -0,0 +1,549 @@
+/*
+******************************************************************************
+*
+* Programme : lot.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Traitement par lot, sans menu, d'une liste de fichiers de
+*          chantier. Les fichiers sont répartis entre plusieurs threads et
+*          les résultats sont écrits, dans l'ordre des fichiers, sous forme
+*          de lignes de valeurs séparées par des virgules.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "libgraphe.h"
+#include "pert.h"
+#include "ordonnancement.h"
+#include "critique.h"
+#include "cache.h"
+#include "niveaux.h"
+#include "erreurs.h"
+#include "lot.h"
+
+
+/* Version des résultats mis en cache : à augmenter quand les lignes
+   écrites par traiterFichier changent, pour que les fichiers d'un cache
+   persistant écrits par une version précédente ne soient plus trouvés */
+#define FORMAT_RESULTATS 2
+
+
+/*
+* État partagé par les threads d'un traitement par lot.
+*/
+typedef struct TypLot {
+	char            **fichiers;    /* Chemins des fichiers à traiter */
+	int             nbFichiers;
+	TypRequetesLot  *requetes;
+	FILE            *sortie;
+	char            **resultats;   /* Résultat de chaque fichier, en attente
+	                                  d'écriture (NULL tant qu'il manque) */
+	int             suivant;       /* Prochain fichier à traiter */
+	int             aEcrire;       /* Prochain fichier à écrire */
+	int             nbErreurs;     /* Fichiers qui n'ont pu être lus */
+	int             nbThreadsDates; /* Threads calculant les dates d'un
+	                                   même fichier */
+	pthread_mutex_t verrou;
+} TypLot;
+
+
+static void* travaillerLot(void*);
+static bool traiterFichier(const char*,TypRequetesLot*,int,FILE*);
+static uint64_t cleRequetes(TypGraphePERT*,TypRequetesLot*);
+static void ecrirePrefixe(const char*,const char*,FILE*);
+static int lireListeFichiers(const char*,char***,int*);
+static int lireOuvriers(const char*,int**);
+
+
+	/*
+	* Fonction : traiterLot
+	*
+	* Paramètres : char **fichiers, les chemins des fichiers de chantier
+	*              int nbFichiers, la taille du tableau fichiers
+	*              TypRequetesLot *requetes, les requêtes à exécuter
+	*              FILE *sortie, le flux où écrire les résultats
+	*
+	* Retour : int, le nombre de fichiers qui n'ont pu être lus
+	*
+	* Description : Exécute les requêtes sur chaque fichier. Chaque thread
+	*               prend le prochain fichier non traité et écrit son
+	*               résultat dans un tampon ; les tampons sont recopiés dans
+	*               la sortie dans l'ordre des fichiers, dès que possible.
+	*               S'il y a moins de fichiers que de threads, les threads
+	*               en trop sont partagés entre les fichiers pour le calcul
+	*               des dates (voir calculDatesParallele).
+	*               Format (une ligne par valeur) :
+	*               # fichier, dates, nom, date au plus tot, date au plus tard,
+	*               #   marge totale, marge libre, marge independante
+	*               # fichier, chemins, nombre de chemins critiques
+	*               # fichier, chemin, premier chemin critique (A B D ...)
+	*               # fichier, duree, nombre d'ouvriers, duree
+	*               # fichier, erreur, message
+	*/
+int traiterLot(char **fichiers, int nbFichiers, TypRequetesLot *requetes, FILE *sortie) {
+	TypLot    lot;       /* État partagé */
+	pthread_t *threads;  /* Les threads lancés */
+	int       nbThreads; /* Nombre de threads */
+	int       t;
+
+	nbThreads = requetes->nbThreads;
+	if (nbThreads <= 0) {
+		nbThreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	lot.nbThreadsDates = 1;
+	if (nbThreads > nbFichiers) {
+		if (nbFichiers > 0) {
+			lot.nbThreadsDates = nbThreads / nbFichiers;
+		}
+		nbThreads = nbFichiers;
+	}
+	if (nbThreads < 1) {
+		nbThreads = 1;
+	}
+
+	lot.fichiers = fichiers;
+	lot.nbFichiers = nbFichiers;
+	lot.requetes = requetes;
+	lot.sortie = sortie;
+	lot.resultats = calloc((nbFichiers > 0) ? nbFichiers : 1, sizeof(char*));
+	lot.suivant = 0;
+	lot.aEcrire = 0;
+	lot.nbErreurs = 0;
+	pthread_mutex_init(&lot.verrou,NULL);
+
+	threads = malloc(nbThreads * sizeof(pthread_t));
+	for (t = 1; t < nbThreads; t++) {
+		pthread_create(&threads[t],NULL,travaillerLot,&lot);
+	}
+	travaillerLot(&lot);
+	for (t = 1; t < nbThreads; t++) {
+		pthread_join(threads[t],NULL);
+	}
+
+	free(threads);
+	free(lot.resultats);
+	pthread_mutex_destroy(&lot.verrou);
+
+	return lot.nbErreurs;
+}
+
+
+	/*
+	* Fonction : executerLot
+	*
+	* Paramètres : int argc, char **argv, les arguments du programme
+	*
+	* Retour : int, le code de retour du programme (0 si tous les fichiers
+	*              ont été lus, 1 sinon, 2 si les arguments sont invalides)
+	*
+	* Description : Point d'entrée du mode par lot :
+	*               main [-d] [-c] [-o 1,2,5] [-j threads] [-l liste]
+	*                    [-t taille] [-r repertoire] fichiers...
+	*               -d : dates et marges ; -c : chemins critiques ;
+	*               -o : durée pour chaque nombre d'ouvriers donné ;
+	*               -j : nombre de threads ; -l : fichier contenant un
+	*               chemin de fichier de chantier par ligne ;
+	*               -t : cache de taille entrées en mémoire ;
+	*               -r : cache recopié dans un répertoire existant.
+	*               Sans -d, -c ni -o, toutes les requêtes sont exécutées
+	*               avec 1 ouvrier.
+	*/
+int executerLot(int argc, char **argv) {
+	TypRequetesLot requetes;     /* Les requêtes demandées */
+	char           **fichiers;   /* Les fichiers à traiter */
+	int            nbFichiers;
+	int            option;       /* Option lue par getopt */
+	int            tailleCache;  /* Nombre d'entrées du cache (0 : pas de cache) */
+	char           *repertoire;  /* Répertoire du cache, ou NULL */
+	int            nbErreurs;
+	int            i;
+
+	requetes.dates = false;
+	requetes.critique = false;
+	requetes.nbDurees = 0;
+	requetes.ouvriers = NULL;
+	requetes.nbThreads = 0;
+	requetes.cache = NULL;
+	tailleCache = 0;
+	repertoire = NULL;
+	fichiers = NULL;
+	nbFichiers = 0;
+
+	while ((option = getopt(argc,argv,"dco:j:l:t:r:")) != -1) {
+		switch (option) {
+			case 'd' :
+				requetes.dates = true;
+				break;
+			case 'c' :
+				requetes.critique = true;
+				break;
+			case 'o' :
+				free(requetes.ouvriers);
+				requetes.nbDurees = lireOuvriers(optarg,&requetes.ouvriers);
+				if (requetes.nbDurees == -1) {
+					fprintf(stderr,"Nombres d'ouvriers invalides : %s\n",optarg);
+					return 2;
+				}
+				break;
+			case 'j' :
+				requetes.nbThreads = atoi(optarg);
+				break;
+			case 'l' :
+				if (lireListeFichiers(optarg,&fichiers,&nbFichiers) != 0) {
+					fprintf(stderr,"Le fichier demandé n'existe pas : %s\n",optarg);
+					return 2;
+				}
+				break;
+			case 't' :
+				tailleCache = atoi(optarg);
+				break;
+			case 'r' :
+				repertoire = optarg;
+				break;
+			default :
+				fprintf(stderr,"Usage : %s [-d] [-c] [-o 1,2,5] [-j threads] [-l liste] "
+					"[-t taille] [-r repertoire] fichiers...\n",argv[0]);
+				return 2;
+		}
+	}
+
+	for (i = optind; i < argc; i++) {
+		fichiers = realloc(fichiers,(nbFichiers + 1) * sizeof(char*));
+		fichiers[nbFichiers] = malloc(strlen(argv[i]) + 1);
+		strcpy(fichiers[nbFichiers],argv[i]);
+		nbFichiers++;
+	}
+
+	if (! requetes.dates && ! requetes.critique && requetes.nbDurees == 0) {
+		requetes.dates = true;
+		requetes.critique = true;
+		lireOuvriers("1",&requetes.ouvriers);
+		requetes.nbDurees = 1;
+	}
+
+	if (tailleCache > 0 || repertoire != NULL) {
+		requetes.cache = creerCache((tailleCache > 0) ? tailleCache : 1024,repertoire);
+	}
+
+	nbErreurs = traiterLot(fichiers,nbFichiers,&requetes,stdout);
+
+	if (requetes.cache != NULL) {
+		deleteCache(requetes.cache);
+	}
+
+	for (i = 0; i < nbFichiers; i++) {
+		free(fichiers[i]);
+	}
+	free(fichiers);
+	free(requetes.ouvriers);
+
+	return (nbErreurs == 0) ? 0 : 1;
+}
+
+
+	/*
+	* Fonction : travaillerLot
+	*
+	* Paramètres : void *arg, pointeur sur le TypLot partagé
+	*
+	* Retour : void*, NULL
+	*
+	* Description : Traite des fichiers tant qu'il en reste, puis écrit
+	*               dans la sortie les résultats devenus consécutifs.
+	*/
+static void* travaillerLot(void *arg) {
+	TypLot *lot;      /* État partagé */
+	FILE   *tampon;   /* Flux en mémoire recevant le résultat d'un fichier */
+	char   *resultat; /* Contenu du tampon */
+	size_t taille;    /* Taille du tampon */
+	int    i;         /* Le fichier traité */
+	bool   lu;        /* false si le fichier n'a pu être lu */
+
+	lot = arg;
+
+	while (true) {
+		pthread_mutex_lock(&lot->verrou);
+		i = lot->suivant;
+		lot->suivant++;
+		pthread_mutex_unlock(&lot->verrou);
+
+		if (i >= lot->nbFichiers) {
+			break;
+		}
+
+		resultat = NULL;
+		taille = 0;
+		tampon = open_memstream(&resultat,&taille);
+		lu = traiterFichier(lot->fichiers[i],lot->requetes,lot->nbThreadsDates,tampon);
+		fclose(tampon);
+
+		pthread_mutex_lock(&lot->verrou);
+		lot->resultats[i] = resultat;
+		if (! lu) {
+			lot->nbErreurs++;
+		}
+		while (lot->aEcrire < lot->nbFichiers && lot->resultats[lot->aEcrire] != NULL) {
+			fputs(lot->resultats[lot->aEcrire],lot->sortie);
+			free(lot->resultats[lot->aEcrire]);
+			lot->resultats[lot->aEcrire] = NULL;
+			lot->aEcrire++;
+		}
+		pthread_mutex_unlock(&lot->verrou);
+	}
+
+	return NULL;
+}
+
+
+	/*
+	* Fonction : traiterFichier
+	*
+	* Paramètres : const char *chemin, le chemin d'un fichier de chantier
+	*              TypRequetesLot *requetes, les requêtes à exécuter
+	*              int nbThreadsDates, le nombre de threads calculant les
+	*                  dates
+	*              FILE *sortie, le flux où écrire les résultats
+	*
+	* Retour : bool, false si le fichier n'a pu être ouvert ou est invalide
+	*
+	* Description : Lit le fichier, calcule les dates puis écrit le résultat
+	*               de chaque requête. Avec un cache, le résultat est cherché
+	*               d'après le contenu lu, avant tout calcul ; il est écrit
+	*               sans le chemin, ajouté en tête des lignes à la sortie.
+	*/
+static bool traiterFichier(const char *chemin, TypRequetesLot *requetes, int nbThreadsDates, FILE *sortie) {
+	TypGraphePERT *graphePERT; /* Le graphe lu */
+	FILE          *fichier;
+	FILE          *tampon;     /* Flux en mémoire recevant le résultat */
+	char          *resultat;   /* Résultat sans le chemin */
+	size_t        taille;      /* Taille du résultat */
+	uint64_t      cle;         /* Clé du résultat dans le cache */
+
+	if ((fichier = fopen(chemin,"r")) == NULL) {
+		fprintf(sortie,"%s, erreur, fichier introuvable\n",chemin);
+		return false;
+	}
+	graphePERT = lireGraphePERT(fichier);
+	fclose(fichier);
+	if (graphePERT == NULL) {
+		fprintf(sortie,"%s, erreur, fichier invalide\n",chemin);
+		return false;
+	}
+
+	if (requetes->cache == NULL) {
+		calculDatesParallele(graphePERT,nbThreadsDates);
+		ecrireRequetes(graphePERT,chemin,requetes,sortie);
+	}
+	else {
+		cle = cleRequetes(graphePERT,requetes);
+		resultat = chercherCache(requetes->cache,cle);
+		if (resultat == NULL) {
+			calculDatesParallele(graphePERT,nbThreadsDates);
+			tampon = open_memstream(&resultat,&taille);
+			ecrireRequetes(graphePERT,"",requetes,tampon);
+			fclose(tampon);
+			ajouterCache(requetes->cache,cle,resultat);
+		}
+		ecrirePrefixe(chemin,resultat,sortie);
+		free(resultat);
+	}
+
+	deleteGraphePERT(graphePERT);
+
+	return true;
+}
+
+
+	/*
+	* Fonction : ecrireRequetes
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*                  dont les dates ont été calculées
+	*              const char *chemin, le nom écrit en tête de chaque ligne
+	*              TypRequetesLot *requetes, les requêtes à exécuter
+	*              FILE *sortie, le flux où écrire les résultats
+	*
+	* Description : Écrit le résultat de chaque requête au format décrit
+	*               dans traiterLot. Le graphe n'est pas modifié.
+	*/
+void ecrireRequetes(TypGraphePERT *graphePERT, const char *chemin, TypRequetesLot *requetes, FILE *sortie) {
+	TypEspaceOrdo       *espace;     /* Espace de travail des simulations */
+	TypCheminsCritiques *chemins;    /* Parcours des chemins critiques */
+	TypTache            **taches;
+	int                 *cheminCritique; /* Tâches du premier chemin critique */
+	int                 longueur;    /* Nombre de tâches de ce chemin */
+	int                 nbSommets;
+	int                 parallelisme; /* Parallélisme maximal du chantier */
+	int                 duree;
+	int                 i;
+
+	taches = graphePERT->taches;
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+
+	if (requetes->dates) {
+		for (i = 0; i < nbSommets - 2; i++) {
+			fprintf(sortie,"%s, dates, %s, %d, %d, %d, %d, %d\n",chemin,taches[i]->nom,
+				graphePERT->dateTot[i],graphePERT->dateTard[i],graphePERT->margeTotale[i],
+				graphePERT->margeLibre[i],graphePERT->margeIndependante[i]);
+		}
+	}
+
+	if (requetes->critique) {
+		fprintf(sortie,"%s, chemins, %llu\n",chemin,nombreCheminsCritiques(graphePERT));
+
+		cheminCritique = malloc(nbSommets * sizeof(int));
+		chemins = creerCheminsCritiques(graphePERT,1);
+		if ((longueur = cheminCritiqueSuivant(chemins,cheminCritique)) != -1) {
+			fprintf(sortie,"%s, chemin, ",chemin);
+			for (i = 0; i < longueur; i++) {
+				fprintf(sortie,(i == 0) ? "%s" : " %s",taches[cheminCritique[i]]->nom);
+			}
+			fprintf(sortie,"\n");
+		}
+		deleteCheminsCritiques(chemins);
+		free(cheminCritique);
+	}
+
+	/* Un seul espace de travail pour toutes les durées demandées ; au-delà
+	   du parallélisme maximal, pas de simulation (voir dureeTotale) */
+	if (requetes->nbDurees > 0) {
+		espace = creerEspaceOrdo(graphePERT);
+		parallelisme = parallelismeMaximal(graphePERT);
+		for (i = 0; i < requetes->nbDurees; i++) {
+			if (requetes->ouvriers[i] >= nbSommets || requetes->ouvriers[i] >= parallelisme) {
+				duree = graphePERT->dateTot[nbSommets-1];
+			}
+			else {
+				duree = simulerOrdo(espace,requetes->ouvriers[i]);
+			}
+			fprintf(sortie,"%s, duree, %d, %d\n",chemin,requetes->ouvriers[i],duree);
+		}
+		deleteEspaceOrdo(espace);
+	}
+}
+
+
+	/*
+	* Fonction : cleRequetes
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              TypRequetesLot *requetes, les requêtes à exécuter
+	*
+	* Retour : uint64_t, la clé du résultat des requêtes sur ce chantier
+	*             avec ce format de résultat
+	*/
+static uint64_t cleRequetes(TypGraphePERT *graphePERT, TypRequetesLot *requetes) {
+	uint64_t cle;
+	int      format;   /* Voir FORMAT_RESULTATS */
+
+	format = FORMAT_RESULTATS;
+	cle = empreinteGraphePERT(graphePERT);
+	cle = empreinteAjouter(cle,"lot",sizeof("lot"));
+	cle = empreinteAjouter(cle,&format,sizeof(format));
+	cle = empreinteAjouter(cle,&requetes->dates,sizeof(requetes->dates));
+	cle = empreinteAjouter(cle,&requetes->critique,sizeof(requetes->critique));
+	cle = empreinteAjouter(cle,&requetes->nbDurees,sizeof(requetes->nbDurees));
+	cle = empreinteAjouter(cle,requetes->ouvriers,requetes->nbDurees * sizeof(int));
+
+	return cle;
+}
+
+
+	/*
+	* Fonction : ecrirePrefixe
+	*
+	* Paramètres : const char *chemin, le chemin du fichier traité
+	*              const char *resultat, des lignes écrites sans chemin
+	*              FILE *sortie, le flux où les écrire
+	*
+	* Description : Écrit chaque ligne du résultat précédée du chemin.
+	*/
+static void ecrirePrefixe(const char *chemin, const char *resultat, FILE *sortie) {
+	const char *ligne;  /* Début de la ligne courante */
+	const char *fin;    /* Fin de la ligne courante */
+
+	for (ligne = resultat; *ligne != '\0'; ligne = fin) {
+		fin = strchr(ligne,'\n');
+		fin = (fin != NULL) ? fin + 1 : ligne + strlen(ligne);
+		fputs(chemin,sortie);
+		fwrite(ligne,1,fin - ligne,sortie);
+	}
+}
+
+
+	/*
+	* Fonction : lireListeFichiers
+	*
+	* Paramètres : const char *chemin, un fichier contenant un chemin par ligne
+	*              char ***fichiers, tableau auquel ajouter les chemins lus
+	*              int *nbFichiers, la taille de ce tableau
+	*
+	* Retour : int, 0 si le fichier a été lu, ERREUR_FICHIER sinon
+	*
+	* Description : Ajoute au tableau chaque ligne non vide du fichier.
+	*/
+static int lireListeFichiers(const char *chemin, char ***fichiers, int *nbFichiers) {
+	FILE *liste;
+	char ligne[4096];  /* Ligne lue dans le fichier */
+
+	if ((liste = fopen(chemin,"r")) == NULL) {
+		return ERREUR_FICHIER;
+	}
+
+	while (fgets(ligne,sizeof(ligne),liste) != NULL) {
+		ligne[strcspn(ligne,"\r\n")] = '\0';
+		if (ligne[0] == '\0') {
+			continue;
+		}
+		*fichiers = realloc(*fichiers,(*nbFichiers + 1) * sizeof(char*));
+		(*fichiers)[*nbFichiers] = malloc(strlen(ligne) + 1);
+		strcpy((*fichiers)[*nbFichiers],ligne);
+		(*nbFichiers)++;
+	}
+	fclose(liste);
+
+	return 0;
+}
+
+
+	/*
+	* Fonction : lireOuvriers
+	*
+	* Paramètres : const char *texte, une liste d'entiers séparés par des
+	*                  virgules (ex : "1,2,5")
+	*              int **ouvriers, reçoit le tableau des entiers lus
+	*
+	* Retour : int, le nombre d'entiers lus, ou -1 si l'un d'eux n'est pas
+	*              un entier >= 1
+	*/
+static int lireOuvriers(const char *texte, int **ouvriers) {
+	const char *c;     /* Position courante dans le texte */
+	char       *fin;   /* Fin de l'entier lu */
+	int        nb;
+
+	nb = 0;
+	*ouvriers = NULL;
+	c = texte;
+	while (*c != '\0') {
+		*ouvriers = realloc(*ouvriers,(nb + 1) * sizeof(int));
+		(*ouvriers)[nb] = (int) strtol(c,&fin,10);
+		if (fin == c || (*ouvriers)[nb] < 1 || (*fin != ',' && *fin != '\0')) {
+			free(*ouvriers);
+			*ouvriers = NULL;
+			return -1;
+		}
+		nb++;
+		c = (*fin == ',') ? fin + 1 : fin;
+	}
+
+	return nb;
+}
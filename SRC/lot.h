@@ -0,0 +1,29 @@
+#ifndef LOT_H
+#define LOT_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "pert.h"
+#include "cache.h"
+
+
+/*
+* Requêtes à exécuter sur chaque fichier d'un traitement par lot.
+*/
+typedef struct TypRequetesLot {
+	bool dates;        /* Dates et marges des tâches */
+	bool critique;     /* Nombre de chemins critiques et le premier d'entre eux */
+	int  nbDurees;     /* Taille du tableau ouvriers */
+	int  *ouvriers;    /* Nombres d'ouvriers pour lesquels donner la durée */
+	int  nbThreads;    /* Nombre de threads (<= 0 : un par processeur) */
+	TypCache *cache;   /* Cache des résultats, ou NULL */
+} TypRequetesLot;
+
+
+int traiterLot(char**,int,TypRequetesLot*,FILE*);
+
+void ecrireRequetes(TypGraphePERT*,const char*,TypRequetesLot*,FILE*);
+
+int executerLot(int,char**);
+
+#endif
@@ -1,8 +1,35 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "menu.h"
+#include "lot.h"
+#include "serveur.h"
+#include "binaire.h"
 
-int main() {
+int main(int argc, char *argv[]) {
+	/* main -s socket [threads] : mode serveur */
+	if (argc >= 3 && strcmp(argv[1],"-s") == 0) {
+		if (lancerServeur(argv[2],(argc >= 4) ? atoi(argv[3]) : 0) != 0) {
+			fprintf(stderr,"Impossible de créer la socket %s\n",argv[2]);
+			return 1;
+		}
+		return 0;
+	}
+	
+	/* main -b chantier.txt chantier.bin : compilation du chantier */
+	if (argc == 4 && strcmp(argv[1],"-b") == 0) {
+		if (compilerGraphePERT(argv[2],argv[3]) != 0) {
+			fprintf(stderr,"Impossible de compiler %s vers %s\n",argv[2],argv[3]);
+			return 1;
+		}
+		return 0;
+	}
+	
+	/* Avec d'autres arguments, les fichiers sont traités sans menu */
+	if (argc > 1) {
+		return executerLot(argc,argv);
+	}
+	
 	menu_principal();
 	
 	return 0;
@@ -20,6 +20,14 @@
 #include "libgraphe.h"
 #include "libliste.h"
 #include "pert.h"
+#include "ordonnancement.h"
+#include "montecarlo.h"
+#include "ressources.h"
+#include "acceleration.h"
+#include "nivellement.h"
+#include "calendrier.h"
+#include "programme.h"
+#include "separation.h"
 #include "erreurs.h"
 
 
@@ -35,6 +43,14 @@ static void sousMenuDatesTaches();
 static void sousMenuCheminsCritiques();
 static void sousMenuSaisieNbOuvriers();
 static void sousMenuDureeSelonOuvriers();
+static void sousMenuMonteCarlo();
+static void sousMenuDureeSelonRessources();
+static void sousMenuCourbeTempsCout();
+static void sousMenuNivellement();
+static void sousMenuOuvriersMinimum();
+static void sousMenuDatesCalendrier();
+static void sousMenuProgramme();
+static void sousMenuOrdonnancementOptimal();
 static void sousMenuChargerFichier();
 static void sousMenuQuitter();
 static void cleanBuffer(const char *chaine);
@@ -74,9 +90,16 @@ void menu_principal() {
 			sscanf(ligne,"%s",chemin);
 			if ((fichier = fopen(chemin,"r")) != NULL) {
 			    graphePERT = lireGraphePERT(fichier);
-			    calculDates(graphePERT);
 			    fclose(fichier);
-			    sous_menu();
+			    if (graphePERT != NULL) {
+			        calculDates(graphePERT);
+			        sous_menu();
+			    }
+			    else {
+			        printf("Le fichier demandé est invalide\n");
+			        pause();
+			        menu_principal();
+			    }
 			}
 			else {
 			    printf("Le fichier demandé n'existe pas\n");
@@ -119,6 +142,14 @@ static void sous_menu() {
 	printf("#	7 : Durée du chantier compte tenu du nb d'ouvriers   #\n");
 	printf("#	8 : Charger un autre fichier                         #\n");
 	printf("#	9 : Quitter                                          #\n");
+	printf("#	10 : Simulation de Monte Carlo des dates             #\n");
+	printf("#	11 : Durée du chantier selon les métiers             #\n");
+	printf("#	12 : Courbe temps-coût du chantier                   #\n");
+	printf("#	13 : Nivellement des ouvriers                        #\n");
+	printf("#	14 : Nombre d'ouvriers minimal pour un délai         #\n");
+	printf("#	15 : Dates selon les calendriers de travail          #\n");
+	printf("#	16 : Programme de sous-projets                       #\n");
+	printf("#	17 : Ordonnancement optimal selon le nb d'ouvriers   #\n");
 	printf("##############################################################\n");
 	
 	do {
@@ -126,7 +157,7 @@ static void sous_menu() {
 		fgets(ligne,3,stdin);
 		cleanBuffer(ligne);
 		compte = sscanf(ligne,"%d",&choix);
-	} while (compte != 1 || choix < 1 || choix > 10);
+	} while (compte != 1 || choix < 1 || choix > 17);
 	
 	switch (choix){
 		case 1 :
@@ -156,6 +187,30 @@ static void sous_menu() {
 		case 9 :
 			sousMenuQuitter();
 			break;
+		case 10 :
+			sousMenuMonteCarlo();
+			break;
+		case 11 :
+			sousMenuDureeSelonRessources();
+			break;
+		case 12 :
+			sousMenuCourbeTempsCout();
+			break;
+		case 13 :
+			sousMenuNivellement();
+			break;
+		case 14 :
+			sousMenuOuvriersMinimum();
+			break;
+		case 15 :
+			sousMenuDatesCalendrier();
+			break;
+		case 16 :
+			sousMenuProgramme();
+			break;
+		case 17 :
+			sousMenuOrdonnancementOptimal();
+			break;
 	}
 	
 	sous_menu();
@@ -277,15 +332,26 @@ static void sousMenuSaisieNbOuvriers() {
 	* Fonction : sousMenuDureeSelonOuvriers
 	*
 	* Description : Permet de demander l'affichage de la durée du chantier
-	*               compte tenu de la stratégie choisie
+	*               compte tenu de la stratégie choisie, ainsi que la durée
+	*               pour chaque nombre d'ouvriers de 1 à nbOuvriers
 	*/
 static void sousMenuDureeSelonOuvriers() {
 	int duree;
+	int *courbe;  /* Durée du chantier pour 1 à nbOuvriers ouvriers */
+	int k;
 	
 	if (nbOuvriers != -1) {
 	    printf("\n=== Durée du chantier compte tenu du nombre d'ouvriers ===\n\n");
 	    duree = dureeTotale(graphePERT,nbOuvriers);
 	    printf("Durée avec %d ouvriers : %d\n",nbOuvriers,duree);
+	    
+	    courbe = malloc(nbOuvriers * sizeof(int));
+	    courbeDureeTotale(graphePERT,nbOuvriers,0,courbe);
+	    printf("\n# nb ouvriers, durée\n");
+	    for (k = 1; k <= nbOuvriers; k++) {
+	        printf("%d, %d\n",k,courbe[k-1]);
+	    }
+	    free(courbe);
 	}
 	else {
 	    printf("Veuillez d'abord renseigner le nombre d'ouvriers\n");
@@ -296,6 +362,394 @@ static void sousMenuDureeSelonOuvriers() {
 }
 
 
+	/*
+	* Fonction : sousMenuMonteCarlo
+	*
+	* Description : Permet de demander une simulation de Monte Carlo des
+	*               dates du chantier (durées optimiste/probable/pessimiste)
+	*/
+static void sousMenuMonteCarlo() {
+	TypResultatMonteCarlo *resultat;  /* Résultat de la simulation */
+	char ligne[21];       /* Contient l'entrée au clavier de l'utilisateur */
+	int nbEchantillons;   /* Nombre de scénarios tirés */
+	int compte;           /* Permet de vérifier le retour de sscanf */
+	int i;
+	
+	printf("\n=== Simulation de Monte Carlo des dates ===\n\n");
+	
+	do {
+		printf("Nombre d'échantillons : ");
+		fgets(ligne,20,stdin);
+		cleanBuffer(ligne);
+		compte = sscanf(ligne,"%d",&nbEchantillons);
+	} while (compte != 1 || nbEchantillons < 1);
+	
+	resultat = simulerMonteCarlo(graphePERT,nbEchantillons,0,1);
+	
+	printf("Durée moyenne : %.2f (écart type %.2f)\n",resultat->moyenne,resultat->ecartType);
+	printf("P50 : %.2f  P80 : %.2f  P95 : %.2f\n",percentileMonteCarlo(resultat,50),
+		percentileMonteCarlo(resultat,80),percentileMonteCarlo(resultat,95));
+	printf("\n# nom, indice de criticité\n");
+	for (i = 0; i < resultat->nbSommets - 2; i++) {
+		printf("%s, %.3f\n",graphePERT->taches[i]->nom,resultat->indiceCritique[i]);
+	}
+	
+	deleteResultatMonteCarlo(resultat);
+	
+	if (nbOuvriers != -1) {
+		resultat = simulerMonteCarloOuvriers(graphePERT,nbOuvriers,REGLE_CRITIQUE,nbEchantillons,0,1);
+		printf("\nAvec %d ouvriers : moyenne %.2f, P50 : %.0f  P90 : %.0f  P95 : %.0f\n",
+			nbOuvriers,resultat->moyenne,percentileMonteCarlo(resultat,50),
+			percentileMonteCarlo(resultat,90),percentileMonteCarlo(resultat,95));
+		deleteResultatMonteCarlo(resultat);
+	}
+	
+	pause();
+}
+
+
+	/*
+	* Fonction : sousMenuDureeSelonRessources
+	*
+	* Description : Permet de demander la durée du chantier compte tenu des
+	*               ressources décrites dans un fichier de ressources
+	*/
+static void sousMenuDureeSelonRessources() {
+	TypRessources *ressources;  /* Ressources lues dans le fichier */
+	char chemin[201];  /* Nom du fichier de ressources */
+	char ligne[201];   /* Contient l'entrée au clavier de l'utilisateur */
+	FILE *fichier;     /* Fichier de ressources */
+	int duree;
+	
+	printf("\n=== Durée du chantier selon les métiers ===\n\n");
+	printf("Saisissez le nom du fichier de ressources : ");
+	fgets(ligne,200,stdin);
+	sscanf(ligne,"%s",chemin);
+	
+	if ((fichier = fopen(chemin,"r")) != NULL) {
+		ressources = lireRessources(fichier,graphePERT);
+		fclose(fichier);
+		
+		if (ressources == NULL) {
+			printf("Le fichier cite une tâche ou une ressource inconnue\n");
+		}
+		else {
+			duree = dureeTotaleRessources(graphePERT,ressources);
+			if (duree == -1) {
+				printf("Une tâche demande plus d'unités qu'il n'en existe\n");
+			}
+			else {
+				printf("Durée avec les ressources données : %d\n",duree);
+			}
+			deleteRessources(ressources);
+		}
+	}
+	else {
+		printf("Le fichier demandé n'existe pas\n");
+	}
+	
+	pause();
+}
+
+
+	/*
+	* Fonction : sousMenuCourbeTempsCout
+	*
+	* Description : Permet de demander la courbe temps-coût du chantier,
+	*               les possibilités d'accélération des tâches étant
+	*               décrites dans un fichier d'accélération
+	*/
+static void sousMenuCourbeTempsCout() {
+	TypAcceleration *acceleration;  /* Données lues dans le fichier */
+	TypCourbeCout   *courbe;
+	char chemin[201];  /* Nom du fichier d'accélération */
+	char ligne[201];   /* Contient l'entrée au clavier de l'utilisateur */
+	FILE *fichier;     /* Fichier d'accélération */
+	int i;
+	
+	printf("\n=== Courbe temps-coût du chantier ===\n\n");
+	printf("Saisissez le nom du fichier d'accélération : ");
+	fgets(ligne,200,stdin);
+	sscanf(ligne,"%s",chemin);
+	
+	if ((fichier = fopen(chemin,"r")) != NULL) {
+		acceleration = lireAcceleration(fichier,graphePERT);
+		fclose(fichier);
+		
+		if (acceleration == NULL) {
+			printf("Le fichier cite une tâche inconnue ou des valeurs incohérentes\n");
+		}
+		else {
+			courbe = courbeTempsCout(graphePERT,acceleration);
+			if (courbe == NULL) {
+				printf("La courbe temps-coût ne gère que les dépendances fin-début\n");
+			}
+			else {
+				printf("# durée, coût\n");
+				for (i = 0; i < courbe->nbPoints; i++) {
+					printf("%d, %.2f\n",courbe->duree[i],courbe->cout[i]);
+				}
+				deleteCourbeCout(courbe);
+			}
+			deleteAcceleration(acceleration);
+		}
+	}
+	else {
+		printf("Le fichier demandé n'existe pas\n");
+	}
+	
+	pause();
+}
+
+
+	/*
+	* Fonction : sousMenuNivellement
+	*
+	* Description : Affiche des dates de début qui lissent le nombre
+	*               d'ouvriers occupés chaque jour, sans retarder la fin du
+	*               chantier (un ouvrier par tâche)
+	*/
+static void sousMenuNivellement() {
+	TypRessources  *ressources;   /* Un ouvrier par tâche */
+	TypNivellement *nivellement;
+	int i;
+	
+	printf("\n=== Nivellement des ouvriers ===\n\n");
+	
+	ressources = creerRessourcesOuvriers(graphePERT,1);
+	nivellement = nivelerRessource(graphePERT,ressources,0,NIVELLEMENT_PIC);
+	
+	printf("Ouvriers nécessaires aux dates au plus tôt : %d\n",nivellement->picDepart);
+	printf("Ouvriers nécessaires après nivellement : %d\n",nivellement->pic);
+	printf("\n# nom, date de début\n");
+	for (i = 0; i < nivellement->nbSommets - 2; i++) {
+		printf("%s, %d\n",graphePERT->taches[i]->nom,nivellement->debut[i]);
+	}
+	
+	deleteNivellement(nivellement);
+	deleteRessources(ressources);
+	
+	pause();
+}
+
+
+	/*
+	* Fonction : sousMenuOuvriersMinimum
+	*
+	* Description : Permet de demander le plus petit nombre d'ouvriers qui
+	*               termine le chantier avant un délai saisi
+	*/
+static void sousMenuOuvriersMinimum() {
+	int delai;
+	int nb;
+	char ligne[11];
+	int compte;
+	
+	printf("\n=== Nombre d'ouvriers minimal pour un délai ===\n\n");
+	do {
+		printf("Délai (>= 0) : ");
+		fgets(ligne,10,stdin);
+		cleanBuffer(ligne);
+		compte = sscanf(ligne,"%d",&delai);
+	} while (compte != 1 || delai < 0);
+	
+	nb = ouvriersMinimum(graphePERT,delai,NULL);
+	if (nb == -1) {
+		printf("Le délai est plus court que le chemin critique (%d)\n",
+			graphePERT->dateTot[graphePERT->graphe->nbrMaxSommets - 1]);
+	}
+	else {
+		printf("Ouvriers nécessaires : %d\n",nb);
+	}
+	
+	pause();
+}
+
+
+	/*
+	* Fonction : sousMenuDatesCalendrier
+	*
+	* Description : Permet de demander les dates réelles des tâches, les
+	*               calendriers de travail étant décrits dans un fichier
+	*/
+static void sousMenuDatesCalendrier() {
+	TypCalendriers     *calendriers;  /* Calendriers lus dans le fichier */
+	TypDatesCalendrier *dates;
+	char chemin[201];  /* Nom du fichier de calendriers */
+	char ligne[201];   /* Contient l'entrée au clavier de l'utilisateur */
+	char debutTot[11], finTot[11], debutTard[11], finTard[11];
+	FILE *fichier;     /* Fichier de calendriers */
+	int i;
+	
+	printf("\n=== Dates selon les calendriers de travail ===\n\n");
+	printf("Saisissez le nom du fichier de calendriers : ");
+	fgets(ligne,200,stdin);
+	sscanf(ligne,"%s",chemin);
+	
+	if ((fichier = fopen(chemin,"r")) != NULL) {
+		calendriers = lireCalendriers(fichier,graphePERT);
+		fclose(fichier);
+		
+		if (calendriers == NULL) {
+			printf("Le fichier est invalide ou cite une tâche inconnue\n");
+		}
+		else {
+			dates = calculDatesCalendrier(graphePERT,calendriers);
+			if (dates == NULL) {
+				printf("Les calendriers ne gèrent que les dépendances fin-début\n");
+			}
+			else {
+				printf("# nom, début au plus tôt, fin au plus tôt, début au plus tard, fin au plus tard\n");
+				for (i = 0; i < dates->nbSommets - 2; i++) {
+					/* Les fins affichées sont le dernier jour de travail */
+					jourVersDate(calendriers,dates->debutTot[i],debutTot);
+					jourVersDate(calendriers,dates->finTot[i] - (graphePERT->duree[i] > 0),finTot);
+					jourVersDate(calendriers,dates->debutTard[i],debutTard);
+					jourVersDate(calendriers,dates->finTard[i] - (graphePERT->duree[i] > 0),finTard);
+					printf("%s, %s, %s, %s, %s\n",graphePERT->taches[i]->nom,debutTot,finTot,debutTard,finTard);
+				}
+				deleteDatesCalendrier(dates);
+			}
+			deleteCalendriers(calendriers);
+		}
+	}
+	else {
+		printf("Le fichier demandé n'existe pas\n");
+	}
+	
+	pause();
+}
+
+
+	/*
+	* Fonction : sousMenuProgramme
+	*
+	* Description : Permet de charger un programme de sous-projets, d'en
+	*               afficher le niveau le plus haut puis, à la demande, les
+	*               dates d'une tâche d'un sous-projet ; le programme peut
+	*               être mis à jour après modification de ses fichiers
+	*/
+static void sousMenuProgramme() {
+	TypProgramme  *programme;  /* Le programme chargé */
+	TypGraphePERT *resume;     /* Niveau le plus haut du programme */
+	char chemin[201];  /* Nom du fichier de programme */
+	char ligne[201];   /* Contient l'entrée au clavier de l'utilisateur */
+	char nom[201];     /* Nom qualifié d'une tâche */
+	int  debutTot, debutTard;
+	int  nbRecalculs;
+	int  i;
+	
+	printf("\n=== Programme de sous-projets ===\n\n");
+	printf("Saisissez le nom du fichier de programme : ");
+	fgets(ligne,200,stdin);
+	sscanf(ligne,"%s",chemin);
+	
+	if ((programme = chargerProgramme(chemin)) == NULL) {
+		printf("Le fichier demandé n'existe pas, est invalide ou cite un fichier invalide\n");
+		pause();
+		return;
+	}
+	
+	do {
+		resume = programme->graphePERT;
+		printf("\nDurée du programme : %d\n",programme->dateFin);
+		printf("# sous-projet, fichier, durée, début au plus tôt, début au plus tard\n");
+		for (i = 0; i < resume->graphe->nbrMaxSommets - 2; i++) {
+			printf("%s, %s, %d, %d, %d\n",resume->taches[i]->nom,resume->taches[i]->intitule,
+				resume->duree[i],resume->dateTot[i],resume->dateTard[i]);
+		}
+		
+		printf("\nTâche à détailler (ex : LOT1%cB), m pour mettre à jour, rien pour revenir : ",
+			SEPARATEUR_PROGRAMME);
+		fgets(ligne,200,stdin);
+		if (sscanf(ligne,"%s",nom) != 1) {
+			break;
+		}
+		if (strcmp(nom,"m") == 0) {
+			nbRecalculs = majProgramme(programme);
+			if (nbRecalculs == -1) {
+				printf("Un fichier manque ou est devenu invalide\n");
+			}
+			else {
+				printf("%d niveau(x) recalculé(s)\n",nbRecalculs);
+			}
+		}
+		else if (datesTacheProgramme(programme,nom,&debutTot,&debutTard) == 0) {
+			printf("%s : début au plus tôt %d, début au plus tard %d\n",nom,debutTot,debutTard);
+		}
+		else {
+			printf("Aucune tâche ne porte ce nom\n");
+		}
+	} while (true);
+	
+	deleteProgramme(programme);
+}
+
+
+	/*
+	* Fonction : sousMenuOrdonnancementOptimal
+	*
+	* Description : Cherche par séparation et évaluation un ordonnancement
+	*               de durée minimale avec nbOuvriers, dans la limite d'un
+	*               temps et d'un nombre de noeuds saisis, et affiche la
+	*               meilleure durée trouvée avec la borne inférieure prouvée
+	*/
+static void sousMenuOrdonnancementOptimal() {
+	TypResultatOptimal *resultat;
+	char   ligne[21];    /* Contient l'entrée au clavier de l'utilisateur */
+	double tempsMax;     /* Durée maximale de la recherche en secondes */
+	long   nbNoeudsMax;  /* Nombre maximal de noeuds explorés */
+	int    compte;       /* Permet de vérifier le retour de sscanf */
+	int    i;
+	
+	if (nbOuvriers == -1) {
+		printf("Veuillez d'abord renseigner le nombre d'ouvriers\n");
+		pause();
+		return;
+	}
+	if (graphePERT->liensTypes) {
+		printf("La recherche ne gère que les dépendances fin-début\n");
+		pause();
+		return;
+	}
+	
+	printf("\n=== Ordonnancement optimal avec %d ouvriers ===\n\n",nbOuvriers);
+	printf("Borne inférieure de la durée : %d\n",borneInferieureOrdo(graphePERT,nbOuvriers));
+	
+	do {
+		printf("Temps maximal en secondes (0 : pas de limite) : ");
+		fgets(ligne,20,stdin);
+		cleanBuffer(ligne);
+		compte = sscanf(ligne,"%lf",&tempsMax);
+	} while (compte != 1 || tempsMax < 0);
+	do {
+		printf("Nombre maximal de noeuds (0 : pas de limite) : ");
+		fgets(ligne,20,stdin);
+		cleanBuffer(ligne);
+		compte = sscanf(ligne,"%ld",&nbNoeudsMax);
+	} while (compte != 1 || nbNoeudsMax < 0);
+	
+	resultat = resoudreOptimal(graphePERT,nbOuvriers,0,tempsMax,nbNoeudsMax);
+	
+	printf("Meilleure durée trouvée : %d\n",resultat->duree);
+	if (resultat->optimal) {
+		printf("Cette durée est minimale\n");
+	}
+	else {
+		printf("Budget épuisé : la durée minimale est au moins %d\n",resultat->borneInf);
+	}
+	printf("Noeuds explorés : %ld\n",resultat->nbNoeuds);
+	printf("\n# nom, date de début\n");
+	for (i = 0; i < resultat->nbSommets - 2; i++) {
+		printf("%s, %d\n",graphePERT->taches[i]->nom,resultat->debut[i]);
+	}
+	
+	deleteResultatOptimal(resultat);
+	
+	pause();
+}
+
+
 	/*
 	* Fonction : sousMenuChargerFichier
 	*
@@ -323,9 +777,16 @@ static void sousMenuChargerFichier() {
 		fgets(ligne,200,stdin);
 		sscanf(ligne,"%s",chemin);
 		fichier = fopen(chemin,"r");
-		graphePERT = lireGraphePERT(fichier);
+		graphePERT = (fichier != NULL) ? lireGraphePERT(fichier) : NULL;
+		if (fichier != NULL) {
+			fclose(fichier);
+		}
+		if (graphePERT == NULL) {
+			printf("Le fichier demandé n'existe pas ou est invalide\n");
+			pause();
+			menu_principal();
+		}
 		calculDates(graphePERT);
-		fclose(fichier);
 	}
 }
 
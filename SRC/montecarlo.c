@@ -0,0 +1,618 @@
+/*
+******************************************************************************
+*
+* Programme : montecarlo.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Simulation de Monte Carlo des dates d'un chantier dont les
+*          durées sont données par trois valeurs (optimiste, probable,
+*          pessimiste). Chaque durée suit une loi triangulaire ; la passe
+*          avant, ou la simulation avec un nombre limité d'ouvriers, est
+*          rejouée pour chaque échantillon.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "libgraphe.h"
+#include "pert.h"
+#include "ordonnancement.h"
+#include "montecarlo.h"
+
+
+/* Nombre d'échantillons tirés avec un même flux aléatoire */
+#define TAILLE_BLOC 1024
+
+
+/*
+* Le chantier en structure de tableaux. Les sommets sont renumérotés dans
+* l'ordre topologique : la passe avant parcourt les tableaux dans l'ordre.
+*/
+typedef struct TypModeleMC {
+	int    nbSommets;
+	int    *sommet;       /* Indice dans taches du k-ième sommet */
+	double *dureeMin;     /* Durée optimiste */
+	double *dureeMode;    /* Durée la plus probable */
+	double *dureeMax;     /* Durée pessimiste */
+	int    *debutPred;    /* Prédécesseurs de k : pred[debutPred[k]] à */
+	int    *pred;         /*   pred[debutPred[k+1]-1] (numérotation topo) */
+	int    *lien;         /* Type et décalage de chaque dépendance, NULL si
+	                         le chantier n'a que des liens fin-début */
+} TypModeleMC;
+
+/*
+* Paramètres et zones de travail d'un thread.
+*/
+typedef struct TypTravailMC {
+	TypGraphePERT    *graphePERT;
+	TypModeleMC      *modele;
+	int              nbOuvriers;      /* <= 0 : nombre d'ouvriers illimité */
+	TypReglePriorite regle;
+	int              nbEchantillons;
+	int              premierBloc;     /* Blocs premierBloc, premierBloc + pas, ... */
+	int              pas;
+	uint64_t         graine;
+	double           *datesFin;       /* Partagé : une case par échantillon */
+	long             *nbCritique;     /* Propre au thread : une case par sommet
+	                                     (NULL si le nombre d'ouvriers est limité) */
+} TypTravailMC;
+
+
+static TypResultatMonteCarlo* lancerMonteCarlo(TypGraphePERT*,int,TypReglePriorite,int,int,uint64_t);
+static TypModeleMC* creerModeleMC(TypGraphePERT*);
+static void deleteModeleMC(TypModeleMC*);
+static void* travaillerMC(void*);
+static void* travaillerOuvriersMC(void*);
+static int comparerReels(const void*, const void*);
+static uint64_t rotation(uint64_t, int);
+static double ecartTire(int, double, double);
+
+
+	/*
+	* Fonction : initGenerateur
+	*
+	* Paramètres : TypGenerateur *generateur, le générateur à initialiser
+	*              uint64_t graine, la graine de la simulation
+	*              uint64_t flux, le numéro du flux
+	*
+	* Description : Initialise l'état du générateur avec splitmix64 à partir
+	*               de la graine et du numéro de flux. Deux flux différents
+	*               donnent des suites indépendantes.
+	*/
+void initGenerateur(TypGenerateur *generateur, uint64_t graine, uint64_t flux) {
+	uint64_t x;  /* État de splitmix64 */
+	uint64_t z;
+	int      i;
+
+	x = graine ^ (flux * 0xD1B54A32D192ED03ULL);
+	for (i = 0; i < 4; i++) {
+		x += 0x9E3779B97F4A7C15ULL;
+		z = x;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		generateur->etat[i] = z ^ (z >> 31);
+	}
+}
+
+
+	/*
+	* Fonction : tirageUniforme
+	*
+	* Paramètres : TypGenerateur *generateur, un générateur initialisé
+	*
+	* Retour : double, un réel uniforme dans [0,1[
+	*/
+double tirageUniforme(TypGenerateur *generateur) {
+	uint64_t *e = generateur->etat;
+	uint64_t resultat;
+	uint64_t t;
+
+	resultat = rotation(e[1] * 5, 7) * 9;
+	t = e[1] << 17;
+	e[2] ^= e[0];
+	e[3] ^= e[1];
+	e[1] ^= e[2];
+	e[0] ^= e[3];
+	e[2] ^= t;
+	e[3] = rotation(e[3], 45);
+
+	return (resultat >> 11) * (1.0 / 9007199254740992.0);
+}
+
+
+	/*
+	* Fonction : tirageTriangulaire
+	*
+	* Paramètres : TypGenerateur *generateur, un générateur initialisé
+	*              double min, double mode, double max, les paramètres de la
+	*                  loi (min <= mode <= max)
+	*
+	* Retour : double, une valeur tirée selon la loi triangulaire
+	*
+	* Description : Tirage par inversion de la fonction de répartition.
+	*/
+double tirageTriangulaire(TypGenerateur *generateur, double min, double mode, double max) {
+	double u;  /* Tirage uniforme */
+
+	if (max <= min) {
+		return mode;
+	}
+
+	u = tirageUniforme(generateur);
+	if (u * (max - min) < mode - min) {
+		return min + sqrt(u * (max - min) * (mode - min));
+	}
+	else {
+		return max - sqrt((1 - u) * (max - min) * (max - mode));
+	}
+}
+
+
+	/*
+	* Fonction : simulerMonteCarlo
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int nbEchantillons, le nombre de scénarios tirés
+	*              int nbThreads, le nombre de threads (<= 0 : un par
+	*                  processeur)
+	*              uint64_t graine, la graine de la simulation
+	*
+	* Retour : TypResultatMonteCarlo*, la distribution des dates de fin et
+	*              l'indice de criticité de chaque tâche (mémoire allouée
+	*              dans la fonction)
+	*
+	* Description : Pour chaque échantillon, tire la durée de chaque tâche
+	*               puis calcule les dates au plus tôt. Le chemin critique de
+	*               l'échantillon est retrouvé en remontant, depuis oméga, le
+	*               prédécesseur qui a fixé la date de chaque tâche.
+	*               Les échantillons sont regroupés en blocs ayant chacun
+	*               leur flux aléatoire ; les blocs sont répartis entre les
+	*               threads. À graine égale, le résultat ne dépend pas du
+	*               nombre de threads.
+	*/
+TypResultatMonteCarlo* simulerMonteCarlo(TypGraphePERT *graphePERT, int nbEchantillons,
+		int nbThreads, uint64_t graine) {
+	return lancerMonteCarlo(graphePERT,0,REGLE_CRITIQUE,nbEchantillons,nbThreads,graine);
+}
+
+
+	/*
+	* Fonction : simulerMonteCarloOuvriers
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*                  dont les dates ont été calculées
+	*              int nbOuvriers, le nombre d'ouvriers (>= 1)
+	*              TypReglePriorite regle, la règle d'affectation des tâches
+	*              int nbEchantillons, le nombre de scénarios tirés
+	*              int nbThreads, le nombre de threads (<= 0 : un par
+	*                  processeur)
+	*              uint64_t graine, la graine de la simulation
+	*
+	* Retour : TypResultatMonteCarlo*, la distribution de la durée totale
+	*              du chantier (indiceCritique vaut NULL)
+	*
+	* Description : Pour chaque échantillon, tire la durée de chaque tâche,
+	*               l'arrondit à l'unité puis simule le chantier avec
+	*               nbOuvriers ouvriers (voir simulerOrdo). Les priorités
+	*               sont calculées une fois, sur les durées probables.
+	*               Chaque thread réutilise un seul espace de travail.
+	*/
+TypResultatMonteCarlo* simulerMonteCarloOuvriers(TypGraphePERT *graphePERT, int nbOuvriers,
+		TypReglePriorite regle, int nbEchantillons, int nbThreads, uint64_t graine) {
+	return lancerMonteCarlo(graphePERT,nbOuvriers,regle,nbEchantillons,nbThreads,graine);
+}
+
+
+	/*
+	* Fonction : lancerMonteCarlo
+	*
+	* Paramètres : voir simulerMonteCarloOuvriers ; nbOuvriers <= 0
+	*                  signifie un nombre d'ouvriers illimité
+	*
+	* Retour : TypResultatMonteCarlo*, le résultat de la simulation
+	*
+	* Description : Répartit les blocs d'échantillons entre les threads,
+	*               puis calcule les statistiques des dates de fin.
+	*/
+static TypResultatMonteCarlo* lancerMonteCarlo(TypGraphePERT *graphePERT, int nbOuvriers,
+		TypReglePriorite regle, int nbEchantillons, int nbThreads, uint64_t graine) {
+	TypResultatMonteCarlo *resultat;  /* Le résultat renvoyé */
+	TypModeleMC           *modele;    /* Le chantier en tableaux */
+	TypTravailMC          *travaux;   /* Paramètres de chaque thread */
+	pthread_t             *threads;   /* Les threads lancés */
+	double                somme;      /* Somme des dates de fin */
+	double                sommeCarres; /* Somme des carrés des écarts */
+	int                   nbBlocs;    /* Nombre de blocs d'échantillons */
+	int                   n;          /* Le nombre de sommets */
+	int                   i, k, t;
+
+	if (nbThreads <= 0) {
+		nbThreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	nbBlocs = (nbEchantillons + TAILLE_BLOC - 1) / TAILLE_BLOC;
+	if (nbThreads > nbBlocs) {
+		nbThreads = nbBlocs;
+	}
+	if (nbThreads < 1) {
+		nbThreads = 1;
+	}
+
+	modele = creerModeleMC(graphePERT);
+	n = modele->nbSommets;
+
+	resultat = malloc(sizeof(TypResultatMonteCarlo));
+	resultat->nbEchantillons = nbEchantillons;
+	resultat->datesFin = malloc((nbEchantillons > 0 ? nbEchantillons : 1) * sizeof(double));
+	resultat->nbSommets = n;
+	resultat->indiceCritique = (nbOuvriers <= 0) ? calloc(n, sizeof(double)) : NULL;
+
+	travaux = malloc(nbThreads * sizeof(TypTravailMC));
+	threads = malloc(nbThreads * sizeof(pthread_t));
+	for (t = 0; t < nbThreads; t++) {
+		travaux[t].graphePERT = graphePERT;
+		travaux[t].modele = modele;
+		travaux[t].nbOuvriers = nbOuvriers;
+		travaux[t].regle = regle;
+		travaux[t].nbEchantillons = nbEchantillons;
+		travaux[t].premierBloc = t;
+		travaux[t].pas = nbThreads;
+		travaux[t].graine = graine;
+		travaux[t].datesFin = resultat->datesFin;
+		travaux[t].nbCritique = (nbOuvriers <= 0) ? calloc(n, sizeof(long)) : NULL;
+	}
+	for (t = 1; t < nbThreads; t++) {
+		pthread_create(&threads[t],NULL,
+			(nbOuvriers <= 0) ? travaillerMC : travaillerOuvriersMC,&travaux[t]);
+	}
+	if (nbOuvriers <= 0) {
+		travaillerMC(&travaux[0]);
+	}
+	else {
+		travaillerOuvriersMC(&travaux[0]);
+	}
+	for (t = 1; t < nbThreads; t++) {
+		pthread_join(threads[t],NULL);
+	}
+
+	/* Indices de criticité, ramenés aux indices des tâches */
+	if (resultat->indiceCritique != NULL) {
+		for (t = 0; t < nbThreads; t++) {
+			for (k = 0; k < n; k++) {
+				resultat->indiceCritique[modele->sommet[k]] += travaux[t].nbCritique[k];
+			}
+			free(travaux[t].nbCritique);
+		}
+		for (i = 0; i < n; i++) {
+			resultat->indiceCritique[i] /= (nbEchantillons > 0 ? nbEchantillons : 1);
+		}
+	}
+
+	/* Statistiques des dates de fin */
+	somme = 0;
+	for (i = 0; i < nbEchantillons; i++) {
+		somme += resultat->datesFin[i];
+	}
+	resultat->moyenne = (nbEchantillons > 0) ? somme / nbEchantillons : 0;
+	sommeCarres = 0;
+	for (i = 0; i < nbEchantillons; i++) {
+		sommeCarres += (resultat->datesFin[i] - resultat->moyenne)
+			* (resultat->datesFin[i] - resultat->moyenne);
+	}
+	resultat->ecartType = (nbEchantillons > 1) ? sqrt(sommeCarres / (nbEchantillons - 1)) : 0;
+	qsort(resultat->datesFin,nbEchantillons,sizeof(double),comparerReels);
+
+	free(travaux);
+	free(threads);
+	deleteModeleMC(modele);
+
+	return resultat;
+}
+
+
+	/*
+	* Fonction : percentileMonteCarlo
+	*
+	* Paramètres : TypResultatMonteCarlo *resultat, une simulation
+	*              double p, le percentile voulu (entre 0 et 100)
+	*
+	* Retour : double, la date de fin atteinte par p % des échantillons
+	*
+	* Description : Interpolation linéaire entre les deux échantillons
+	*               encadrant le rang p / 100 * (nbEchantillons - 1).
+	*/
+double percentileMonteCarlo(TypResultatMonteCarlo *resultat, double p) {
+	double rang;    /* Rang (réel) du percentile */
+	int    inf;     /* Rang entier inférieur */
+
+	if (resultat->nbEchantillons == 0) {
+		return 0;
+	}
+	if (p <= 0) {
+		return resultat->datesFin[0];
+	}
+	if (p >= 100) {
+		return resultat->datesFin[resultat->nbEchantillons - 1];
+	}
+
+	rang = p / 100 * (resultat->nbEchantillons - 1);
+	inf = (int) rang;
+	if (inf + 1 >= resultat->nbEchantillons) {
+		return resultat->datesFin[inf];
+	}
+
+	return resultat->datesFin[inf]
+		+ (rang - inf) * (resultat->datesFin[inf+1] - resultat->datesFin[inf]);
+}
+
+
+	/*
+	* Fonction : deleteResultatMonteCarlo
+	*
+	* Paramètres : TypResultatMonteCarlo *resultat, le résultat à supprimer
+	*
+	* Description : Libère la mémoire occupée par le résultat.
+	*/
+void deleteResultatMonteCarlo(TypResultatMonteCarlo *resultat) {
+	free(resultat->datesFin);
+	if (resultat->indiceCritique != NULL) {
+		free(resultat->indiceCritique);
+	}
+	free(resultat);
+}
+
+
+	/*
+	* Fonction : creerModeleMC
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*
+	* Retour : TypModeleMC*, le chantier en structure de tableaux
+	*
+	* Description : Recopie les trois durées de chaque tâche et les
+	*               prédécesseurs dans des tableaux contigus, les sommets
+	*               étant numérotés dans l'ordre topologique.
+	*/
+static TypModeleMC* creerModeleMC(TypGraphePERT *graphePERT) {
+	TypModeleMC *modele;    /* Le modèle créé */
+	TypVoisins  *liste;     /* Liste des prédécesseurs d'un sommet */
+	TypVoisins  *vC;        /* Prédécesseur courant */
+	int         n;          /* Le nombre de sommets */
+	int         nbAretes;   /* Nombre d'arêtes */
+	int         k, s;
+
+	n = graphePERT->graphe->nbrMaxSommets;
+
+	modele = malloc(sizeof(TypModeleMC));
+	modele->nbSommets = n;
+	modele->sommet = malloc(n * sizeof(int));
+	modele->dureeMin = malloc(n * sizeof(double));
+	modele->dureeMode = malloc(n * sizeof(double));
+	modele->dureeMax = malloc(n * sizeof(double));
+	modele->debutPred = malloc((n + 1) * sizeof(int));
+
+	nbAretes = 0;
+	for (s = 1; s <= n; s++) {
+		nbAretes += degreSommet(graphePERT->grapheInverse,s);
+	}
+	modele->pred = malloc((nbAretes > 0 ? nbAretes : 1) * sizeof(int));
+	modele->lien = NULL;
+	if (graphePERT->liensTypes) {
+		modele->lien = malloc((nbAretes > 0 ? nbAretes : 1) * sizeof(int));
+	}
+
+	nbAretes = 0;
+	for (k = 0; k < n; k++) {
+		s = graphePERT->ordreTopo[k];
+
+		modele->sommet[k] = s - 1;
+		modele->dureeMin[k] = graphePERT->dureeOptimiste[s-1];
+		modele->dureeMode[k] = graphePERT->duree[s-1];
+		modele->dureeMax[k] = graphePERT->dureePessimiste[s-1];
+		modele->debutPred[k] = nbAretes;
+
+		liste = graphePERT->grapheInverse->listesAdjacences[s-1];
+		for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+			if (modele->lien != NULL) {
+				modele->lien[nbAretes] = poidsVoisin(&vC);
+			}
+			modele->pred[nbAretes++] = graphePERT->rangTopo[numeroVoisin(&vC)-1];
+		}
+	}
+	modele->debutPred[n] = nbAretes;
+
+	return modele;
+}
+
+
+	/*
+	* Fonction : deleteModeleMC
+	*
+	* Paramètres : TypModeleMC *modele, le modèle à supprimer
+	*/
+static void deleteModeleMC(TypModeleMC *modele) {
+	free(modele->sommet);
+	free(modele->dureeMin);
+	free(modele->dureeMode);
+	free(modele->dureeMax);
+	free(modele->debutPred);
+	free(modele->pred);
+	free(modele->lien);
+	free(modele);
+}
+
+
+	/*
+	* Fonction : travaillerMC
+	*
+	* Paramètres : void *arg, pointeur sur un TypTravailMC
+	*
+	* Retour : void*, NULL
+	*
+	* Description : Traite les blocs d'échantillons attribués au thread.
+	*/
+static void* travaillerMC(void *arg) {
+	TypTravailMC  *travail;    /* Paramètres du thread */
+	TypModeleMC   *modele;     /* Le chantier */
+	TypGenerateur generateur;  /* Flux aléatoire du bloc courant */
+	double        *duree;      /* Durées tirées */
+	double        *fin;        /* Dates de fin au plus tôt */
+	int           *critique;   /* Prédécesseur fixant la date de chaque sommet */
+	int           n;           /* Le nombre de sommets */
+	int           bloc;        /* Le bloc courant */
+	int           e, k, j;
+	double        debut;       /* Date de début au plus tôt d'un sommet */
+	double        date;        /* Début imposé par un prédécesseur */
+	int           p;           /* Prédécesseur courant */
+
+	travail = arg;
+	modele = travail->modele;
+	n = modele->nbSommets;
+	duree = malloc(n * sizeof(double));
+	fin = malloc(n * sizeof(double));
+	critique = malloc(n * sizeof(int));
+
+	for (bloc = travail->premierBloc; bloc * TAILLE_BLOC < travail->nbEchantillons; bloc += travail->pas) {
+		initGenerateur(&generateur,travail->graine,(uint64_t) bloc);
+
+		for (e = bloc * TAILLE_BLOC; e < (bloc + 1) * TAILLE_BLOC && e < travail->nbEchantillons; e++) {
+			for (k = 0; k < n; k++) {
+				duree[k] = tirageTriangulaire(&generateur,modele->dureeMin[k],
+					modele->dureeMode[k],modele->dureeMax[k]);
+			}
+
+			/* Passe avant dans l'ordre topologique */
+			for (k = 0; k < n; k++) {
+				debut = 0;
+				critique[k] = -1;
+				for (j = modele->debutPred[k]; j < modele->debutPred[k+1]; j++) {
+					p = modele->pred[j];
+					if (modele->lien == NULL || modele->lien[j] == LIEN_SIMPLE) {
+						date = fin[p];
+					} else {
+						date = fin[p] - duree[p] + ecartTire(modele->lien[j],duree[p],duree[k]);
+					}
+					if (date > debut) {
+						debut = date;
+						critique[k] = p;
+					}
+				}
+				fin[k] = debut + duree[k];
+			}
+			travail->datesFin[e] = fin[n-1];
+
+			/* Remontée du chemin critique depuis oméga (dernier sommet) */
+			for (k = n - 1; k >= 0; k = critique[k]) {
+				travail->nbCritique[k]++;
+			}
+		}
+	}
+
+	free(duree);
+	free(fin);
+	free(critique);
+
+	return NULL;
+}
+
+
+	/*
+	* Fonction : travaillerOuvriersMC
+	*
+	* Paramètres : void *arg, pointeur sur un TypTravailMC
+	*
+	* Retour : void*, NULL
+	*
+	* Description : Traite les blocs d'échantillons attribués au thread
+	*               avec un nombre limité d'ouvriers. Les durées sont tirées
+	*               dans le même ordre que dans travaillerMC.
+	*/
+static void* travaillerOuvriersMC(void *arg) {
+	TypTravailMC  *travail;    /* Paramètres du thread */
+	TypModeleMC   *modele;     /* Le chantier */
+	TypEspaceOrdo *espace;     /* Espace de travail propre au thread */
+	TypGenerateur generateur;  /* Flux aléatoire du bloc courant */
+	int           bloc;        /* Le bloc courant */
+	int           e, k;
+
+	travail = arg;
+	modele = travail->modele;
+	espace = creerEspaceOrdo(travail->graphePERT);
+	reglerPriorites(espace,travail->graphePERT,travail->regle);
+
+	for (bloc = travail->premierBloc; bloc * TAILLE_BLOC < travail->nbEchantillons; bloc += travail->pas) {
+		initGenerateur(&generateur,travail->graine,(uint64_t) bloc);
+
+		for (e = bloc * TAILLE_BLOC; e < (bloc + 1) * TAILLE_BLOC && e < travail->nbEchantillons; e++) {
+			for (k = 0; k < modele->nbSommets; k++) {
+				espace->duree[modele->sommet[k]] = (int) lround(tirageTriangulaire(&generateur,
+					modele->dureeMin[k],modele->dureeMode[k],modele->dureeMax[k]));
+			}
+			travail->datesFin[e] = simulerOrdo(espace,travail->nbOuvriers);
+		}
+	}
+
+	deleteEspaceOrdo(espace);
+
+	return NULL;
+}
+
+
+	/*
+	* Fonction : comparerReels
+	*
+	* Paramètres : const void *a, const void *b, deux double
+	*
+	* Retour : int, fonction de comparaison de qsort
+	*/
+static int comparerReels(const void *a, const void *b) {
+	double x = *(const double*) a;
+	double y = *(const double*) b;
+
+	return (x > y) - (x < y);
+}
+
+
+	/*
+	* Fonction : rotation
+	*
+	* Paramètres : uint64_t x, int k
+	*
+	* Retour : uint64_t, x tourné de k bits vers la gauche
+	*/
+static uint64_t rotation(uint64_t x, int k) {
+	return (x << k) | (x >> (64 - k));
+}
+
+
+	/*
+	* Fonction : ecartTire
+	*
+	* Paramètres : int lien, le type et le décalage de la dépendance
+	*              double dureeAvant, durée tirée du prédécesseur
+	*              double dureeApres, durée tirée du successeur
+	*
+	* Retour : double, l'écart minimal entre les deux débuts
+	*
+	* Description : Version de ecartLien pour des durées réelles.
+	*/
+static double ecartTire(int lien, double dureeAvant, double dureeApres) {
+	switch (TYPE_LIEN(lien)) {
+		case LIEN_DEBUT_DEBUT :
+			return DECALAGE_LIEN(lien);
+		case LIEN_FIN_FIN :
+			return dureeAvant - dureeApres + DECALAGE_LIEN(lien);
+		case LIEN_DEBUT_FIN :
+			return DECALAGE_LIEN(lien) - dureeApres;
+		default :
+			return dureeAvant + DECALAGE_LIEN(lien);
+	}
+}
@@ -0,0 +1,47 @@
+#ifndef MONTECARLO_H
+#define MONTECARLO_H
+
+#include <stdint.h>
+#include "pert.h"
+#include "ordonnancement.h"
+
+
+/*
+* Générateur pseudo-aléatoire xoshiro256**. Chaque bloc d'échantillons a
+* son propre flux, ce qui rend les résultats indépendants du nombre de
+* threads.
+*/
+typedef struct TypGenerateur {
+	uint64_t etat[4];
+} TypGenerateur;
+
+/*
+* Résultat d'une simulation de Monte Carlo des dates du chantier.
+*/
+typedef struct TypResultatMonteCarlo {
+	int    nbEchantillons;
+	double *datesFin;        /* Date de fin de chaque échantillon, triées */
+	double moyenne;          /* Moyenne des dates de fin */
+	double ecartType;        /* Écart type des dates de fin */
+	int    nbSommets;
+	double *indiceCritique;  /* Proportion des échantillons où la tâche
+	                            (indice dans taches) est critique ; NULL
+	                            si le nombre d'ouvriers est limité */
+} TypResultatMonteCarlo;
+
+
+void initGenerateur(TypGenerateur*,uint64_t,uint64_t);
+
+double tirageUniforme(TypGenerateur*);
+
+double tirageTriangulaire(TypGenerateur*,double,double,double);
+
+TypResultatMonteCarlo* simulerMonteCarlo(TypGraphePERT*,int,int,uint64_t);
+
+TypResultatMonteCarlo* simulerMonteCarloOuvriers(TypGraphePERT*,int,TypReglePriorite,int,int,uint64_t);
+
+double percentileMonteCarlo(TypResultatMonteCarlo*,double);
+
+void deleteResultatMonteCarlo(TypResultatMonteCarlo*);
+
+#endif
@@ -0,0 +1,431 @@
+/*
+******************************************************************************
+*
+* Programme : niveaux.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Calcul des dates d'un grand chantier sur plusieurs threads. Les
+*          sommets sont regroupés par niveaux topologiques : les dates des
+*          sommets d'un même niveau ne dépendent que des niveaux
+*          précédents et sont calculées en parallèle, chaque thread
+*          prenant une tranche du niveau de même nombre d'arêtes. Les
+*          dates obtenues sont celles de calculDates.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "libgraphe.h"
+#include "pert.h"
+#include "erreurs.h"
+#include "niveaux.h"
+
+
+/*
+* Découpage de ordreTopo en segments. Un segment parallèle est un niveau
+* assez lourd pour être partagé entre les threads ; un segment série
+* regroupe des niveaux consécutifs trop légers, traités par le premier
+* thread. Les threads se synchronisent à la fin de chaque segment.
+*/
+typedef struct TypNiveaux {
+	TypGraphePERT     *graphePERT;
+	int               nbThreads;
+	int               nbSegments;
+	int               *debutSegment;     /* Segment i : positions debutSegment[i]
+	                                        à debutSegment[i+1]-1 de ordreTopo */
+	bool              *segmentParallele;
+	long              *poidsTot;         /* poidsTot[k] : somme des 1 + nombre de
+	                                        prédécesseurs des k premiers sommets
+	                                        de ordreTopo */
+	long              *poidsTard;        /* De même avec les successeurs */
+	pthread_barrier_t barriere;
+} TypNiveaux;
+
+/*
+* Paramètres d'un thread.
+*/
+typedef struct TypTravailNiveaux {
+	TypNiveaux *niveaux;
+	int        numero;   /* De 0 à nbThreads - 1 */
+} TypTravailNiveaux;
+
+
+static int decouperNiveaux(TypNiveaux*);
+static void ajouterSegment(TypNiveaux*,int,bool);
+static void* travaillerNiveaux(void*);
+static int borneTranche(const long*,int,int,int,int);
+static void datesAuPlusTot(TypGraphePERT*,int,int);
+static void datesAuPlusTard(TypGraphePERT*,int,int,int);
+
+
+	/*
+	* Fonction : calculDatesParallele
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int nbThreads, le nombre de threads (<= 0 : un par
+	*                  processeur)
+	*
+	* Description : Fait le travail de calculDates (ordre topologique,
+	*               dates au plus tôt puis au plus tard, marges) en
+	*               répartissant les deux passes entre les threads, niveau
+	*               par niveau. Aucun verrou n'est pris : chaque thread
+	*               n'écrit que les dates de sa tranche et ne lit que
+	*               celles des niveaux déjà terminés.
+	*               Un petit graphe, ou un graphe dont aucun niveau n'est
+	*               assez large, est traité par calculDates.
+	*/
+void calculDatesParallele(TypGraphePERT *graphePERT, int nbThreads) {
+	TypNiveaux        niveaux;   /* Découpage partagé par les threads */
+	TypTravailNiveaux *travaux;  /* Paramètres de chaque thread */
+	pthread_t         *threads;  /* Les threads lancés */
+	int               nbSommets; /* Le nombre de sommets du graphe */
+	int               nbParalleles; /* Nombre de segments parallèles */
+	int               i, t;
+
+	if (graphePERT->datesCalculees) {
+		return;
+	}
+
+	if (nbThreads <= 0) {
+		nbThreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	if (nbThreads < 2 || nbSommets < SEUIL_NIVEAUX) {
+		calculDates(graphePERT);
+		return;
+	}
+
+	niveaux.graphePERT = graphePERT;
+	niveaux.nbSegments = 0;
+	niveaux.debutSegment = malloc((nbSommets + 1) * sizeof(int));
+	niveaux.segmentParallele = malloc(nbSommets * sizeof(bool));
+	niveaux.poidsTot = malloc((nbSommets + 1) * sizeof(long));
+	niveaux.poidsTard = malloc((nbSommets + 1) * sizeof(long));
+
+	nbParalleles = 0;
+	if (decouperNiveaux(&niveaux) == 0) {
+		for (i = 0; i < niveaux.nbSegments; i++) {
+			if (niveaux.segmentParallele[i]) {
+				nbParalleles++;
+			}
+		}
+	}
+
+	if (nbParalleles == 0) {
+		free(niveaux.debutSegment);
+		free(niveaux.segmentParallele);
+		free(niveaux.poidsTot);
+		free(niveaux.poidsTard);
+		calculDates(graphePERT);
+		return;
+	}
+
+	niveaux.nbThreads = nbThreads;
+	pthread_barrier_init(&niveaux.barriere,NULL,nbThreads);
+	travaux = malloc(nbThreads * sizeof(TypTravailNiveaux));
+	threads = malloc(nbThreads * sizeof(pthread_t));
+	for (t = 0; t < nbThreads; t++) {
+		travaux[t].niveaux = &niveaux;
+		travaux[t].numero = t;
+	}
+	for (t = 1; t < nbThreads; t++) {
+		pthread_create(&threads[t],NULL,travaillerNiveaux,&travaux[t]);
+	}
+	travaillerNiveaux(&travaux[0]);
+	for (t = 1; t < nbThreads; t++) {
+		pthread_join(threads[t],NULL);
+	}
+
+	pthread_barrier_destroy(&niveaux.barriere);
+	free(threads);
+	free(travaux);
+	free(niveaux.debutSegment);
+	free(niveaux.segmentParallele);
+	free(niveaux.poidsTot);
+	free(niveaux.poidsTard);
+
+	calculMarges(graphePERT);
+	graphePERT->datesCalculees = true;
+}
+
+
+	/*
+	* Fonction : decouperNiveaux
+	*
+	* Paramètres : TypNiveaux *niveaux, le découpage à remplir
+	*
+	* Retour : int, 0 si tous les sommets sont ordonnés, CIRCUIT si le
+	*             graphe contient un circuit
+	*
+	* Description : Range les sommets dans ordreTopo et rangTopo par
+	*               l'algorithme de Kahn, comme calculDates, en traitant la
+	*               file niveau par niveau : les sommets ajoutés pendant le
+	*               traitement d'un niveau forment le niveau suivant. L'ordre
+	*               obtenu est donc le même. Les poids cumulés et les
+	*               segments sont calculés au passage.
+	*/
+static int decouperNiveaux(TypNiveaux *niveaux) {
+	TypGraphePERT *graphePERT;
+	TypVoisins    *liste;       /* Liste d'adjacence d'un sommet */
+	TypVoisins    *vC;          /* Voisin courant lors du parcours des listes */
+	int           *nbPred;      /* Prédécesseurs non encore ordonnés */
+	int           *degre;       /* Nombre de prédécesseurs de chaque sommet */
+	int           nbSommets;    /* Le nombre de sommets du graphe */
+	int           nbOrdonnes;   /* Nombre de sommets déjà ordonnés */
+	int           debutNiveau;  /* Position du premier sommet du niveau */
+	int           finNiveau;    /* Position qui suit son dernier sommet */
+	int           nbSucc;       /* Nombre de successeurs du sommet courant */
+	bool          enSerie;      /* true si le dernier segment est série */
+	int           s, k;
+
+	graphePERT = niveaux->graphePERT;
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	nbPred = malloc(nbSommets * sizeof(int));
+	degre = malloc(nbSommets * sizeof(int));
+	nbOrdonnes = 0;
+
+	for (s = 1; s <= nbSommets; s++) {
+		degre[s-1] = degreSommet(graphePERT->grapheInverse,s);
+		nbPred[s-1] = degre[s-1];
+		if (nbPred[s-1] == 0) {
+			graphePERT->ordreTopo[nbOrdonnes++] = s;
+		}
+	}
+
+	niveaux->poidsTot[0] = 0;
+	niveaux->poidsTard[0] = 0;
+	enSerie = false;
+	debutNiveau = 0;
+	while (debutNiveau < nbOrdonnes) {
+		finNiveau = nbOrdonnes;
+		for (k = debutNiveau; k < finNiveau; k++) {
+			s = graphePERT->ordreTopo[k];
+			graphePERT->rangTopo[s-1] = k;
+
+			nbSucc = 0;
+			liste = graphePERT->graphe->listesAdjacences[s-1];
+			for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+				nbSucc++;
+				nbPred[numeroVoisin(&vC)-1]--;
+				if (nbPred[numeroVoisin(&vC)-1] == 0) {
+					graphePERT->ordreTopo[nbOrdonnes++] = numeroVoisin(&vC);
+				}
+			}
+
+			niveaux->poidsTot[k+1] = niveaux->poidsTot[k] + 1 + degre[s-1];
+			niveaux->poidsTard[k+1] = niveaux->poidsTard[k] + 1 + nbSucc;
+		}
+
+		if (niveaux->poidsTot[finNiveau] - niveaux->poidsTot[debutNiveau] >= POIDS_MIN_NIVEAU) {
+			ajouterSegment(niveaux,debutNiveau,true);
+			enSerie = false;
+		}
+		else if (! enSerie) {
+			ajouterSegment(niveaux,debutNiveau,false);
+			enSerie = true;
+		}
+		debutNiveau = finNiveau;
+	}
+	niveaux->debutSegment[niveaux->nbSegments] = nbOrdonnes;
+
+	free(nbPred);
+	free(degre);
+
+	return (nbOrdonnes == nbSommets) ? 0 : CIRCUIT;
+}
+
+
+	/*
+	* Fonction : ajouterSegment
+	*
+	* Paramètres : TypNiveaux *niveaux, le découpage en cours
+	*              int debut, la position du premier sommet du segment
+	*              bool parallele, true pour un segment partagé entre les
+	*                  threads
+	*/
+static void ajouterSegment(TypNiveaux *niveaux, int debut, bool parallele) {
+	niveaux->debutSegment[niveaux->nbSegments] = debut;
+	niveaux->segmentParallele[niveaux->nbSegments] = parallele;
+	niveaux->nbSegments++;
+}
+
+
+	/*
+	* Fonction : travaillerNiveaux
+	*
+	* Paramètres : void *arg, pointeur sur le TypTravailNiveaux du thread
+	*
+	* Retour : void*, NULL
+	*
+	* Description : Calcule les dates au plus tôt segment par segment dans
+	*               l'ordre, puis les dates au plus tard dans l'ordre
+	*               inverse. Tous les threads attendent la fin de chaque
+	*               segment avant de passer au suivant.
+	*/
+static void* travaillerNiveaux(void *arg) {
+	TypTravailNiveaux *travail;
+	TypNiveaux        *niveaux;
+	TypGraphePERT     *graphePERT;
+	int               debut, fin;   /* Tranche traitée par le thread */
+	int               dateFin;      /* Date de fin du chantier */
+	int               i;
+
+	travail = arg;
+	niveaux = travail->niveaux;
+	graphePERT = niveaux->graphePERT;
+
+	for (i = 0; i < niveaux->nbSegments; i++) {
+		debut = niveaux->debutSegment[i];
+		fin = niveaux->debutSegment[i+1];
+		if (niveaux->segmentParallele[i]) {
+			datesAuPlusTot(graphePERT,
+				borneTranche(niveaux->poidsTot,debut,fin,travail->numero,niveaux->nbThreads),
+				borneTranche(niveaux->poidsTot,debut,fin,travail->numero + 1,niveaux->nbThreads));
+		}
+		else if (travail->numero == 0) {
+			datesAuPlusTot(graphePERT,debut,fin);
+		}
+		pthread_barrier_wait(&niveaux->barriere);
+	}
+
+	dateFin = graphePERT->dateTot[graphePERT->graphe->nbrMaxSommets - 1];
+
+	for (i = niveaux->nbSegments - 1; i >= 0; i--) {
+		debut = niveaux->debutSegment[i];
+		fin = niveaux->debutSegment[i+1];
+		if (niveaux->segmentParallele[i]) {
+			datesAuPlusTard(graphePERT,
+				borneTranche(niveaux->poidsTard,debut,fin,travail->numero,niveaux->nbThreads),
+				borneTranche(niveaux->poidsTard,debut,fin,travail->numero + 1,niveaux->nbThreads),
+				dateFin);
+		}
+		else if (travail->numero == 0) {
+			datesAuPlusTard(graphePERT,debut,fin,dateFin);
+		}
+		if (i > 0) {
+			pthread_barrier_wait(&niveaux->barriere);
+		}
+	}
+
+	return NULL;
+}
+
+
+	/*
+	* Fonction : borneTranche
+	*
+	* Paramètres : const long *poids, les poids cumulés des sommets
+	*              int debut, int fin, les positions du segment
+	*              int numero, un numéro de thread (de 0 à nbThreads)
+	*              int nbThreads, le nombre de threads
+	*
+	* Retour : int, la première position du segment où le poids cumulé
+	*             depuis debut atteint numero / nbThreads du poids total
+	*
+	* Description : La tranche du thread t va de borneTranche(t) à
+	*               borneTranche(t+1) - 1 : les tranches se suivent, sans
+	*               se recouvrir, et ont à peu près le même nombre
+	*               d'arêtes.
+	*/
+static int borneTranche(const long *poids, int debut, int fin, int numero, int nbThreads) {
+	long cible;  /* Poids cumulé à atteindre */
+	int  milieu;
+
+	cible = poids[debut] + (poids[fin] - poids[debut]) * numero / nbThreads;
+
+	while (debut < fin) {
+		milieu = debut + (fin - debut) / 2;
+		if (poids[milieu] < cible) {
+			debut = milieu + 1;
+		}
+		else {
+			fin = milieu;
+		}
+	}
+
+	return debut;
+}
+
+
+	/*
+	* Fonction : datesAuPlusTot
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int debut, int fin, des positions de ordreTopo
+	*
+	* Description : Calcule la date au plus tôt des sommets ordreTopo[debut]
+	*               à ordreTopo[fin-1], comme calculDates : plus grande
+	*               date d'un prédécesseur augmentée de l'écart qu'impose
+	*               la dépendance, 0 s'il n'en a pas.
+	*/
+static void datesAuPlusTot(TypGraphePERT *graphePERT, int debut, int fin) {
+	int        *dateTot;  /* Dates au plus tôt des sommets */
+	const int  *duree;    /* Durées des sommets */
+	TypVoisins *liste;    /* Liste des prédécesseurs du sommet */
+	TypVoisins *vC;       /* Prédécesseur courant */
+	int        date;      /* La date calculée */
+	int        ecart;     /* Écart imposé par la dépendance courante */
+	int        p;         /* Indice du prédécesseur courant */
+	int        s, k;
+
+	dateTot = graphePERT->dateTot;
+	duree = graphePERT->duree;
+
+	for (k = debut; k < fin; k++) {
+		s = graphePERT->ordreTopo[k];
+		liste = graphePERT->grapheInverse->listesAdjacences[s-1];
+		date = 0;
+		for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+			p = numeroVoisin(&vC) - 1;
+			ecart = (poidsVoisin(&vC) == LIEN_SIMPLE) ? duree[p]
+			        : ecartLien(poidsVoisin(&vC),duree[p],duree[s-1]);
+			if (dateTot[p] + ecart > date) {
+				date = dateTot[p] + ecart;
+			}
+		}
+		dateTot[s-1] = date;
+	}
+}
+
+
+	/*
+	* Fonction : datesAuPlusTard
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int debut, int fin, des positions de ordreTopo
+	*              int dateFin, la date de fin du chantier
+	*
+	* Description : Calcule la date au plus tard des sommets
+	*               ordreTopo[fin-1] à ordreTopo[debut], comme calculDates :
+	*               plus petite date au plus tard d'un successeur moins
+	*               l'écart qu'impose la dépendance, sans finir après
+	*               dateFin.
+	*/
+static void datesAuPlusTard(TypGraphePERT *graphePERT, int debut, int fin, int dateFin) {
+	int        *dateTard; /* Dates au plus tard des sommets */
+	TypVoisins *liste;    /* Liste des successeurs du sommet */
+	TypVoisins *vC;       /* Successeur courant */
+	int        date;      /* La date calculée */
+	int        s, k;
+
+	dateTard = graphePERT->dateTard;
+
+	for (k = fin - 1; k >= debut; k--) {
+		s = graphePERT->ordreTopo[k];
+		liste = graphePERT->graphe->listesAdjacences[s-1];
+		date = dateFin - graphePERT->duree[s-1];
+		for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+			if (dateTard[numeroVoisin(&vC)-1] - poidsVoisin(&vC) < date) {
+				date = dateTard[numeroVoisin(&vC)-1] - poidsVoisin(&vC);
+			}
+		}
+		dateTard[s-1] = date;
+	}
+}
@@ -0,0 +1,16 @@
+#ifndef NIVEAUX_H
+#define NIVEAUX_H
+
+#include "pert.h"
+
+
+/* En dessous de ce nombre de sommets, les dates sont calculées sans thread */
+#define SEUIL_NIVEAUX 65536
+
+/* Un niveau plus léger (sommets + arêtes) est traité par un seul thread */
+#define POIDS_MIN_NIVEAU 4096
+
+
+void calculDatesParallele(TypGraphePERT*,int);
+
+#endif
@@ -0,0 +1,423 @@
+/*
+******************************************************************************
+*
+* Programme : nivellement.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Nivellement d'une ressource : les tâches non critiques sont
+*          décalées dans leur marge pour lisser l'occupation jour par jour,
+*          sans changer la date de fin du chantier.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include "libgraphe.h"
+#include "pert.h"
+#include "ressources.h"
+#include "nivellement.h"
+
+
+/*
+* Occupation de la ressource jour par jour, dans un arbre de segments :
+* ajout sur un intervalle de jours, maximum et somme sur un intervalle,
+* chacun en O(log T). Le noeud 1 couvre [0, T-1], le noeud k a pour fils
+* 2k et 2k + 1.
+*/
+typedef struct TypArbreCharge {
+	int       nbJours;
+	int       *max;       /* Occupation maximale sur l'intervalle du noeud */
+	long long *somme;     /* Occupation totale sur l'intervalle du noeud */
+	int       *ajout;     /* Ajout en attente pour les fils du noeud */
+} TypArbreCharge;
+
+
+static TypArbreCharge* creerArbreCharge(int);
+static void deleteArbreCharge(TypArbreCharge*);
+static void ajouterCharge(TypArbreCharge*,int,int,int,int,int,int);
+static void descendreAjout(TypArbreCharge*,int,int,int);
+static void lireCharge(TypArbreCharge*,int,int,int,int,int,int,int*,long long*);
+static void mesurerOccupation(TypGraphePERT*,TypRessources*,int,int*,int,int*,long long*);
+static void evaluerPosition(TypArbreCharge*,int,int,int,int*,long long*);
+static bool meilleurePosition(int,long long,int,long long,TypCritereNivellement);
+
+
+	/*
+	* Fonction : nivelerRessource
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              TypRessources *ressources, les ressources du chantier
+	*              int type, le type de ressource à niveler
+	*              TypCritereNivellement critere, ce qu'il faut réduire
+	*
+	* Retour : TypNivellement*, les dates de début retenues
+	*
+	* Description : Part des dates au plus tôt. À chaque passe, chaque
+	*               tâche est retirée de l'occupation puis replacée au
+	*               meilleur début compatible avec la position actuelle de
+	*               ses prédécesseurs et successeurs (oméga restant à la
+	*               date de fin). Chaque début possible est évalué en
+	*               O(log T) sur l'arbre de segments. Une tâche ne bouge que
+	*               si le critère s'améliore strictement ; les passes
+	*               alternent l'ordre topologique inverse et l'ordre
+	*               topologique, et s'arrêtent dès qu'aucune tâche ne bouge
+	*               (au plus NB_PASSES_NIVELLEMENT passes).
+	*/
+TypNivellement* nivelerRessource(TypGraphePERT *graphePERT, TypRessources *ressources,
+		int type, TypCritereNivellement critere) {
+	TypNivellement *nivellement;   /* Le résultat */
+	TypArbreCharge *arbre;         /* Occupation de la ressource */
+	TypVoisins     *liste;
+	TypVoisins     *vC;
+	int            *debut;         /* Début courant de chaque sommet */
+	int            nbSommets;
+	int            dateFin;
+	int            passe;
+	bool           deplacement;    /* true si une tâche a bougé pendant
+	                                  la passe */
+	int            k, s, i;
+	int            besoin, duree;
+	int            debutMin;       /* Début le plus tôt permis par les
+	                                  prédécesseurs */
+	int            debutMax;       /* Début le plus tard permis par les
+	                                  successeurs */
+	int            ecart;          /* Écart imposé par une dépendance */
+	int            d;              /* Début essayé */
+	int            pic, picMeilleur;
+	long long      carres, carresMeilleur;  /* Hausse de la somme des
+	                                           carrés due à la tâche */
+	int            debutMeilleur;
+
+	calculDates(graphePERT);
+
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	dateFin = graphePERT->dateTot[nbSommets-1];
+
+	nivellement = malloc(sizeof(TypNivellement));
+	nivellement->nbSommets = nbSommets;
+	nivellement->dateFin = dateFin;
+	nivellement->debut = malloc(nbSommets * sizeof(int));
+	debut = nivellement->debut;
+	for (i = 0; i < nbSommets; i++) {
+		debut[i] = graphePERT->dateTot[i];
+	}
+	mesurerOccupation(graphePERT,ressources,type,debut,dateFin,
+		&nivellement->picDepart,&nivellement->carresDepart);
+
+	if (dateFin == 0) {
+		nivellement->pic = nivellement->picDepart;
+		nivellement->carres = nivellement->carresDepart;
+		return nivellement;
+	}
+
+	arbre = creerArbreCharge(dateFin);
+	for (i = 0; i < nbSommets; i++) {
+		besoin = ressources->besoin[i * ressources->nbTypes + type];
+		if (besoin > 0 && graphePERT->duree[i] > 0) {
+			ajouterCharge(arbre,1,0,dateFin - 1,debut[i],debut[i] + graphePERT->duree[i] - 1,besoin);
+		}
+	}
+
+	deplacement = true;
+	for (passe = 0; passe < NB_PASSES_NIVELLEMENT && deplacement; passe++) {
+		deplacement = false;
+
+		for (k = 0; k < nbSommets; k++) {
+			s = (passe % 2 == 0) ? graphePERT->ordreTopo[nbSommets-1-k] : graphePERT->ordreTopo[k];
+			i = s - 1;
+			besoin = ressources->besoin[i * ressources->nbTypes + type];
+			duree = graphePERT->duree[i];
+			if (besoin == 0 || duree == 0 || s >= nbSommets - 1) {
+				continue;
+			}
+
+			/* Fenêtre laissée par les voisins à leur position actuelle,
+			   selon l'écart imposé par chaque dépendance */
+			debutMin = 0;
+			liste = graphePERT->grapheInverse->listesAdjacences[i];
+			for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+				ecart = (poidsVoisin(&vC) == LIEN_SIMPLE) ? graphePERT->duree[numeroVoisin(&vC)-1]
+				        : ecartLien(poidsVoisin(&vC),graphePERT->duree[numeroVoisin(&vC)-1],duree);
+				if (debut[numeroVoisin(&vC)-1] + ecart > debutMin) {
+					debutMin = debut[numeroVoisin(&vC)-1] + ecart;
+				}
+			}
+			debutMax = dateFin - duree;
+			liste = graphePERT->graphe->listesAdjacences[i];
+			for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+				if (debut[numeroVoisin(&vC)-1] - poidsVoisin(&vC) < debutMax) {
+					debutMax = debut[numeroVoisin(&vC)-1] - poidsVoisin(&vC);
+				}
+			}
+			if (debutMax <= debutMin) {
+				continue;
+			}
+
+			ajouterCharge(arbre,1,0,dateFin - 1,debut[i],debut[i] + duree - 1,-besoin);
+
+			/* La position actuelle est gardée en cas d'égalité */
+			debutMeilleur = debut[i];
+			evaluerPosition(arbre,debutMeilleur,duree,besoin,&picMeilleur,&carresMeilleur);
+			for (d = debutMin; d <= debutMax; d++) {
+				evaluerPosition(arbre,d,duree,besoin,&pic,&carres);
+				if (meilleurePosition(pic,carres,picMeilleur,carresMeilleur,critere)) {
+					picMeilleur = pic;
+					carresMeilleur = carres;
+					debutMeilleur = d;
+				}
+			}
+
+			if (debutMeilleur != debut[i]) {
+				debut[i] = debutMeilleur;
+				deplacement = true;
+			}
+			ajouterCharge(arbre,1,0,dateFin - 1,debut[i],debut[i] + duree - 1,besoin);
+		}
+	}
+
+	deleteArbreCharge(arbre);
+
+	mesurerOccupation(graphePERT,ressources,type,debut,dateFin,
+		&nivellement->pic,&nivellement->carres);
+
+	return nivellement;
+}
+
+
+	/*
+	* Fonction : deleteNivellement
+	*
+	* Paramètres : TypNivellement *nivellement, le résultat à supprimer
+	*
+	* Description : Libère la mémoire occupée par le résultat.
+	*/
+void deleteNivellement(TypNivellement *nivellement) {
+	free(nivellement->debut);
+	free(nivellement);
+}
+
+
+	/*
+	* Fonction : evaluerPosition
+	*
+	* Paramètres : TypArbreCharge *arbre, l'occupation sans la tâche
+	*              int debut, int duree, int besoin, la tâche placée
+	*              int *pic, rempli avec l'occupation maximale obtenue
+	*              long long *carres, rempli avec la hausse de la somme des
+	*                  carrés due à la tâche
+	*
+	* Description : Évalue une position de la tâche sans modifier l'arbre.
+	*/
+static void evaluerPosition(TypArbreCharge *arbre, int debut, int duree, int besoin,
+		int *pic, long long *carres) {
+	int       fin;       /* Dernier jour de la tâche */
+	int       pendant;   /* Occupation maximale pendant la tâche */
+	long long somme;     /* Occupation totale pendant la tâche */
+
+	fin = debut + duree - 1;
+	lireCharge(arbre,1,0,arbre->nbJours - 1,debut,fin,0,&pendant,&somme);
+
+	/* Hors de la tâche, l'occupation ne dépasse pas le maximum global */
+	*pic = (pendant + besoin > arbre->max[1]) ? pendant + besoin : arbre->max[1];
+	*carres = 2 * besoin * somme + (long long) duree * besoin * besoin;
+}
+
+
+	/*
+	* Fonction : meilleurePosition
+	*
+	* Paramètres : int pic, long long carres, critères d'une position
+	*              int picRef, long long carresRef, critères d'une autre
+	*              TypCritereNivellement critere, le critère principal
+	*
+	* Retour : bool, true si la première position est strictement meilleure
+	*/
+static bool meilleurePosition(int pic, long long carres, int picRef, long long carresRef,
+		TypCritereNivellement critere) {
+	if (critere == NIVELLEMENT_PIC) {
+		return pic < picRef || (pic == picRef && carres < carresRef);
+	}
+
+	return carres < carresRef || (carres == carresRef && pic < picRef);
+}
+
+
+	/*
+	* Fonction : mesurerOccupation
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              TypRessources *ressources, int type, la ressource mesurée
+	*              int *debut, date de début de chaque sommet
+	*              int dateFin, la date de fin du chantier
+	*              int *pic, rempli avec l'occupation maximale
+	*              long long *carres, rempli avec la somme des carrés de
+	*                  l'occupation de chaque jour
+	*
+	* Description : Mesure l'occupation par un tableau de différences.
+	*/
+static void mesurerOccupation(TypGraphePERT *graphePERT, TypRessources *ressources, int type,
+		int *debut, int dateFin, int *pic, long long *carres) {
+	int  *variation;   /* Variation de l'occupation au début de chaque jour */
+	int  occupation;
+	int  nbSommets;
+	int  besoin;
+	int  i;
+
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	variation = calloc(dateFin + 1, sizeof(int));
+	for (i = 0; i < nbSommets; i++) {
+		besoin = ressources->besoin[i * ressources->nbTypes + type];
+		variation[debut[i]] += besoin;
+		variation[debut[i] + graphePERT->duree[i]] -= besoin;
+	}
+
+	*pic = 0;
+	*carres = 0;
+	occupation = 0;
+	for (i = 0; i < dateFin; i++) {
+		occupation += variation[i];
+		*pic = (occupation > *pic) ? occupation : *pic;
+		*carres += (long long) occupation * occupation;
+	}
+
+	free(variation);
+}
+
+
+	/*
+	* Fonction : creerArbreCharge
+	*
+	* Paramètres : int nbJours, la durée couverte (>= 1)
+	*
+	* Retour : TypArbreCharge*, un arbre d'occupation nulle
+	*/
+static TypArbreCharge* creerArbreCharge(int nbJours) {
+	TypArbreCharge *arbre;
+
+	arbre = malloc(sizeof(TypArbreCharge));
+	arbre->nbJours = nbJours;
+	arbre->max = calloc(4 * nbJours, sizeof(int));
+	arbre->somme = calloc(4 * nbJours, sizeof(long long));
+	arbre->ajout = calloc(4 * nbJours, sizeof(int));
+
+	return arbre;
+}
+
+
+	/*
+	* Fonction : deleteArbreCharge
+	*
+	* Paramètres : TypArbreCharge *arbre, l'arbre à supprimer
+	*/
+static void deleteArbreCharge(TypArbreCharge *arbre) {
+	free(arbre->max);
+	free(arbre->somme);
+	free(arbre->ajout);
+	free(arbre);
+}
+
+
+	/*
+	* Fonction : descendreAjout
+	*
+	* Paramètres : TypArbreCharge *arbre, l'arbre
+	*              int noeud, un noeud interne couvrant [g, d]
+	*              int g, int d
+	*
+	* Description : Reporte l'ajout en attente du noeud sur ses deux fils.
+	*/
+static void descendreAjout(TypArbreCharge *arbre, int noeud, int g, int d) {
+	int m = (g + d) / 2;
+	int a = arbre->ajout[noeud];
+
+	if (a != 0) {
+		arbre->max[2*noeud] += a;
+		arbre->somme[2*noeud] += (long long) a * (m - g + 1);
+		arbre->ajout[2*noeud] += a;
+		arbre->max[2*noeud+1] += a;
+		arbre->somme[2*noeud+1] += (long long) a * (d - m);
+		arbre->ajout[2*noeud+1] += a;
+		arbre->ajout[noeud] = 0;
+	}
+}
+
+
+	/*
+	* Fonction : ajouterCharge
+	*
+	* Paramètres : TypArbreCharge *arbre, l'arbre
+	*              int noeud, int g, int d, le noeud courant et son
+	*                  intervalle
+	*              int debut, int fin, les jours concernés (inclus)
+	*              int valeur, l'occupation ajoutée (négative pour retirer)
+	*/
+static void ajouterCharge(TypArbreCharge *arbre, int noeud, int g, int d, int debut, int fin, int valeur) {
+	int m;
+
+	if (fin < g || d < debut) {
+		return;
+	}
+	if (debut <= g && d <= fin) {
+		arbre->max[noeud] += valeur;
+		arbre->somme[noeud] += (long long) valeur * (d - g + 1);
+		arbre->ajout[noeud] += valeur;
+		return;
+	}
+
+	descendreAjout(arbre,noeud,g,d);
+	m = (g + d) / 2;
+	ajouterCharge(arbre,2 * noeud,g,m,debut,fin,valeur);
+	ajouterCharge(arbre,2 * noeud + 1,m + 1,d,debut,fin,valeur);
+	arbre->max[noeud] = (arbre->max[2*noeud] > arbre->max[2*noeud+1])
+		? arbre->max[2*noeud] : arbre->max[2*noeud+1];
+	arbre->somme[noeud] = arbre->somme[2*noeud] + arbre->somme[2*noeud+1];
+}
+
+
+	/*
+	* Fonction : lireCharge
+	*
+	* Paramètres : TypArbreCharge *arbre, l'arbre
+	*              int noeud, int g, int d, le noeud courant et son
+	*                  intervalle
+	*              int debut, int fin, les jours concernés (inclus, dans
+	*                  [g, d] au moins en partie)
+	*              int ajout, ajouts en attente au-dessus du noeud
+	*              int *max, long long *somme, remplis avec l'occupation
+	*                  maximale et totale sur [debut, fin]
+	*
+	* Description : Lecture seule : les ajouts en attente sont cumulés en
+	*               descendant au lieu d'être reportés sur les fils.
+	*/
+static void lireCharge(TypArbreCharge *arbre, int noeud, int g, int d, int debut, int fin,
+		int ajout, int *max, long long *somme) {
+	int       m;
+	int       maxDroite;
+	long long sommeDroite;
+
+	if (debut <= g && d <= fin) {
+		*max = arbre->max[noeud] + ajout;
+		*somme = arbre->somme[noeud] + (long long) ajout * (d - g + 1);
+		return;
+	}
+
+	ajout += arbre->ajout[noeud];
+	m = (g + d) / 2;
+	if (fin <= m) {
+		lireCharge(arbre,2 * noeud,g,m,debut,fin,ajout,max,somme);
+	}
+	else if (debut > m) {
+		lireCharge(arbre,2 * noeud + 1,m + 1,d,debut,fin,ajout,max,somme);
+	}
+	else {
+		lireCharge(arbre,2 * noeud,g,m,debut,fin,ajout,max,somme);
+		lireCharge(arbre,2 * noeud + 1,m + 1,d,debut,fin,ajout,&maxDroite,&sommeDroite);
+		*max = (maxDroite > *max) ? maxDroite : *max;
+		*somme += sommeDroite;
+	}
+}
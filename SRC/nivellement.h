@@ -0,0 +1,44 @@
+#ifndef NIVELLEMENT_H
+#define NIVELLEMENT_H
+
+#include "pert.h"
+#include "ressources.h"
+
+
+/* Nombre maximal de passes sur les tâches */
+#define NB_PASSES_NIVELLEMENT 16
+
+/*
+* Ce que le nivellement cherche à réduire en premier ; l'autre critère
+* départage les positions équivalentes.
+*/
+typedef enum TypCritereNivellement {
+	NIVELLEMENT_PIC,       /* Plus forte occupation de la ressource */
+	NIVELLEMENT_VARIANCE   /* Somme des carrés de l'occupation jour par
+	                          jour (la durée et le travail total étant
+	                          fixés, c'est la variance à une constante
+	                          près) */
+} TypCritereNivellement;
+
+/*
+* Résultat d'un nivellement : les tâches restent dans leur marge, la date
+* de fin du chantier ne change pas.
+*/
+typedef struct TypNivellement {
+	int       nbSommets;
+	int       dateFin;          /* Date de fin du chantier */
+	int       *debut;           /* Date de début retenue de chaque sommet
+	                               (indicée par sommet - 1) */
+	int       picDepart;        /* Pic d'occupation aux dates au plus tôt */
+	int       pic;              /* Pic d'occupation après nivellement */
+	long long carresDepart;     /* Somme des carrés de l'occupation aux
+	                               dates au plus tôt */
+	long long carres;           /* Somme des carrés après nivellement */
+} TypNivellement;
+
+
+TypNivellement* nivelerRessource(TypGraphePERT*,TypRessources*,int,TypCritereNivellement);
+
+void deleteNivellement(TypNivellement*);
+
+#endif
@@ -0,0 +1,960 @@
+/*
+******************************************************************************
+*
+* Programme : ordonnancement.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Simulation de la réalisation d'un chantier par un nombre limité
+*          d'ouvriers. Un espace de travail est construit une fois pour un
+*          graphe PERT puis réutilisé d'une simulation à l'autre.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "libgraphe.h"
+#include "pert.h"
+#include "ressources.h"
+#include "ordonnancement.h"
+
+
+/*
+* Clé de tri des tâches pour le calcul de leur rang de priorité.
+*/
+typedef struct TypClePriorite {
+	int regle;     /* Valeur donnée par la règle (la plus petite d'abord) */
+	int dateTard;  /* Date au plus tard de la tâche */
+	int sommet;    /* Indice de la tâche */
+} TypClePriorite;
+
+/*
+* Paramètres d'un thread du balayage du nombre d'ouvriers.
+*/
+typedef struct TypBalayage {
+	TypGraphePERT   *graphePERT;
+	int             premier;       /* Premier nombre d'ouvriers traité */
+	int             pas;           /* Écart entre deux nombres traités */
+	int             nbOuvriersMax;
+	int             *courbe;
+	int             *seuil;        /* Plus petit nombre d'ouvriers atteignant
+	                                  le chemin critique (partagé) */
+	pthread_mutex_t *verrou;
+} TypBalayage;
+
+
+static int placerTaches(TypEspaceOrdo*,int,const int*,const int*);
+static int comparerPriorites(const void*, const void*);
+static int comparerEvenements(const void*, const void*);
+static void tasInserer(int*,int*,const int*,int);
+static int tasExtraire(int*,int*,const int*);
+static void* balayer(void*);
+
+
+	/*
+	* Fonction : creerEspaceOrdo
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*                  dont les dates ont été calculées
+	*
+	* Retour : TypEspaceOrdo*, l'espace de travail créé
+	*
+	* Description : Construit l'espace de travail des simulations : durées,
+	*               successeurs et codes des dépendances sous forme de
+	*               tableaux contigus, nombre de prédécesseurs et rang de
+	*               priorité de chaque tâche (règle REGLE_CRITIQUE, voir
+	*               reglerPriorites).
+	*/
+TypEspaceOrdo* creerEspaceOrdo(TypGraphePERT *graphePERT) {
+	TypEspaceOrdo  *espace;   /* L'espace de travail créé */
+	TypGraphe      *graphe;   /* Le graphe associé au graphe PERT */
+	TypVoisins     *liste;    /* Liste des prédécesseurs d'un sommet */
+	TypVoisins     *vC;       /* Voisin courant lors du parcours des listes */
+	int            *position; /* Prochaine case libre des successeurs de
+	                             chaque sommet */
+	int            nbSommets; /* Le nombre de sommets du graphe */
+	int            nbAretes;  /* Le nombre d'arêtes du graphe */
+	int            i, p;      /* Permettent le parcours des sommets */
+
+	graphe = graphePERT->graphe;
+	nbSommets = graphe->nbrMaxSommets;
+
+	espace = malloc(sizeof(TypEspaceOrdo));
+	espace->nbSommets = nbSommets;
+	espace->sommetDepart = nbSommets - 2;
+	espace->dureeCritique = graphePERT->dateTot[nbSommets-1];
+	espace->liensTypes = graphePERT->liensTypes;
+	espace->duree = malloc(nbSommets * sizeof(int));
+	espace->rang = malloc(nbSommets * sizeof(int));
+	espace->debutSucc = malloc((nbSommets + 1) * sizeof(int));
+	espace->nbPred = calloc(nbSommets, sizeof(int));
+	espace->nbPredRestants = malloc(nbSommets * sizeof(int));
+	espace->fin = malloc(nbSommets * sizeof(int));
+	espace->tasLibres = malloc(nbSommets * sizeof(int));
+	espace->tasEnCours = malloc(nbSommets * sizeof(int));
+
+	/* Comptage des arêtes pour dimensionner le tableau des successeurs */
+	position = malloc(nbSommets * sizeof(int));
+	nbAretes = 0;
+	for (i = 0; i < nbSommets; i++) {
+		espace->debutSucc[i] = nbAretes;
+		position[i] = nbAretes;
+		nbAretes += degreSommet(graphe,i+1);
+	}
+	espace->debutSucc[nbSommets] = nbAretes;
+	espace->succ = malloc((nbAretes > 0 ? nbAretes : 1) * sizeof(int));
+	espace->lien = malloc((nbAretes > 0 ? nbAretes : 1) * sizeof(int));
+
+	/* Recopie des successeurs de chaque sommet, lus dans le graphe des
+	   prédécesseurs qui porte le code des dépendances */
+	for (i = 0; i < nbSommets; i++) {
+		espace->duree[i] = graphePERT->duree[i];
+
+		liste = graphePERT->grapheInverse->listesAdjacences[i];
+		for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+			p = numeroVoisin(&vC) - 1;
+			espace->succ[position[p]] = i;
+			espace->lien[position[p]] = poidsVoisin(&vC);
+			position[p]++;
+			espace->nbPred[i]++;
+		}
+	}
+	free(position);
+
+	reglerPriorites(espace,graphePERT,REGLE_CRITIQUE);
+
+	return espace;
+}
+
+
+	/*
+	* Fonction : reglerPriorites
+	*
+	* Paramètres : TypEspaceOrdo *espace, un espace de travail
+	*              TypGraphePERT *graphePERT, le graphe PERT de l'espace
+	*              TypReglePriorite regle, la règle de priorité
+	*
+	* Description : Calcule le rang de priorité de chaque tâche selon la
+	*               règle choisie :
+	*               - REGLE_CRITIQUE : les tâches du chemin critique ;
+	*               - REGLE_MARGE : la plus petite marge totale ;
+	*               - REGLE_PLUS_LONGUE : la plus grande durée ;
+	*               - REGLE_SUCCESSEURS : le plus de successeurs.
+	*               À égalité, les tâches dont la date au plus tard est la
+	*               plus proche passent en premier, puis le plus petit indice.
+	*/
+void reglerPriorites(TypEspaceOrdo *espace, TypGraphePERT *graphePERT, TypReglePriorite regle) {
+	TypClePriorite *cles;  /* Clés de priorité des tâches */
+	int            i;      /* Permet le parcours des sommets */
+
+	cles = malloc(espace->nbSommets * sizeof(TypClePriorite));
+	for (i = 0; i < espace->nbSommets; i++) {
+		switch (regle) {
+			case REGLE_MARGE :
+				cles[i].regle = graphePERT->margeTotale[i];
+				break;
+			case REGLE_PLUS_LONGUE :
+				cles[i].regle = - graphePERT->duree[i];
+				break;
+			case REGLE_SUCCESSEURS :
+				cles[i].regle = - (espace->debutSucc[i+1] - espace->debutSucc[i]);
+				break;
+			default :
+				cles[i].regle = (graphePERT->margeTotale[i] == 0) ? 0 : 1;
+				break;
+		}
+		cles[i].dateTard = graphePERT->dateTard[i];
+		cles[i].sommet = i;
+	}
+	qsort(cles,espace->nbSommets,sizeof(TypClePriorite),comparerPriorites);
+	for (i = 0; i < espace->nbSommets; i++) {
+		espace->rang[cles[i].sommet] = i;
+	}
+	free(cles);
+}
+
+
+	/*
+	* Fonction : deleteEspaceOrdo
+	*
+	* Paramètres : TypEspaceOrdo *espace, l'espace de travail à supprimer
+	*
+	* Description : Libère toute la mémoire occupée par l'espace de travail.
+	*/
+void deleteEspaceOrdo(TypEspaceOrdo *espace) {
+	free(espace->duree);
+	free(espace->rang);
+	free(espace->debutSucc);
+	free(espace->succ);
+	free(espace->lien);
+	free(espace->nbPred);
+	free(espace->nbPredRestants);
+	free(espace->fin);
+	free(espace->tasLibres);
+	free(espace->tasEnCours);
+	free(espace);
+}
+
+
+	/*
+	* Fonction : simulerOrdo
+	*
+	* Paramètres : TypEspaceOrdo *espace, un espace de travail
+	*              int nbOuvriers, le nombre d'ouvriers (>= 1)
+	*
+	* Retour : int, la durée totale du chantier
+	*
+	* Description : Simule la réalisation du chantier. À chaque date où une
+	*               tâche se termine, les tâches devenues libres sont ajoutées
+	*               au tas des tâches libres, puis les ouvriers disponibles
+	*               sont affectés aux tâches libres les plus prioritaires.
+	*               Seules les zones de travail de l'espace sont modifiées.
+	*               Avec des dépendances typées, une tâche peut devoir
+	*               commencer avant la fin, voire avant le début, d'un
+	*               prédécesseur : les tâches sont alors placées une à une
+	*               comme dans simulerOrdoRessources, chaque ouvrier étant
+	*               une unité d'une même ressource.
+	*/
+int simulerOrdo(TypEspaceOrdo *espace, int nbOuvriers) {
+	int date;        /* Date courante de la simulation */
+	int nbLibres;    /* Taille du tas des tâches libres */
+	int nbEnCours;   /* Taille du tas des tâches en cours */
+	int sommet;      /* Une tâche */
+	int *besoin;     /* Ouvriers demandés par chaque tâche (dépendances
+	                    typées) */
+	int i;           /* Permet le parcours des successeurs */
+
+	if (espace->liensTypes) {
+		besoin = malloc(espace->nbSommets * sizeof(int));
+		for (i = 0; i < espace->nbSommets; i++) {
+			besoin[i] = (i < espace->nbSommets - 2) ? 1 : 0;
+		}
+		date = placerTaches(espace,1,&nbOuvriers,besoin);
+		free(besoin);
+		return date;
+	}
+
+	for (i = 0; i < espace->nbSommets; i++) {
+		espace->nbPredRestants[i] = espace->nbPred[i];
+	}
+
+	date = 0;
+	nbLibres = 0;
+	nbEnCours = 0;
+	tasInserer(espace->tasLibres,&nbLibres,espace->rang,espace->sommetDepart);
+
+	while (true) {
+		/* On affecte les tâches libres les plus prioritaires aux ouvriers */
+		while (nbEnCours < nbOuvriers && nbLibres > 0) {
+			sommet = tasExtraire(espace->tasLibres,&nbLibres,espace->rang);
+			espace->fin[sommet] = date + espace->duree[sommet];
+			tasInserer(espace->tasEnCours,&nbEnCours,espace->fin,sommet);
+		}
+
+		if (nbEnCours == 0) {
+			break;
+		}
+
+		/* On termine toutes les tâches qui finissent à la prochaine date */
+		date = espace->fin[espace->tasEnCours[0]];
+		while (nbEnCours > 0 && espace->fin[espace->tasEnCours[0]] == date) {
+			sommet = tasExtraire(espace->tasEnCours,&nbEnCours,espace->fin);
+
+			for (i = espace->debutSucc[sommet]; i < espace->debutSucc[sommet+1]; i++) {
+				espace->nbPredRestants[espace->succ[i]]--;
+				if (espace->nbPredRestants[espace->succ[i]] == 0) {
+					tasInserer(espace->tasLibres,&nbLibres,espace->rang,espace->succ[i]);
+				}
+			}
+		}
+	}
+
+	return date;
+}
+
+
+	/*
+	* Fonction : simulerOrdoRessources
+	*
+	* Paramètres : TypEspaceOrdo *espace, un espace de travail
+	*              TypRessources *ressources, les ressources du chantier
+	*
+	* Retour : int, la durée totale du chantier, ou -1 si une tâche demande
+	*              plus d'unités d'un type qu'il n'en existe
+	*
+	* Description : Ordonnance les tâches une à une, par ordre de priorité
+	*               parmi celles dont tous les prédécesseurs sont placés
+	*               (voir placerTaches). Au retour, espace->fin donne la
+	*               date de fin de chaque tâche.
+	*/
+int simulerOrdoRessources(TypEspaceOrdo *espace, TypRessources *ressources) {
+	int nbTypes;     /* Nombre de types de ressources */
+	int r, i;
+
+	nbTypes = ressources->nbTypes;
+	for (i = 0; i < espace->nbSommets; i++) {
+		for (r = 0; r < nbTypes; r++) {
+			if (ressources->besoin[i * nbTypes + r] > ressources->capacite[r]) {
+				return -1;
+			}
+		}
+	}
+
+	return placerTaches(espace,nbTypes,ressources->capacite,ressources->besoin);
+}
+
+
+	/*
+	* Fonction : courbeDureeTotale
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*                  dont les dates ont été calculées
+	*              int nbOuvriersMax, le plus grand nombre d'ouvriers (>= 1)
+	*              int nbThreads, le nombre de threads à utiliser
+	*                  (<= 0 : un par processeur)
+	*              int *courbe, tableau de nbOuvriersMax cases qui reçoit
+	*                  en courbe[k-1] la durée du chantier avec k ouvriers
+	*
+	* Retour : int, le nombre de simulations effectuées
+	*
+	* Description : Calcule la durée totale du chantier pour chaque nombre
+	*               d'ouvriers de 1 à nbOuvriersMax. Chaque thread réutilise
+	*               un seul espace de travail. Dès qu'un nombre d'ouvriers
+	*               atteint la longueur du chemin critique, les nombres
+	*               supérieurs ne sont plus simulés et reçoivent cette valeur ;
+	*               c'est le cas d'emblée au-delà du parallélisme maximal
+	*               (voir parallelismeMaximal).
+	*/
+int courbeDureeTotale(TypGraphePERT *graphePERT, int nbOuvriersMax, int nbThreads, int *courbe) {
+	TypBalayage     *balayages;  /* Paramètres de chaque thread */
+	pthread_t       *threads;    /* Les threads lancés */
+	pthread_mutex_t verrou;      /* Protège le seuil partagé */
+	int             seuil;       /* Plus petit nombre d'ouvriers atteignant
+	                                le chemin critique */
+	int             nbSimulations; /* Nombre de simulations effectuées */
+	int             dureeCritique; /* Longueur du chemin critique */
+	int             k;           /* Permet le parcours des nombres d'ouvriers */
+	int             t;           /* Permet le parcours des threads */
+
+	if (nbThreads <= 0) {
+		nbThreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	if (nbThreads > nbOuvriersMax) {
+		nbThreads = nbOuvriersMax;
+	}
+	if (nbThreads < 1) {
+		nbThreads = 1;
+	}
+
+	dureeCritique = graphePERT->dateTot[graphePERT->graphe->nbrMaxSommets - 1];
+	seuil = parallelismeMaximal(graphePERT);
+	seuil = (seuil >= 1 && seuil <= nbOuvriersMax) ? seuil : nbOuvriersMax + 1;
+	for (k = 1; k <= nbOuvriersMax; k++) {
+		courbe[k-1] = -1;
+	}
+
+	pthread_mutex_init(&verrou,NULL);
+	balayages = malloc(nbThreads * sizeof(TypBalayage));
+	threads = malloc(nbThreads * sizeof(pthread_t));
+
+	for (t = 0; t < nbThreads; t++) {
+		balayages[t].graphePERT = graphePERT;
+		balayages[t].premier = t + 1;
+		balayages[t].pas = nbThreads;
+		balayages[t].nbOuvriersMax = nbOuvriersMax;
+		balayages[t].courbe = courbe;
+		balayages[t].seuil = &seuil;
+		balayages[t].verrou = &verrou;
+	}
+
+	/* Le thread courant traite lui-même la première part du balayage */
+	for (t = 1; t < nbThreads; t++) {
+		pthread_create(&threads[t],NULL,balayer,&balayages[t]);
+	}
+	balayer(&balayages[0]);
+	for (t = 1; t < nbThreads; t++) {
+		pthread_join(threads[t],NULL);
+	}
+
+	/* Au-delà du seuil, la durée est celle du chemin critique */
+	nbSimulations = 0;
+	for (k = 1; k <= nbOuvriersMax; k++) {
+		if (k > seuil) {
+			courbe[k-1] = dureeCritique;
+		}
+		else if (courbe[k-1] != -1) {
+			nbSimulations++;
+		}
+	}
+
+	free(balayages);
+	free(threads);
+	pthread_mutex_destroy(&verrou);
+
+	return nbSimulations;
+}
+
+
+	/*
+	* Fonction : parallelismeMaximal
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*                  dont les dates ont été calculées
+	*
+	* Retour : int, le plus grand nombre de tâches en cours en même temps
+	*              lorsque chacune commence au plus tôt, ou le nombre de
+	*              tâches (borne évidente) si la mémoire manque
+	*
+	* Description : Une tâche de durée d occupe les jours [debut, debut+d[ ;
+	*               une tâche de durée nulle compte pour le jour où elle
+	*               commence. Avec au moins autant d'ouvriers, chaque tâche
+	*               peut commencer au plus tôt : la simulation donne la
+	*               longueur du chemin critique.
+	*               Les débuts et fins des tâches sont triés puis balayés :
+	*               la mémoire ne dépend que du nombre de tâches, pas de la
+	*               durée du chantier.
+	*/
+int parallelismeMaximal(TypGraphePERT *graphePERT) {
+	long long *evenements; /* Date * 2 + 1 pour un début, date * 2 pour
+	                          une fin : à date égale, les fins d'abord */
+	int       nbTaches;    /* Le nombre de tâches (hors alpha et oméga) */
+	int       enCours;     /* Tâches en cours après l'événement courant */
+	int       parallelisme; /* Le résultat */
+	long long debut;
+	int       i;
+
+	nbTaches = graphePERT->graphe->nbrMaxSommets - 2;
+	if (nbTaches <= 0 || (evenements = malloc(2 * (size_t) nbTaches * sizeof(long long))) == NULL) {
+		return (nbTaches > 0) ? nbTaches : 0;
+	}
+
+	for (i = 0; i < nbTaches; i++) {
+		debut = graphePERT->dateTot[i];
+		evenements[2*i] = debut * 2 + 1;
+		evenements[2*i+1] = (debut + (graphePERT->duree[i] > 0 ? graphePERT->duree[i] : 1)) * 2;
+	}
+	qsort(evenements,2 * (size_t) nbTaches,sizeof(long long),comparerEvenements);
+
+	parallelisme = 0;
+	enCours = 0;
+	for (i = 0; i < 2 * nbTaches; i++) {
+		enCours += (evenements[i] & 1) ? 1 : -1;
+		if (enCours > parallelisme) {
+			parallelisme = enCours;
+		}
+	}
+
+	free(evenements);
+
+	return parallelisme;
+}
+
+
+	/*
+	* Fonction : largeurAntichaine
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*
+	* Retour : int, le plus grand nombre de tâches deux à deux
+	*              indépendantes (aucune ne précède l'autre, même
+	*              indirectement), ou -1 au-delà de LARGEUR_MAX_TACHES
+	*              tâches
+	*
+	* Description : Théorème de Dilworth : la largeur est le nombre de
+	*               tâches moins un couplage maximal du graphe biparti
+	*               « u précède v » de la fermeture transitive. La fermeture
+	*               est construite en tableaux de bits, dans l'ordre
+	*               topologique inverse ; seules les arêtes qui font
+	*               attendre la fin de u pour commencer v y entrent (une
+	*               dépendance début-début, par exemple, laisse les deux
+	*               tâches se chevaucher). Le couplage est augmenté par
+	*               phases : dans une phase, chaque tâche de droite n'est
+	*               visitée qu'une fois, et les parcours sont itératifs.
+	*               Aucune simulation avec au moins autant d'ouvriers ne
+	*               dépasse le chemin critique ; parallelismeMaximal donne
+	*               un seuil plus bas et bien moins coûteux.
+	*/
+int largeurAntichaine(TypGraphePERT *graphePERT) {
+	TypVoisins *liste;       /* Liste des successeurs d'une tâche */
+	TypVoisins *vC;          /* Successeur courant */
+	uint64_t   *atteint;     /* atteint[u * nbMots + ...] : tâches que u
+	                            précède */
+	uint64_t   *libres;      /* Tâches de droite pas encore visitées dans
+	                            la phase */
+	uint64_t   mot;
+	int        *coupleGauche; /* Tâche de droite couplée à chaque tâche de
+	                             gauche (-1 : aucune) */
+	int        *coupleDroite; /* Tâche de gauche couplée à chaque tâche de
+	                             droite (-1 : aucune) */
+	int        *pile;        /* Tâches de gauche du chemin en cours */
+	int        *arrivee;     /* Tâche de droite par laquelle on est arrivé
+	                            à chaque tâche de la pile */
+	int        *courant;     /* Prochain mot à examiner pour chaque tâche
+	                            de gauche */
+	int        nbTaches;     /* Nombre de tâches (ni alpha ni oméga) */
+	int        nbMots;       /* Mots de 64 bits par ligne */
+	int        couplage;     /* Taille du couplage */
+	bool       augmente;     /* true si la phase a augmenté le couplage */
+	int        profondeur;
+	int        k, u, v, w, x;
+
+	nbTaches = graphePERT->graphe->nbrMaxSommets - 2;
+	if (nbTaches > LARGEUR_MAX_TACHES) {
+		return -1;
+	}
+	if (nbTaches == 0) {
+		return 0;
+	}
+	nbMots = (nbTaches + 63) / 64;
+
+	/* Fermeture transitive, successeurs avant prédécesseurs */
+	atteint = calloc((size_t) nbTaches * nbMots, sizeof(uint64_t));
+	for (k = nbTaches + 1; k >= 0; k--) {
+		u = graphePERT->ordreTopo[k] - 1;
+		if (u >= nbTaches) {
+			continue;
+		}
+		liste = graphePERT->graphe->listesAdjacences[u];
+		for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+			v = numeroVoisin(&vC) - 1;
+			if (v >= nbTaches || poidsVoisin(&vC) < graphePERT->duree[u]) {
+				continue;
+			}
+			atteint[(size_t) u * nbMots + v / 64] |= (uint64_t) 1 << (v % 64);
+			for (x = 0; x < nbMots; x++) {
+				atteint[(size_t) u * nbMots + x] |= atteint[(size_t) v * nbMots + x];
+			}
+		}
+	}
+
+	coupleGauche = malloc(nbTaches * sizeof(int));
+	coupleDroite = malloc(nbTaches * sizeof(int));
+	pile = malloc(nbTaches * sizeof(int));
+	arrivee = malloc(nbTaches * sizeof(int));
+	courant = malloc(nbTaches * sizeof(int));
+	libres = malloc(nbMots * sizeof(uint64_t));
+	for (u = 0; u < nbTaches; u++) {
+		coupleGauche[u] = -1;
+		coupleDroite[u] = -1;
+	}
+
+	couplage = 0;
+	augmente = true;
+	while (augmente) {
+		augmente = false;
+		for (x = 0; x < nbMots; x++) {
+			libres[x] = ~(uint64_t) 0;
+		}
+		for (u = 0; u < nbTaches; u++) {
+			courant[u] = 0;
+		}
+
+		for (u = 0; u < nbTaches; u++) {
+			if (coupleGauche[u] != -1) {
+				continue;
+			}
+
+			/* Chemin augmentant depuis u, en profondeur */
+			pile[0] = u;
+			profondeur = 1;
+			while (profondeur > 0) {
+				w = pile[profondeur-1];
+				v = -1;
+				while (courant[w] < nbMots) {
+					mot = atteint[(size_t) w * nbMots + courant[w]] & libres[courant[w]];
+					if (mot != 0) {
+						for (v = courant[w] * 64; (mot & 1) == 0; v++) {
+							mot >>= 1;
+						}
+						break;
+					}
+					courant[w]++;
+				}
+
+				if (v == -1) {
+					profondeur--;
+				}
+				else {
+					libres[v / 64] &= ~((uint64_t) 1 << (v % 64));
+					arrivee[profondeur-1] = v;
+					if (coupleDroite[v] == -1) {
+						/* Inversion du chemin */
+						for (k = 0; k < profondeur; k++) {
+							coupleGauche[pile[k]] = arrivee[k];
+							coupleDroite[arrivee[k]] = pile[k];
+						}
+						couplage++;
+						augmente = true;
+						break;
+					}
+					pile[profondeur++] = coupleDroite[v];
+				}
+			}
+		}
+	}
+
+	free(atteint);
+	free(libres);
+	free(coupleGauche);
+	free(coupleDroite);
+	free(pile);
+	free(arrivee);
+	free(courant);
+
+	return nbTaches - couplage;
+}
+
+
+	/*
+	* Fonction : ouvriersMinimum
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*                  dont les dates ont été calculées
+	*              int delai, la date de fin à respecter
+	*              int *nbSimulations, reçoit le nombre de simulations
+	*                  effectuées (ignoré si NULL)
+	*
+	* Retour : int, le plus petit nombre d'ouvriers qui termine le chantier
+	*              au plus tard à delai, ou -1 si delai est plus court que
+	*              le chemin critique
+	*
+	* Description : La réponse est encadrée sans simulation : au moins le
+	*               travail total divisé par le délai (arrondi au-dessus),
+	*               au plus le parallélisme maximal (voir
+	*               parallelismeMaximal). Elle est ensuite cherchée par
+	*               dichotomie, les simulations réutilisant un seul espace
+	*               de travail. La durée ne décroît pas toujours quand on
+	*               ajoute un ouvrier (anomalies de l'ordonnancement par
+	*               liste) : le nombre renvoyé tient le délai et le nombre
+	*               inférieur rencontré par la dichotomie ne le tient pas.
+	*/
+int ouvriersMinimum(TypGraphePERT *graphePERT, int delai, int *nbSimulations) {
+	TypEspaceOrdo *espace;  /* Espace de travail des simulations */
+	long long     travail;  /* Somme des durées des tâches */
+	int           nbSommets;
+	int           bas;      /* Nombre d'ouvriers qui ne peut pas suffire
+	                           en dessous */
+	int           haut;     /* Nombre d'ouvriers qui tient le délai */
+	int           milieu;
+	int           nb;       /* Nombre de simulations effectuées */
+	int           i;
+
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	nb = 0;
+
+	if (delai < graphePERT->dateTot[nbSommets-1]) {
+		haut = -1;
+	}
+	else {
+		travail = 0;
+		for (i = 0; i < nbSommets - 2; i++) {
+			travail += graphePERT->duree[i];
+		}
+		bas = (delai > 0) ? (int) ((travail + delai - 1) / delai) : 1;
+		bas = (bas > 1) ? bas : 1;
+		haut = parallelismeMaximal(graphePERT);
+		haut = (haut > bas) ? haut : bas;
+
+		espace = creerEspaceOrdo(graphePERT);
+		while (bas < haut) {
+			milieu = bas + (haut - bas) / 2;
+			nb++;
+			if (simulerOrdo(espace,milieu) <= delai) {
+				haut = milieu;
+			}
+			else {
+				bas = milieu + 1;
+			}
+		}
+		deleteEspaceOrdo(espace);
+	}
+
+	if (nbSimulations != NULL) {
+		*nbSimulations = nb;
+	}
+
+	return haut;
+}
+
+
+	/*
+	* Fonction : balayer
+	*
+	* Paramètres : void *arg, pointeur sur un TypBalayage
+	*
+	* Retour : void*, NULL
+	*
+	* Description : Simule le chantier pour les nombres d'ouvriers
+	*               premier, premier + pas, ... tant qu'ils ne dépassent pas
+	*               le seuil à partir duquel le chemin critique est atteint.
+	*/
+static void* balayer(void *arg) {
+	TypBalayage   *balayage;  /* Paramètres du thread */
+	TypEspaceOrdo *espace;    /* Espace de travail propre au thread */
+	int           k;          /* Le nombre d'ouvriers simulé */
+	int           seuil;      /* Copie locale du seuil partagé */
+	int           duree;      /* Durée obtenue pour k ouvriers */
+
+	balayage = arg;
+	espace = creerEspaceOrdo(balayage->graphePERT);
+
+	for (k = balayage->premier; k <= balayage->nbOuvriersMax; k += balayage->pas) {
+		pthread_mutex_lock(balayage->verrou);
+		seuil = *(balayage->seuil);
+		pthread_mutex_unlock(balayage->verrou);
+
+		if (k > seuil) {
+			break;
+		}
+
+		duree = simulerOrdo(espace,k);
+		balayage->courbe[k-1] = duree;
+
+		if (duree == espace->dureeCritique) {
+			pthread_mutex_lock(balayage->verrou);
+			if (k < *(balayage->seuil)) {
+				*(balayage->seuil) = k;
+			}
+			pthread_mutex_unlock(balayage->verrou);
+			break;
+		}
+	}
+
+	deleteEspaceOrdo(espace);
+
+	return NULL;
+}
+
+
+	/*
+	* Fonction : placerTaches
+	*
+	* Paramètres : TypEspaceOrdo *espace, un espace de travail
+	*              int nbTypes, le nombre de types de ressources
+	*              const int *capacite, les unités de chaque type
+	*              const int *besoins, besoins[i * nbTypes + r] : unités du
+	*                  type r demandées par la tâche i (jamais plus que la
+	*                  capacité)
+	*
+	* Retour : int, la durée totale du chantier
+	*
+	* Description : Ordonnance les tâches une à une, par ordre de priorité
+	*               parmi celles dont tous les prédécesseurs sont placés.
+	*               Chaque tâche est placée à la première date permise par
+	*               ses dépendances (l'écart voulu après le début de chaque
+	*               prédécesseur, voir ecartLien) où chaque type de
+	*               ressource qu'elle demande a assez d'unités libres
+	*               pendant toute sa durée. Les unités libres de chaque type
+	*               sont tenues dans un profil indicé par la date.
+	*/
+static int placerTaches(TypEspaceOrdo *espace, int nbTypes, const int *capacite, const int *besoins) {
+	int       *libre;     /* libre[r * horizon + t] : unités du type r libres
+	                         entre t et t + 1 */
+	int       *debutMin;  /* Date de début permise par les prédécesseurs
+	                         placés */
+	const int *besoin;    /* Besoins de la tâche en cours de placement */
+	int       horizon;    /* Borne sur la date de fin du chantier */
+	int       nbLibres;   /* Taille du tas des tâches libres */
+	int       sommet;     /* La tâche en cours de placement */
+	int       debut;      /* Date de début candidate */
+	int       duree;      /* Durée totale du chantier */
+	int       conflit;    /* Première date où une ressource manque, ou -1 */
+	int       ecart;      /* Écart imposé par une dépendance */
+	int       r, t, i;
+
+	/* Un ordonnancement au plus tôt ne dépasse pas la somme des durées
+	   et des décalages positifs (au-delà de la fin du prédécesseur) */
+	horizon = 1;
+	for (i = 0; i < espace->nbSommets; i++) {
+		horizon += espace->duree[i];
+		espace->nbPredRestants[i] = espace->nbPred[i];
+		for (t = espace->debutSucc[i]; t < espace->debutSucc[i+1] && espace->liensTypes; t++) {
+			ecart = ecartLien(espace->lien[t],espace->duree[i],espace->duree[espace->succ[t]]);
+			if (ecart > espace->duree[i]) {
+				horizon += ecart - espace->duree[i];
+			}
+		}
+	}
+	libre = malloc(((nbTypes > 0) ? nbTypes * horizon : 1) * sizeof(int));
+	for (r = 0; r < nbTypes; r++) {
+		for (t = 0; t < horizon; t++) {
+			libre[r * horizon + t] = capacite[r];
+		}
+	}
+	debutMin = calloc(espace->nbSommets, sizeof(int));
+
+	duree = 0;
+	nbLibres = 0;
+	tasInserer(espace->tasLibres,&nbLibres,espace->rang,espace->sommetDepart);
+
+	while (nbLibres > 0) {
+		sommet = tasExtraire(espace->tasLibres,&nbLibres,espace->rang);
+		besoin = &(besoins[sommet * nbTypes]);
+
+		/* Recherche de la première date où toutes les ressources suffisent */
+		debut = debutMin[sommet];
+		do {
+			conflit = -1;
+			for (r = 0; r < nbTypes && conflit == -1; r++) {
+				if (besoin[r] == 0) {
+					continue;
+				}
+				for (t = debut + espace->duree[sommet] - 1; t >= debut; t--) {
+					if (libre[r * horizon + t] < besoin[r]) {
+						conflit = t;
+						break;
+					}
+				}
+			}
+			if (conflit != -1) {
+				debut = conflit + 1;
+			}
+		} while (conflit != -1);
+
+		/* Réservation des ressources */
+		for (r = 0; r < nbTypes; r++) {
+			for (t = debut; t < debut + espace->duree[sommet] && besoin[r] > 0; t++) {
+				libre[r * horizon + t] -= besoin[r];
+			}
+		}
+		espace->fin[sommet] = debut + espace->duree[sommet];
+		if (espace->fin[sommet] > duree) {
+			duree = espace->fin[sommet];
+		}
+
+		for (i = espace->debutSucc[sommet]; i < espace->debutSucc[sommet+1]; i++) {
+			ecart = (espace->lien[i] == LIEN_SIMPLE) ? espace->duree[sommet]
+			        : ecartLien(espace->lien[i],espace->duree[sommet],espace->duree[espace->succ[i]]);
+			if (debut + ecart > debutMin[espace->succ[i]]) {
+				debutMin[espace->succ[i]] = debut + ecart;
+			}
+			espace->nbPredRestants[espace->succ[i]]--;
+			if (espace->nbPredRestants[espace->succ[i]] == 0) {
+				tasInserer(espace->tasLibres,&nbLibres,espace->rang,espace->succ[i]);
+			}
+		}
+	}
+
+	free(libre);
+	free(debutMin);
+
+	return duree;
+}
+
+
+	/*
+	* Fonction : comparerPriorites
+	*
+	* Paramètres : const void *a, const void *b, deux TypClePriorite
+	*
+	* Retour : int, < 0 si a est plus prioritaire que b, > 0 sinon
+	*
+	* Description : Fonction de comparaison utilisée par qsort.
+	*/
+static int comparerPriorites(const void *a, const void *b) {
+	const TypClePriorite *cleA = a;
+	const TypClePriorite *cleB = b;
+
+	if (cleA->regle != cleB->regle) {
+		return cleA->regle - cleB->regle;
+	}
+	if (cleA->dateTard != cleB->dateTard) {
+		return cleA->dateTard - cleB->dateTard;
+	}
+	return cleA->sommet - cleB->sommet;
+}
+
+
+	/*
+	* Fonction : comparerEvenements
+	*
+	* Paramètres : const void *a, const void *b, deux événements de
+	*                  parallelismeMaximal
+	*
+	* Retour : int, fonction de comparaison de qsort
+	*/
+static int comparerEvenements(const void *a, const void *b) {
+	long long x = *(const long long*) a;
+	long long y = *(const long long*) b;
+
+	return (x > y) - (x < y);
+}
+
+
+	/*
+	* Fonction : tasInserer
+	*
+	* Paramètres : int *tas, un tas binaire de sommets
+	*              int *taille, la taille du tas
+	*              const int *cle, la clé de chaque sommet
+	*              int sommet, le sommet à insérer
+	*
+	* Description : Insère un sommet dans le tas (le sommet de plus petite
+	*               clé est en tête, à égalité le plus petit indice).
+	*/
+static void tasInserer(int *tas, int *taille, const int *cle, int sommet) {
+	int i;      /* Position courante du sommet inséré */
+	int parent; /* Position du parent */
+
+	i = *taille;
+	(*taille)++;
+
+	while (i > 0) {
+		parent = (i - 1) / 2;
+		if (cle[tas[parent]] < cle[sommet]
+				|| (cle[tas[parent]] == cle[sommet] && tas[parent] < sommet)) {
+			break;
+		}
+		tas[i] = tas[parent];
+		i = parent;
+	}
+	tas[i] = sommet;
+}
+
+
+	/*
+	* Fonction : tasExtraire
+	*
+	* Paramètres : int *tas, un tas binaire non vide
+	*              int *taille, la taille du tas
+	*              const int *cle, la clé de chaque sommet
+	*
+	* Retour : int, le sommet de plus petite clé, retiré du tas
+	*
+	* Description : Retire et renvoie la tête du tas.
+	*/
+static int tasExtraire(int *tas, int *taille, const int *cle) {
+	int tete;    /* Le sommet renvoyé */
+	int dernier; /* Le dernier sommet du tas, à replacer */
+	int i;       /* Position courante */
+	int fils;    /* Position du plus petit fils */
+
+	tete = tas[0];
+	(*taille)--;
+	dernier = tas[*taille];
+
+	i = 0;
+	while (2 * i + 1 < *taille) {
+		fils = 2 * i + 1;
+		if (fils + 1 < *taille && (cle[tas[fils+1]] < cle[tas[fils]]
+				|| (cle[tas[fils+1]] == cle[tas[fils]] && tas[fils+1] < tas[fils]))) {
+			fils++;
+		}
+		if (cle[dernier] < cle[tas[fils]]
+				|| (cle[dernier] == cle[tas[fils]] && dernier < tas[fils])) {
+			break;
+		}
+		tas[i] = tas[fils];
+		i = fils;
+	}
+	tas[i] = dernier;
+
+	return tete;
+}
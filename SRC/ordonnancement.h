@@ -0,0 +1,69 @@
+#ifndef ORDONNANCEMENT_H
+#define ORDONNANCEMENT_H
+
+#include "pert.h"
+#include "ressources.h"
+
+
+/* Au-delà de ce nombre de tâches, largeurAntichaine renonce (mémoire en
+   nombre de tâches au carré) */
+#define LARGEUR_MAX_TACHES 16384
+
+/*
+* Espace de travail de la simulation du chantier avec un nombre limité
+* d'ouvriers. Les sommets sont indicés à partir de 0 (sommet - 1).
+* La structure est construite une seule fois pour un graphe PERT dont les
+* dates ont été calculées, puis réutilisée pour autant de simulations que
+* nécessaire.
+*/
+typedef struct TypEspaceOrdo {
+	int nbSommets;        /* Nombre de sommets (alpha et oméga compris) */
+	int sommetDepart;     /* Indice de la tâche alpha */
+	int dureeCritique;    /* Longueur du chemin critique */
+	int *duree;           /* Durée de chaque tâche */
+	int *rang;            /* Rang de priorité de chaque tâche (0 = la plus
+	                         prioritaire) */
+	int *debutSucc;       /* Successeurs de i : succ[debutSucc[i]] à
+	                         succ[debutSucc[i+1]-1] */
+	int *succ;
+	int *lien;            /* Code de la dépendance vers chaque successeur
+	                         de succ (voir LIEN) */
+	bool liensTypes;      /* true si une dépendance n'est pas LIEN_SIMPLE */
+	int *nbPred;          /* Nombre de prédécesseurs de chaque tâche */
+	int *nbPredRestants;  /* Prédécesseurs non terminés (simulation) */
+	int *fin;             /* Date de fin de chaque tâche lancée (simulation) */
+	int *tasLibres;       /* Tas des tâches libres, ordonné par rang */
+	int *tasEnCours;      /* Tas des tâches en cours, ordonné par date de fin */
+} TypEspaceOrdo;
+
+/*
+* Règle de priorité utilisée pour choisir parmi les tâches libres.
+* À égalité, la tâche de plus petite date au plus tard passe en premier.
+*/
+typedef enum TypReglePriorite {
+	REGLE_CRITIQUE,     /* Tâches du chemin critique d'abord */
+	REGLE_MARGE,        /* Plus petite marge totale d'abord */
+	REGLE_PLUS_LONGUE,  /* Plus grande durée d'abord */
+	REGLE_SUCCESSEURS   /* Plus grand nombre de successeurs d'abord */
+} TypReglePriorite;
+
+
+TypEspaceOrdo* creerEspaceOrdo(TypGraphePERT*);
+
+void reglerPriorites(TypEspaceOrdo*,TypGraphePERT*,TypReglePriorite);
+
+void deleteEspaceOrdo(TypEspaceOrdo*);
+
+int simulerOrdo(TypEspaceOrdo*,int);
+
+int simulerOrdoRessources(TypEspaceOrdo*,TypRessources*);
+
+int courbeDureeTotale(TypGraphePERT*,int,int,int*);
+
+int parallelismeMaximal(TypGraphePERT*);
+
+int largeurAntichaine(TypGraphePERT*);
+
+int ouvriersMinimum(TypGraphePERT*,int,int*);
+
+#endif
@@ -3,52 +3,69 @@
 #include <stdbool.h>
 #include <string.h>
 #include <stddef.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "libgraphe.h"
 #include "pert.h"
+#include "ressources.h"
+#include "ordonnancement.h"
+#include "erreurs.h"
+#include "critique.h"
+#include "binaire.h"
+#include "topologie.h"
 
 
-/*
-* Structure associant une tâche à sa durée restante.
-* Utilisée pour le calcul de la durée totale du chantier.
-*/
-typedef struct TypTacheEnCours {
-	TypTache *tache;
-	int dureeRestante;
-} TypTacheEnCours;
+/* Nombre maximal de chemins critiques affichés */
+#define NB_CHEMINS_AFFICHES 50
 
 
-static void calculDatesAuPlusTot(TypGraphePERT*,int);
+static int ordreTopologique(TypGraphePERT*);
+static void calculDatesAuPlusTot(TypGraphePERT*);
 static void calculDatesAuPlusTard(TypGraphePERT*);
-static TypTacheEnCours* creerTacheEnCours(TypTache*);
-static void decompteDuree(TypTacheEnCours**,int,int);
-static void chercheTachesLibres(TypTache**,TypTache**,TypTache**,int*,int*,int);
-static void affecteTaches(TypTache**,TypTacheEnCours**,int*,int*,int);
-static void triTachesEnCours(TypTacheEnCours**,int);
-static int tacheEnSommet(char);
-static char sommetEnTache(int);
-static char* replace(const char*, const char*, const char*);
+static int dateAuPlusTot(TypGraphePERT*,int);
+static int dateAuPlusTard(TypGraphePERT*,int,int);
+static int ajouterDependance(TypGraphePERT*,int,int);
+static int reordonner(TypGraphePERT*,int,int);
+static int voisinsPERT(void*,int,bool,int*);
+static void relierSommets(TypGraphePERT*,int,int,int);
+static void delierSommets(TypGraphePERT*,int,int);
+static void ajouterArete(TypGraphePERT*,int,int,int);
+static unsigned int hacherNom(const char*,size_t);
+static int chercherNom(TypGraphePERT*,const char*,size_t);
+static const char* dependanceSuivante(const char*,size_t*);
+static int chercherDependance(TypGraphePERT*,const char*,size_t,int*);
+static bool lireLien(const char*,size_t,int*);
+static bool debutBorne(TypGraphePERT*,int);
+static bool finBornee(TypGraphePERT*,int);
+static char* lireTexte(FILE*,size_t*,bool*);
+static char* sauterEspaces(char*);
+static void couperEspaces(char*);
+static void libererTexte(char*,size_t,bool);
 
 
 	/*
 	* Fonction : creerTache
 	*
-	* Paramètres : char nom, le nom de la tâche
+	* Paramètres : TypArene *arene, l'arène du graphe PERT
+	*              char *nom, le nom de la tâche
 	*              char *intitule, l'intitulé de la tâche
-	*              char *dependances, les prédecesseurs de la tâche
-	*                  (ou chaîne vide s'il n'y en a pas)
+	*              char *dependances, les noms des prédecesseurs de la tâche
+	*                  séparés par des virgules (ou chaîne vide s'il n'y en
+	*                  a pas)
 	*
 	* Retour : TypTache*, pointeur sur la tâche créée
 	*
 	* Description : Crée une tâche dont les informations sont passées
-	*               en paramètre. La mémoire est allouée dans la fonction.
+	*               en paramètre. La mémoire est prise dans l'arène ;
+	*               les chaînes ne sont pas recopiées.
 	*/
-TypTache* creerTache(char nom, char *intitule, int duree, char *dependances) {
+TypTache* creerTache(TypArene *arene, char *nom, char *intitule, char *dependances) {
 	TypTache *tache;  /* La nouvelle tâche créée */
 	
-	tache = malloc(sizeof(TypTache));
+	tache = allouerArene(arene,sizeof(TypTache));
 	tache->nom = nom;
 	tache->intitule = intitule;
-	tache->duree = duree;
 	tache->dependances = dependances;
 	
 	return tache;
@@ -58,87 +75,235 @@ TypTache* creerTache(char nom, char *intitule, int duree, char *dependances) {
 	/*
 	* Fonction : creerGraphePERT
 	*
-	* Paramètres : TypTache **taches, un tableau de tâches
-	*              int nbTaches, la taille du tableau taches
+	* Paramètres : TypArene *arene, l'arène où prendre le graphe PERT
+	*              TypTache **taches, un tableau de tâches, pris dans
+	*                  l'arène, avec de la place pour deux tâches de plus
+	*              int *duree, la durée de chaque tâche, tableau pris dans
+	*                  l'arène avec la même place en plus
+	*              int nbTaches, le nombre de tâches du tableau taches
 	*
-	* Retour : TypGraphePERT*, pointeur sur le graphe PERT créé
+	* Retour : TypGraphePERT*, pointeur sur le graphe PERT créé, ou NULL si
+	*              deux tâches ont le même nom, si une dépendance cite une
+	*              tâche inconnue ou cite deux fois une tâche avec des types
+	*              ou des décalages différents, si les dépendances forment
+	*              un circuit, ou si une durée est négative ou que la somme
+	*              des durées et des décalages dépasse DUREE_MAX_CHANTIER
 	*
 	* Description : Crée un graphe PERT à partir d'un tableau de tâches.
 	*               Les tâches alpha et oméga sont créées dans la fonction.
+	*               Les estimations optimiste et pessimiste valent duree ;
+	*               l'appelant peut les changer ensuite.
+	*               Les dépendances sont retrouvées par leur nom grâce à une
+	*               table de hachage, gardée dans le graphe ; leur type et
+	*               leur décalage éventuels (voir TypTypeLien) sont portés
+	*               par les arêtes. Une tâche est reliée à alpha si aucun
+	*               prédécesseur ne borne son début, et à oméga si aucun
+	*               successeur ne borne sa fin.
+	*               En cas d'échec, ce qui a été pris dans l'arène y reste :
+	*               l'appelant libère l'arène.
 	*/
-TypGraphePERT* creerGraphePERT(TypTache **taches, int nbTaches) {
+TypGraphePERT* creerGraphePERT(TypArene *arene, TypTache **taches, int *duree, int nbTaches) {
 	TypGraphePERT *graphePERT;               /* Le graphe PERT créé */
 	TypGraphe     *graphe;                   /* Le graphe associé */
+	TypGraphe     *inverse;                  /* Le graphe des prédécesseurs */
 	TypTache      *tacheDepart;              /* La tâche alpha de départ */
 	TypTache      *tacheArrivee;             /* La tâche oméga d'arrivée */
-	char          *dependances;               /* Les dépendances d'une tâche */
+	const char    *dependance;               /* Le nom d'une dépendance */
+	size_t        longueur;                  /* Longueur de ce nom */
     char          *dependancesOmega;         /* Dépendances de la tâche oméga */
-    char          *tmp;
+	size_t        tailleOmega;               /* Taille de ces dépendances */
 	int           sommet;                    /* Le numéro d'un sommet */
-	bool          sansSuccesseur[nbTaches];  /* si [i] = true, alors la tâche i+1 
-												est à relier au sommet oméga */
+	int           *derniereTache;            /* Dernière tâche reliée à chaque
+	                                            sommet (dépendances en double) */
+	int           *debutPred;                /* Début des prédécesseurs de
+	                                            chaque tâche dans pred */
+	int           *pred;                     /* Prédécesseurs résolus */
+	int           *liens;                    /* Code de chaque dépendance */
+	int           lien;                      /* Code de la dépendance lue */
+	int           nbPred;                    /* Nombre de prédécesseurs */
+	int           capacitePred;              /* Taille allouée de pred */
+	bool          *sansSuccesseur;           /* si [i] = true, alors la tâche i+1 
+												est à relier au sommet oméga
+												(aucun successeur ne borne
+												sa fin) */
+	bool          borne;                     /* true si un prédécesseur borne
+	                                            le début de la tâche */
+	bool          valide;                    /* false si une tâche est inconnue */
 	int           i;                         /* Permet le parcours des boucles */
 	int           j;                         /* Permet le parcours des boucles */
 	
-	/* Initialisation du tableau sansSuccesseur */
-	for (i = 0; i <= nbTaches - 1; i++) {
-		sansSuccesseur[i] = true;
+	graphePERT = allouerArene(arene,sizeof(TypGraphePERT));
+	graphePERT->arene = arene;
+	graphePERT->taches = taches;
+	graphePERT->duree = duree;
+	graphePERT->texte = NULL;
+	graphePERT->tailleTexte = 0;
+	graphePERT->texteProjete = false;
+	graphePERT->datesCalculees = false;
+	graphePERT->liensTypes = false;
+	graphePERT->sommeDurees = 0;
+	
+	/* Index des noms : deux cases par tâche au moins */
+	graphePERT->tailleTableNoms = 1;
+	while (graphePERT->tailleTableNoms < 2 * (nbTaches + 1)) {
+		graphePERT->tailleTableNoms *= 2;
+	}
+	graphePERT->tableNoms = allouerAreneZero(arene,graphePERT->tailleTableNoms * sizeof(TypEntreeNom));
+	
+	valide = true;
+	for (i = 1; i <= nbTaches && valide; i++) {
+		/* Un nom déjà présent sur le chemin de sondage est un doublon */
+		longueur = strlen(taches[i-1]->nom);
+		j = hacherNom(taches[i-1]->nom,longueur) & (graphePERT->tailleTableNoms - 1);
+		while (valide && graphePERT->tableNoms[j].sommet != 0) {
+			valide = (strcmp(graphePERT->tableNoms[j].nom,taches[i-1]->nom) != 0);
+			j = (j + 1) & (graphePERT->tailleTableNoms - 1);
+		}
+		graphePERT->tableNoms[j].nom = taches[i-1]->nom;
+		graphePERT->tableNoms[j].sommet = i;
+	}
+	
+	/* Résolution des dépendances avant toute construction : les
+	   prédécesseurs de i sont pred[debutPred[i-1]] à pred[debutPred[i]-1],
+	   sans doublon, et liens[j] est le code de la dépendance pred[j] */
+	debutPred = malloc((nbTaches + 1) * sizeof(int));
+	capacitePred = nbTaches + 1;
+	pred = malloc(capacitePred * sizeof(int));
+	liens = malloc(capacitePred * sizeof(int));
+	derniereTache = calloc(nbTaches + 1, sizeof(int));
+	nbPred = 0;
+	for (i = 1; i <= nbTaches && valide; i++) {
+		debutPred[i-1] = nbPred;
+		dependance = dependanceSuivante(taches[i-1]->dependances,&longueur);
+		while (dependance != NULL && valide) {
+			sommet = chercherDependance(graphePERT,dependance,longueur,&lien);
+			valide = (sommet != 0);
+			if (valide && derniereTache[sommet] != i) {
+				derniereTache[sommet] = i;
+				if (nbPred == capacitePred) {
+					capacitePred *= 2;
+					pred = realloc(pred,capacitePred * sizeof(int));
+					liens = realloc(liens,capacitePred * sizeof(int));
+				}
+				pred[nbPred] = sommet;
+				liens[nbPred++] = lien;
+				if (lien != LIEN_SIMPLE) {
+					graphePERT->liensTypes = true;
+				}
+				graphePERT->sommeDurees += llabs(DECALAGE_LIEN(lien));
+			}
+			else if (valide) {
+				/* Une tâche citée deux fois doit l'être avec le même lien */
+				for (j = debutPred[i-1]; pred[j] != sommet; j++);
+				valide = (liens[j] == lien);
+			}
+			dependance = dependanceSuivante(dependance + longueur,&longueur);
+		}
 	}
+	debutPred[nbTaches] = nbPred;
+	free(derniereTache);
 	
-	/* Création du graphe associé au graphe PERT */
-	graphe = creerGraphe(nbTaches + 2);
+	/* Les dates doivent tenir dans un int (voir DUREE_MAX_CHANTIER) */
+	for (i = 0; i < nbTaches && valide; i++) {
+		valide = (duree[i] >= 0);
+		graphePERT->sommeDurees += duree[i];
+	}
+	valide = valide && graphePERT->sommeDurees <= DUREE_MAX_CHANTIER;
+	
+	if (! valide) {
+		free(debutPred);
+		free(pred);
+		free(liens);
+		return NULL;
+	}
+	
+	/* Création du graphe associé au graphe PERT et de son inverse */
+	graphe = creerGrapheArene(nbTaches + 2,arene);
+	inverse = creerGrapheArene(nbTaches + 2,arene);
+	graphePERT->graphe = graphe;
+	graphePERT->grapheInverse = inverse;
 	
 	/* Création des sommets */
 	for (i = 1; i <= nbTaches + 2; i++) {
 		insertionSommet(graphe,i);
+		insertionSommet(inverse,i);
 	}
 	
-	/* Création des tâches alpha et oméga */
-	tacheDepart = creerTache(sommetEnTache(nbTaches+1),"",0,"");
-	tacheArrivee = creerTache(sommetEnTache(nbTaches+2),"",0,"");
+	/* Création des tâches alpha et oméga, de durée nulle */
+	tacheDepart = creerTache(arene,"alpha","","");
+	tacheArrivee = creerTache(arene,"omega","","");
+	duree[nbTaches] = 0;
+	duree[nbTaches+1] = 0;
 	
 	/* Création des arêtes */
+	sansSuccesseur = malloc(nbTaches * sizeof(bool));
+	for (i = 0; i <= nbTaches - 1; i++) {
+		sansSuccesseur[i] = true;
+	}
+	
 	for (i = 1; i <= nbTaches; i++) {
-		j = 0;
-		dependances = taches[i-1]->dependances;
-		
-		while (dependances[j] != '\0') {
-			sommet = tacheEnSommet(dependances[j]);
-			insertionAreteOriente(graphe,sommet,i,taches[sommet-1]->duree);
-			sansSuccesseur[sommet-1] = false;
-			j++;
+		borne = false;
+		for (j = debutPred[i-1]; j < debutPred[i]; j++) {
+			sommet = pred[j];
+			ajouterArete(graphePERT,sommet,i,liens[j]);
+			if (borneFin(liens[j])) {
+				sansSuccesseur[sommet-1] = false;
+			}
+			borne = borne || borneDebut(liens[j]);
 		}
 		
-		/* Si la tâche n'a pas de prédecesseur, on la relie à alpha */
-		if (j == 0) {
-			insertionAreteOriente(graphe,nbTaches+1,i,0);
+		/* Si la tâche n'a pas de prédecesseur (ou aucun qui la fasse
+		   commencer après le début du chantier), on la relie à alpha */
+		if (! borne) {
+			ajouterArete(graphePERT,nbTaches+1,i,LIEN_SIMPLE);
 		}
 	}
+	free(debutPred);
+	free(pred);
+	free(liens);
 	
 	/* On relie les tâches sans successeurs au sommet oméga */
-    tmp = malloc(255 * sizeof(char));
-    j = 0;
+	tailleOmega = 1;
 	for (i = 0; i <= nbTaches - 1; i++) {
 		if (sansSuccesseur[i] == true) {
-			insertionAreteOriente(graphe,i+1,nbTaches+2,taches[i]->duree);
-            tmp[j] = taches[i]->nom;
-            j++;
+			tailleOmega += strlen(taches[i]->nom) + 2;
+		}
+	}
+    dependancesOmega = allouerArene(arene,tailleOmega * sizeof(char));
+    dependancesOmega[0] = '\0';
+    tailleOmega = 0;
+	for (i = 0; i <= nbTaches - 1; i++) {
+		if (sansSuccesseur[i] == true) {
+			ajouterArete(graphePERT,i+1,nbTaches+2,LIEN_SIMPLE);
+			if (tailleOmega > 0) {
+				strcpy(dependancesOmega + tailleOmega,", ");
+				tailleOmega += 2;
+			}
+			strcpy(dependancesOmega + tailleOmega,taches[i]->nom);
+			tailleOmega += strlen(taches[i]->nom);
 		}
 	}
-    dependancesOmega = malloc(strlen(tmp)+1 * sizeof(char));
-    strcpy(dependancesOmega,tmp);
     tacheArrivee->dependances = dependancesOmega;
-    free(tmp);
+	free(sansSuccesseur);
 	
 	/* On ajoute les tâches alpha et oméga au tableau des tâches */
-	taches = realloc(taches,(nbTaches+2) * sizeof(TypTache));
 	taches[nbTaches] = tacheDepart;
 	taches[nbTaches+1] = tacheArrivee;
 	
-	/* Création du graphe PERT */
-	graphePERT = malloc(sizeof(TypGraphePERT));
-	graphePERT->graphe = graphe;
-	graphePERT->taches = taches;
+	graphePERT->dureeOptimiste = allouerArene(arene,(nbTaches+2) * sizeof(int));
+	graphePERT->dureePessimiste = allouerArene(arene,(nbTaches+2) * sizeof(int));
+	memcpy(graphePERT->dureeOptimiste,duree,(nbTaches+2) * sizeof(int));
+	memcpy(graphePERT->dureePessimiste,duree,(nbTaches+2) * sizeof(int));
+	graphePERT->dateTot = allouerAreneZero(arene,(nbTaches+2) * sizeof(int));
+	graphePERT->dateTard = allouerAreneZero(arene,(nbTaches+2) * sizeof(int));
+	graphePERT->ordreTopo = allouerArene(arene,(nbTaches+2) * sizeof(int));
+	graphePERT->rangTopo = allouerArene(arene,(nbTaches+2) * sizeof(int));
+	graphePERT->margeTotale = allouerAreneZero(arene,(nbTaches+2) * sizeof(int));
+	graphePERT->margeLibre = allouerAreneZero(arene,(nbTaches+2) * sizeof(int));
+	graphePERT->margeIndependante = allouerAreneZero(arene,(nbTaches+2) * sizeof(int));
+	if (ordreTopologique(graphePERT) == CIRCUIT) {
+		return NULL;
+	}
 	
 	return graphePERT;
 }
@@ -150,484 +315,804 @@ TypGraphePERT* creerGraphePERT(TypTache **taches, int nbTaches) {
 	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
 	*
 	* Description : Supprime le graphe PERT passé en paramètre. Toute la
-	*				mémoire qui lui avait été allouée est libérée.
+	*				mémoire qui lui avait été allouée est libérée : le texte
+	*				lu, puis l'arène qui contient tout le reste (tâches,
+	*				listes d'adjacence, tables et le graphe lui-même).
 	*/
 void deleteGraphePERT(TypGraphePERT *graphePERT) {
-	int i;
-  
-	/* Libération de la mémoire occupée par les tâches */
-	for (i = 0; i < graphePERT->graphe->nbrMaxSommets; i++) {
-	  free(graphePERT->taches[i]);
+	libererTexte(graphePERT->texte,graphePERT->tailleTexte,graphePERT->texteProjete);
+	deleteArene(graphePERT->arene);
+}
+
+
+	/*
+	* Fonction : chercherTache
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              const char *nom, le nom d'une tâche
+	*
+	* Retour : int, le sommet de la tâche, ou -1 si aucune tâche ne porte
+	*              ce nom (alpha et oméga ne sont pas cherchées)
+	*/
+int chercherTache(TypGraphePERT *graphePERT, const char *nom) {
+	int sommet;
+
+	sommet = chercherNom(graphePERT,nom,strlen(nom));
+
+	return (sommet != 0) ? sommet : -1;
+}
+
+
+	/*
+	* Fonction : ecartLien
+	*
+	* Paramètres : int lien, le code d'une dépendance P -> T (voir LIEN)
+	*              int dureeAvant, la durée de P
+	*              int dureeApres, la durée de T
+	*
+	* Retour : int, l'écart minimal entre le début de P et celui de T
+	*             (négatif si T peut commencer avant P)
+	*/
+int ecartLien(int lien, int dureeAvant, int dureeApres) {
+	switch (TYPE_LIEN(lien)) {
+		case LIEN_DEBUT_DEBUT :
+			return DECALAGE_LIEN(lien);
+		case LIEN_FIN_FIN :
+			return dureeAvant - dureeApres + DECALAGE_LIEN(lien);
+		case LIEN_DEBUT_FIN :
+			return DECALAGE_LIEN(lien) - dureeApres;
+		default :
+			return dureeAvant + DECALAGE_LIEN(lien);
 	}
-	free(graphePERT->taches);
-	
-	/* Suppression du graphe associé */
-	deleteGraphe(graphePERT->graphe);
-	
-	/* Libération de la mémoire occupée par le graphe PERT */
-	free(graphePERT);
 }
 
 
+
 	/*
 	* Fonction : calculDates
 	*
 	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
 	*
 	* Description : Calcule les dates au plus tôt et au plus tard 
-	*				de toutes les tâches du graphe PERT passé en paramètre
+	*				de toutes les tâches du graphe PERT passé en paramètre.
+	*				Les sommets sont parcourus une fois dans l'ordre
+	*				topologique puis une fois dans l'ordre inverse.
+	*				Les marges sont calculées dans la foulée.
+	*				Rien n'est refait si les dates sont déjà à jour (chantier
+	*				compilé avec ses dates, ou déjà calculé : majDates les
+	*				tient ensuite à jour).
+	*				Un graphe à circuit n'a pas de dates : elles ne sont
+	*				pas calculées (creerGraphePERT refuse un tel graphe).
 	*/
 void calculDates(TypGraphePERT *graphePERT) {
-	calculDatesAuPlusTot(graphePERT,graphePERT->graphe->nbrMaxSommets-1);
+	if (graphePERT->datesCalculees || ordreTopologique(graphePERT) == CIRCUIT) {
+		return;
+	}
+	calculDatesAuPlusTot(graphePERT);
 	calculDatesAuPlusTard(graphePERT);
+	calculMarges(graphePERT);
+	graphePERT->datesCalculees = true;
 }
 
 
 	/*
-	* Fonction : calculDatesAuPlusTot
+	* Fonction : majDates
 	*
 	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
-	*              int sommetDepart, le numéro du sommet de départ
-	*
-	* Description : Calcule les dates au plus tôt d'un graphe de toutes les
-	*				tâches du graphe PERT passé en paramètre.
-	*				Pour faire cela, on implémente l'algo de Bellman-Ford dans
-	*				sa version de calcul de plus long chemin à origine unique.
-	*/
-static void calculDatesAuPlusTot(TypGraphePERT *graphePERT, int sommetDepart) {
-	TypGraphe *graphe;   /* Le graphe associé au graphe PERT */
-	TypTache  **taches;  /* Les tâches associées au graphe PERT */
-	int       nbSommets; /* Le nombre de sommets du graphe */
-	int       i;         /* Permet le parcours des sommets du graphe */
-	int       j;         /* Permet le parcours des sommets du graphe */
-	int       nbIter;    /* Le nombre d'itérations de la boucle effectué */
-	bool      modif;     /* false si aucune nouvelle date n'a été calculée */
-	
-	graphe = graphePERT->graphe;
-	taches = graphePERT->taches;
-	nbSommets = graphe->nbrMaxSommets;
+	*                  dont les dates ont été calculées
+	*              TypModification *modifications, tableau de modifications
+	*                  (durées changées, dépendances ajoutées ou supprimées)
+	*              int nbModifications, la taille du tableau modifications
+	*
+	* Retour : int, 0 si toutes les modifications sont appliquées sinon
+	*             le code d'erreur de la première modification refusée
+	*             (voir erreurs.h). Les modifications qui la précèdent
+	*             restent appliquées et les dates sont à jour.
+	*
+	* Description : Applique les modifications au graphe PERT puis met à
+	*               jour les dates sans tout recalculer : les dates au plus
+	*               tôt ne sont recalculées qu'en aval des modifications,
+	*               dans l'ordre topologique, et les dates au plus tard
+	*               qu'en amont, dans l'ordre inverse. La propagation
+	*               s'arrête dès qu'une date ne change plus.
+	*               Si la fin du chantier change, toutes les dates au plus
+	*               tard sont décalées d'autant. Les marges sont ensuite
+	*               recalculées.
+	*/
+int majDates(TypGraphePERT *graphePERT, TypModification *modifications, int nbModifications) {
+	TypModification *modif;       /* La modification courante */
+	TypVoisins      *liste;       /* Liste d'adjacence d'un sommet */
+	TypVoisins      *vC;          /* Voisin courant lors du parcours des listes */
+	int             *tasAval;     /* Sommets dont la date au plus tôt est à revoir */
+	int             *tasAmont;    /* Sommets dont la date au plus tard est à revoir */
+	bool            *dansAval;    /* true si le sommet est dans tasAval */
+	bool            *dansAmont;   /* true si le sommet est dans tasAmont */
+	int             nbAval;       /* Taille de tasAval */
+	int             nbAmont;      /* Taille de tasAmont */
+	int             nbSommets;    /* Le nombre de sommets du graphe */
+	int             dateFin;      /* Date de fin du chantier avant modification */
+	int             date;         /* Une date recalculée */
+	int             erreur;       /* Code d'erreur renvoyé */
+	int             lien;         /* Code d'une dépendance */
+	int             s, p, v, i;
+	
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	dateFin = graphePERT->dateTot[nbSommets-1];
+	erreur = 0;
+	
+	tasAval = malloc(nbSommets * sizeof(int));
+	tasAmont = malloc(nbSommets * sizeof(int));
+	dansAval = calloc(nbSommets, sizeof(bool));
+	dansAmont = calloc(nbSommets, sizeof(bool));
+	nbAval = 0;
+	nbAmont = 0;
 	
-	/* Initialisation */
-	for (i = 1; i <= nbSommets; i++) {
-		/* Si ce n'est pas la tâche de départ (alpha) */
-		if (i != sommetDepart) {
-			taches[i-1]->dateTot = -1;
+	/* 
+	* Application des modifications. Les sommets à revoir sont seulement
+	* notés : l'ordre topologique peut encore changer.
+	*/
+	for (i = 0; i < nbModifications && erreur == 0; i++) {
+		modif = &modifications[i];
+		s = modif->sommet;
+		p = modif->predecesseur;
+		
+		/* Seules les tâches du chantier (ni alpha ni oméga) sont modifiables */
+		if (s < 1 || s > nbSommets - 2) {
+			erreur = SOMMET_INEXISTANT;
+		}
+		else if (modif->type == MODIF_DUREE) {
+			if (modif->duree < 0
+					|| graphePERT->sommeDurees - graphePERT->duree[s-1] + modif->duree > DUREE_MAX_CHANTIER) {
+				erreur = POIDS_INVALIDE;
+			}
+			else {
+				graphePERT->sommeDurees += modif->duree - graphePERT->duree[s-1];
+				graphePERT->duree[s-1] = modif->duree;
+				liste = graphePERT->graphe->listesAdjacences[s-1];
+				for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+					v = numeroVoisin(&vC);
+					lien = graphePERT->liensTypes ? poidsArete(graphePERT->grapheInverse,v,s) : LIEN_SIMPLE;
+					modifierPoidsArete(graphePERT->graphe,s,v,ecartLien(lien,modif->duree,graphePERT->duree[v-1]));
+					noterSommet(tasAval,&nbAval,dansAval,v);
+				}
+				/* Les dépendances FF et SF vers s dépendent de sa durée */
+				if (graphePERT->liensTypes) {
+					noterSommet(tasAval,&nbAval,dansAval,s);
+					liste = graphePERT->grapheInverse->listesAdjacences[s-1];
+					for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+						lien = poidsVoisin(&vC);
+						if (TYPE_LIEN(lien) == LIEN_FIN_FIN || TYPE_LIEN(lien) == LIEN_DEBUT_FIN) {
+							p = numeroVoisin(&vC);
+							modifierPoidsArete(graphePERT->graphe,p,s,ecartLien(lien,graphePERT->duree[p-1],modif->duree));
+							noterSommet(tasAmont,&nbAmont,dansAmont,p);
+						}
+					}
+				}
+				noterSommet(tasAmont,&nbAmont,dansAmont,s);
+			}
+		}
+		else if (p < 1 || p > nbSommets - 2 || p == s) {
+			erreur = SOMMET_INEXISTANT;
+		}
+		else if (modif->type == MODIF_AJOUT_DEPENDANCE) {
+			erreur = ajouterDependance(graphePERT,p,s);
+			if (erreur == 0) {
+				noterSommet(tasAval,&nbAval,dansAval,s);
+				noterSommet(tasAmont,&nbAmont,dansAmont,p);
+			}
 		}
 		else {
-			taches[i-1]->dateTot = 0;
+			if (areteExistante(graphePERT->graphe,p,s) != 0) {
+				erreur = ARETE_INEXISTANTE;
+			}
+			else {
+				delierSommets(graphePERT,p,s);
+				
+				/* Une tâche dont aucun prédécesseur ne borne le début est
+				   reliée à alpha */
+				if (!debutBorne(graphePERT,s)) {
+					relierSommets(graphePERT,nbSommets-1,s,LIEN_SIMPLE);
+				}
+				/* Une tâche dont aucun successeur ne borne la fin est
+				   reliée à oméga */
+				if (!finBornee(graphePERT,p)) {
+					relierSommets(graphePERT,p,nbSommets,LIEN_SIMPLE);
+					noterSommet(tasAval,&nbAval,dansAval,nbSommets);
+				}
+				noterSommet(tasAval,&nbAval,dansAval,s);
+				noterSommet(tasAmont,&nbAmont,dansAmont,p);
+			}
 		}
 	}
 	
-	nbIter = 1;
-	modif = true;
+	/* Les sommets notés sont rangés en tas selon l'ordre topologique */
+	i = nbAval;
+	nbAval = 0;
+	while (nbAval < i) {
+		tasInsererRang(tasAval,&nbAval,graphePERT->rangTopo,1,tasAval[nbAval]);
+	}
+	i = nbAmont;
+	nbAmont = 0;
+	while (nbAmont < i) {
+		tasInsererRang(tasAmont,&nbAmont,graphePERT->rangTopo,-1,tasAmont[nbAmont]);
+	}
 	
-	/* Calcul des dates au plus tôt de chaque tâche */
-	while ( (nbIter < nbSommets + 1) && (modif == true) ) {
-		modif = false;
+	/* Propagation des dates au plus tôt vers l'aval */
+	while (nbAval > 0) {
+		s = tasExtraireRang(tasAval,&nbAval,graphePERT->rangTopo,1);
+		dansAval[s-1] = false;
+		date = dateAuPlusTot(graphePERT,s);
 		
-		/* Pour chaque arête du graphe... */
-		for (i = 1; i <= nbSommets; i++) {
-			for (j = 1; j <= nbSommets; j++) {
-				if (areteExistante(graphe,i,j) == 0) {
-					/* 
-					* ... on regarde si un plus long chemin existe 
-					* pour le sommet d'arrivée
-					*/
-					if (taches[j-1]->dateTot < taches[i-1]->dateTot + poidsArete(graphe,i,j)) {
-						taches[j-1]->dateTot = taches[i-1]->dateTot + poidsArete(graphe,i,j);
-						modif = true;
-					}
+		if (date != graphePERT->dateTot[s-1]) {
+			graphePERT->dateTot[s-1] = date;
+			liste = graphePERT->graphe->listesAdjacences[s-1];
+			for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+				if (!dansAval[numeroVoisin(&vC)-1]) {
+					dansAval[numeroVoisin(&vC)-1] = true;
+					tasInsererRang(tasAval,&nbAval,graphePERT->rangTopo,1,numeroVoisin(&vC));
 				}
 			}
 		}
+	}
+	
+	/* 
+	* Propagation des dates au plus tard vers l'amont, par rapport à
+	* l'ancienne date de fin
+	*/
+	while (nbAmont > 0) {
+		s = tasExtraireRang(tasAmont,&nbAmont,graphePERT->rangTopo,-1);
+		dansAmont[s-1] = false;
+		date = dateAuPlusTard(graphePERT,s,dateFin);
 		
-		nbIter++;
+		if (date != graphePERT->dateTard[s-1]) {
+			graphePERT->dateTard[s-1] = date;
+			liste = graphePERT->grapheInverse->listesAdjacences[s-1];
+			for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+				if (!dansAmont[numeroVoisin(&vC)-1]) {
+					dansAmont[numeroVoisin(&vC)-1] = true;
+					tasInsererRang(tasAmont,&nbAmont,graphePERT->rangTopo,-1,numeroVoisin(&vC));
+				}
+			}
+		}
 	}
+	
+	/* Décalage des dates au plus tard si la fin du chantier a changé */
+	date = graphePERT->dateTot[nbSommets-1] - dateFin;
+	if (date != 0) {
+		for (i = 0; i < nbSommets; i++) {
+			graphePERT->dateTard[i] += date;
+		}
+	}
+	
+	free(tasAval);
+	free(tasAmont);
+	free(dansAval);
+	free(dansAmont);
+	
+	calculMarges(graphePERT);
+	
+	return erreur;
 }
 
 
 	/*
-	* Fonction : calculDatesAuPlusTard
+	* Fonction : calculMarges
 	*
 	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*                  dont les dates ont été calculées
 	*
-	* Description : Calcule les dates au plus tard d'un graphe de toutes les
-	*				tâches du graphe PERT passé en paramètre.
-	*				Cette fonction suppose avoir déjà calculé les dates au plus
-	*				tôt de toutes les tâches du graphe.
+	* Description : Calcule pour chaque sommet :
+	*               - la marge totale : date au plus tard - date au plus tôt ;
+	*               - la marge libre : retard possible sans décaler la date
+	*                 au plus tôt d'aucun successeur ;
+	*               - la marge indépendante : retard possible même si les
+	*                 prédécesseurs commencent au plus tard et que les
+	*                 successeurs commencent au plus tôt (0 si négative).
+	*               Les écarts imposés par les dépendances sont les poids
+	*               des arêtes. Les arêtes ne sont parcourues qu'une fois ;
+	*               le reste du calcul se fait par des boucles sur des
+	*               tableaux contigus.
 	*/
-static void calculDatesAuPlusTard(TypGraphePERT *graphePERT) {
-	TypGraphePERT *graphePERTInverse;  /* Le graphe PERT inversé */
-	TypTache      **taches;            /* Les tâches associées au graphe PERT */
-	TypTache      **tachesInverse;     /* Les tâches associées au graphe inversé */
-	TypGraphe     *graphe;             /* Le graphe du graphe PERT inversé avant l'inversion */
-	int           nbSommets;           /* Le nombre de sommets du graphe */
-	int           i;                   /* Permet le parcours des sommets */
+void calculMarges(TypGraphePERT *graphePERT) {
+	TypVoisins *liste;       /* Liste des successeurs d'un sommet */
+	TypVoisins *vC;          /* Successeur courant */
+	const int  *debutTot;    /* Date de début au plus tôt de chaque sommet */
+	int        *succMin;     /* Début le plus tardif qui ne décale aucun
+	                            successeur commençant au plus tôt */
+	int        *predMax;     /* Début le plus précoce permis par des
+	                            prédécesseurs commençant au plus tard */
+	int        *margeTotale;
+	int        *margeLibre;
+	int        *margeIndependante;
+	int        nbSommets;    /* Le nombre de sommets du graphe */
+	int        dateFin;      /* Date de fin du chantier */
+	int        i, v;
 	
-	taches = graphePERT->taches;
 	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	dateFin = graphePERT->dateTot[nbSommets-1];
+	debutTot = graphePERT->dateTot;
+	margeTotale = graphePERT->margeTotale;
+	margeLibre = graphePERT->margeLibre;
+	margeIndependante = graphePERT->margeIndependante;
 	
-	/* Création du graphe inversé */
-	tachesInverse = malloc((nbSommets-2) * sizeof(TypTache));
-	for (i = 0; i <= nbSommets - 3; i++) {
-		tachesInverse[i] = creerTache(taches[i]->nom,taches[i]->intitule,taches[i]->duree,taches[i]->dependances);
-	}
-	graphePERTInverse = creerGraphePERT(tachesInverse,nbSommets-2);
-	
-	graphe = graphePERTInverse->graphe;
-	graphePERTInverse->graphe = NULL;
+	succMin = malloc(nbSommets * sizeof(int));
+	predMax = malloc(nbSommets * sizeof(int));
 	
-	graphePERTInverse->graphe = grapheInverse(graphe);
+	for (i = 0; i < nbSommets; i++) {
+		margeTotale[i] = graphePERT->dateTard[i] - debutTot[i];
+	}
+	for (i = 0; i < nbSommets; i++) {
+		succMin[i] = dateFin - graphePERT->duree[i];
+		predMax[i] = 0;
+	}
 	
-	/* On calcule les dates au plus tôt du graphe inversé */
-	calculDatesAuPlusTot(graphePERTInverse,nbSommets);
+	/* Unique passage sur les arêtes */
+	for (i = 0; i < nbSommets; i++) {
+		liste = graphePERT->graphe->listesAdjacences[i];
+		for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+			v = numeroVoisin(&vC) - 1;
+			if (debutTot[v] - poidsVoisin(&vC) < succMin[i]) {
+				succMin[i] = debutTot[v] - poidsVoisin(&vC);
+			}
+			if (graphePERT->dateTard[i] + poidsVoisin(&vC) > predMax[v]) {
+				predMax[v] = graphePERT->dateTard[i] + poidsVoisin(&vC);
+			}
+		}
+	}
 	
-	/*
-	* Soit t"(i) la date au plus tard de la tâche i,
-	* t'(i) la date au plus tôt de la tâche i dans le graphe inversé,
-	* t(omega) la date de la dernière tâche du graphe.
-	*
-	* Alors : t"(i) = t(omega) - t'(i)
-	*/
-	for (i = 1; i <= nbSommets; i++) {
-		taches[i-1]->dateTard = 
-			taches[nbSommets-1]->dateTot - graphePERTInverse->taches[i-1]->dateTot;
+	for (i = 0; i < nbSommets; i++) {
+		margeLibre[i] = succMin[i] - debutTot[i];
+	}
+	for (i = 0; i < nbSommets; i++) {
+		int marge = succMin[i] - predMax[i];
+		margeIndependante[i] = (marge > 0) ? marge : 0;
 	}
 	
-	deleteGraphe(graphe);
-	deleteGraphePERT(graphePERTInverse);
+	free(succMin);
+	free(predMax);
 }
 
 
 	/*
-	* Fonction : dureeTotale
+	* Fonction : ordreTopologique
 	*
 	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
-	*              int nbOuvriers, le nombre d'ouvriers (>= 1)
 	*
-	* Retour : int, la durée totale du chantier
+	* Retour : int, 0 si tous les sommets sont ordonnés, CIRCUIT si le
+	*             graphe contient un circuit
 	*
-	* Description : Renvoie la durée totale du chantier représenté par le
-	*				graphe PERT passé en paramètre selon le nombre d'ouvriers.
+	* Description : Range les sommets dans un ordre topologique (algorithme
+	*               de Kahn) : ordreTopo[k] est le k-ième sommet et
+	*               rangTopo[sommet-1] sa position.
 	*/
-int dureeTotale(TypGraphePERT *graphePERT, int nbOuvriers) {
-	int nbTaches = graphePERT->graphe->nbrMaxSommets; /* Nombre de tâches */
+static int ordreTopologique(TypGraphePERT *graphePERT) {
+	TypVoisins *liste;      /* Liste d'adjacence d'un sommet */
+	TypVoisins *vC;         /* Voisin courant lors du parcours des listes */
+	int        *nbPred;     /* Prédécesseurs non encore ordonnés */
+	int        nbSommets;   /* Le nombre de sommets du graphe */
+	int        nbOrdonnes;  /* Nombre de sommets déjà ordonnés */
+	int        s, k;
 	
-	/* Si le nb d'ouvriers est égal au nb de tâches, le problème est trivial */
-	if (nbOuvriers >= nbTaches) {
-		return graphePERT->taches[graphePERT->graphe->nbrMaxSommets - 1]->dateTot;
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	nbPred = malloc(nbSommets * sizeof(int));
+	nbOrdonnes = 0;
+	
+	for (s = 1; s <= nbSommets; s++) {
+		nbPred[s-1] = degreSommet(graphePERT->grapheInverse,s);
+		if (nbPred[s-1] == 0) {
+			graphePERT->ordreTopo[nbOrdonnes++] = s;
+		}
 	}
-	else {
-		TypTache **taches; /* Toutes les tâches du graphe PERT */
-		TypTache **tachesTerminees; /* Tableau des tâches terminées */
-		TypTache **tachesLibres; /* Tableau des tâches libres, c'est-à-dire des
-									tâches affectables à un ouvrier */
-		TypTache **tachesNonLibres; /* Tableau des tâches ni commencées 
-										ni libres */
-		TypTacheEnCours **tachesEnCours; /* Tableau des tâches en cours 
-											de réalisation */
-		int nbTachesTerminees; /* Nb de tâches terminées */
-		int nbTachesEnCours; /* Nb de tâches en cours */
-		int nbTachesLibres; /* Nb de tâches libres */
-		int nbTachesNonLibres; /* Nb de tâches non libres */
-		int dureeTotale; /* Durée totale du chantier (résultat à renvoyer) */
-		int i;  /* Indice de parcours des boucles */
-		
-		taches = graphePERT->taches;
-		tachesTerminees = malloc(nbTaches * sizeof(TypTache));
-		nbTachesTerminees = 0;
-		tachesLibres = malloc(nbTaches * sizeof(TypTache));
-		nbTachesLibres = 0;
-		tachesNonLibres = malloc(nbTaches * sizeof(TypTache));
-		nbTachesNonLibres = 0;
-		tachesEnCours = malloc(nbTaches * sizeof(TypTacheEnCours));
-		nbTachesEnCours = 0;
-		
-		dureeTotale = 0;
-		
-		/* 
-		* Initialisation : on affecte la tache de départ à un ouvrier,
-		* et on range les autres tâches dans tachesNonLibres
-		*/ 
-		tachesEnCours[0] = creerTacheEnCours(taches[nbTaches-2]);
-		nbTachesEnCours = 1;
+	
+	for (k = 0; k < nbOrdonnes; k++) {
+		s = graphePERT->ordreTopo[k];
+		graphePERT->rangTopo[s-1] = k;
 		
-		for (i = 0; i <= nbTaches - 1; i++) {
-			if (i != nbTaches - 2) {
-				tachesNonLibres[nbTachesNonLibres] = taches[i];
-				nbTachesNonLibres++;
+		liste = graphePERT->graphe->listesAdjacences[s-1];
+		for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+			nbPred[numeroVoisin(&vC)-1]--;
+			if (nbPred[numeroVoisin(&vC)-1] == 0) {
+				graphePERT->ordreTopo[nbOrdonnes++] = numeroVoisin(&vC);
 			}
 		}
-		
-		/* Tant que toutes les tâches ne sont pas terminées */
-		while (nbTachesTerminees != nbTaches) {
-			int dureeRestante; /* La durée restante de la tâche qui se termine */
-			
-			/* 
-			* On considère que la prochaine tâche qui va se terminer est en
-			* tête (position 0) du tableau des tâches en cours. Cette tâche
-			* est retirée de tachesEnCours est est ajoutée à tachesTerminees.
-			*
-			* On ajoute la durée restante de cette tâche à la durée totale.
-			*/
-			tachesTerminees[nbTachesTerminees] = tachesEnCours[0]->tache;
-			nbTachesTerminees++;
-			dureeRestante = tachesEnCours[0]->dureeRestante;
-            if (nbTachesEnCours > 1) {
-                tachesEnCours[0] = tachesEnCours[nbTachesEnCours-1];
-            }
-			nbTachesEnCours--;
-			dureeTotale += dureeRestante;
-			
-			/* On calcule la durée restante des tâches en cours restantes */
-			decompteDuree(tachesEnCours,nbTachesEnCours,dureeRestante);
-			
-			/* 
-			* On ajoute à tachesLibres d'éventuelles nouvelles tâches libres,
-			* c'est-à-dire les tâches non libres dont toutes les tâches dont
-			* elles dépendent sont terminées
-			*/
-			chercheTachesLibres(tachesNonLibres,tachesLibres,tachesTerminees,
-				&nbTachesNonLibres,&nbTachesLibres,nbTachesTerminees);
-				
-			/* On affecte des tâches libres à des ouvriers */
-			affecteTaches(tachesLibres,tachesEnCours,
-				&nbTachesLibres,&nbTachesEnCours,nbOuvriers);
-            
-			/* 
-			* Tri du tableau des tâches en cours dans l'ordre croissant
-			* des durées de réalisation restantes. Cela permet d'avoir
-			* en tête la prochaine tâche qui se termine.
-			*/
-			triTachesEnCours(tachesEnCours,nbTachesEnCours);
-		}
-		
-		return dureeTotale;
 	}
+	
+	free(nbPred);
+	
+	return (nbOrdonnes == nbSommets) ? 0 : CIRCUIT;
 }
 
 
 	/*
-	* Fonction : creerTacheEnCours
+	* Fonction : calculDatesAuPlusTot
 	*
-	* Paramètres : TypTache *tache, la tâche qui va être réalisée
-    *
-    * Retour : TypTacheEnCours, la nouvelle structure
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
 	*
-	* Description : Crée une structure de type TypTacheEnCours, lui alloue
-    *               la mémoire et la renvoie.
+	* Description : Calcule les dates au plus tôt de toutes les tâches du
+	*				graphe PERT passé en paramètre. Les sommets étant parcourus
+	*				dans l'ordre topologique, les dates de tous leurs
+	*				prédécesseurs sont déjà connues (plus long chemin depuis
+	*				alpha dans un graphe sans circuit).
 	*/
-static TypTacheEnCours* creerTacheEnCours(TypTache* tache) {
-	TypTacheEnCours* tacheEnCours; /* La nouvelle tacheEnCours */
-    
-    tacheEnCours = malloc(sizeof(TypTacheEnCours));
-    tacheEnCours->tache = tache;
-    tacheEnCours->dureeRestante = tache->duree;
-    
-    return tacheEnCours;
+static void calculDatesAuPlusTot(TypGraphePERT *graphePERT) {
+	int k;  /* Permet le parcours des sommets */
+	int s;  /* Le sommet courant */
+	
+	for (k = 0; k < graphePERT->graphe->nbrMaxSommets; k++) {
+		s = graphePERT->ordreTopo[k];
+		graphePERT->dateTot[s-1] = dateAuPlusTot(graphePERT,s);
+	}
 }
 
 
 	/*
-	* Fonction : decompteDuree
+	* Fonction : calculDatesAuPlusTard
 	*
-	* Paramètres : TypTacheEnCours **tachesEC, tableau des 
-	*					tâches en cours de réalisation.
-	*              int nbTachesEC, nb de taches en cours de réalisation.
-	*              int duree, durée à décompter.
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
 	*
-	* Description : Soustrait à la durée restante de chacune des tâches en
-	*               cours la durée passée en paramètre
+	* Description : Calcule les dates au plus tard d'un graphe de toutes les
+	*				tâches du graphe PERT passé en paramètre, en parcourant
+	*				les sommets dans l'ordre topologique inverse.
+	*				Cette fonction suppose avoir déjà calculé les dates au plus
+	*				tôt de toutes les tâches du graphe.
 	*/
-static void decompteDuree(TypTacheEnCours **tachesEC,int nbTachesEC,int duree) {
-    int      i;                /* indice de parcours */
-
-	for(i = 1; i <= nbTachesEC; i++){
-		
-		tachesEC[i]->dureeRestante = tachesEC[i]->dureeRestante - duree;
-		
+static void calculDatesAuPlusTard(TypGraphePERT *graphePERT) {
+	int nbSommets;  /* Le nombre de sommets du graphe */
+	int dateFin;    /* Date de fin du chantier (date de la tâche oméga) */
+	int k;          /* Permet le parcours des sommets */
+	int s;          /* Le sommet courant */
+	
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	dateFin = graphePERT->dateTot[nbSommets-1];
+	
+	for (k = nbSommets - 1; k >= 0; k--) {
+		s = graphePERT->ordreTopo[k];
+		graphePERT->dateTard[s-1] = dateAuPlusTard(graphePERT,s,dateFin);
 	}
 }
 
 
 	/*
-	* Fonction : chercheTachesLibres
+	* Fonction : dateAuPlusTot
 	*
-	* Paramètres : TypTache **tachesNL, tableau de tâches non libres.
-	*              TypTache **tachesL, tableau de tâches libres.
-	*              TypTache **tachesT, tableau des tâches terminées.
-	*              int *nbTachesNL, nb de tâches non libres.
-	*              int *nbTachesL, nb de tâches libres.
-	*              int nbTachesT, nb de tâches terminées.
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int sommet, un sommet du graphe
 	*
-	* Description : Ajoute à tachesL et supprime de taches NL l'ensemble des
-	*               tâches non libres dont tous les prédécesseurs ont terminé
-	*               leur tâche. Les entiers nbTachesNL et nbTachesL sont
-	*               susceptibles d'être modifiés.
+	* Retour : int, la date au plus tôt du sommet, calculée à partir de
+	*             celles de ses prédécesseurs et des écarts qu'imposent
+	*             les dépendances (0 s'il n'en a pas : aucune tâche ne
+	*             commence avant le début du chantier)
 	*/
-static void chercheTachesLibres(TypTache **tachesNL,TypTache **tachesL,
-		TypTache **tachesT,int *nbTachesNL,int *nbTachesL, int nbTachesT) {
+static int dateAuPlusTot(TypGraphePERT *graphePERT, int sommet) {
+	const int  *dateTot;  /* Dates au plus tôt des sommets */
+	const int  *duree;    /* Durées des sommets */
+	TypVoisins *liste;    /* Liste des prédécesseurs du sommet */
+	TypVoisins *vC;       /* Prédécesseur courant */
+	int        date;      /* La date calculée */
+	int        ecart;     /* Écart imposé par la dépendance courante */
+	int        p;         /* Indice du prédécesseur courant */
 	
-	int i, j; /* Permettent le parcours des boucles */
+	dateTot = graphePERT->dateTot;
+	duree = graphePERT->duree;
+	liste = graphePERT->grapheInverse->listesAdjacences[sommet-1];
+	date = 0;
 	
-	i = 0;
-	
-	while (i <= *nbTachesNL - 1) {
-		TypTache *tacheNL;  /* Une tâche non libre */
-		char dependances[50];  /* Les dépendances de la tâche */
-		int nbDependancesT; /* Nb de dépendances terminées */
-        
-		tacheNL = tachesNL[i];
-        strcpy(dependances,tacheNL->dependances);
-		nbDependancesT = 0;
-		
-		for (j = 0; j <= nbTachesT - 1; j++) {
-			TypTache *tacheT;
-			
-			tacheT = tachesT[j];
-			/* Si la tâche terminée est une dépendance de tacheNL */
-			if (strchr(dependances,tacheT->nom) != NULL) {
-				nbDependancesT++;
-			}
+	for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+		p = numeroVoisin(&vC) - 1;
+		ecart = (poidsVoisin(&vC) == LIEN_SIMPLE) ? duree[p]
+		        : ecartLien(poidsVoisin(&vC),duree[p],duree[sommet-1]);
+		if (dateTot[p] + ecart > date) {
+			date = dateTot[p] + ecart;
 		}
-		
-		/* 
-		* Si toutes les dépendances de tacheNL sont terminées, alors on peut
-		* l'ajouter au tableau des tâches libres, et la supprimer des tâches
-		* non libres
-		*/
-		if (nbDependancesT == strlen(dependances)) {
-			TypTache *tmp; /* Permet l'échange de tâches dans tachesNL */
-			
-			tachesL[*nbTachesL] = tacheNL;
-			(*nbTachesL)++;
-			
-            tachesNL[i] = tachesNL[*nbTachesNL-1];
-            (*nbTachesNL)--;
+	}
+	
+	return date;
+}
+
+
+	/*
+	* Fonction : dateAuPlusTard
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int sommet, un sommet du graphe
+	*              int dateFin, la date de fin du chantier
+	*
+	* Retour : int, la date au plus tard du sommet, calculée à partir de
+	*             celles de ses successeurs, moins l'écart qu'impose chaque
+	*             dépendance (le sommet finit au plus tard à dateFin)
+	*/
+static int dateAuPlusTard(TypGraphePERT *graphePERT, int sommet, int dateFin) {
+	const int  *dateTard; /* Dates au plus tard des sommets */
+	TypVoisins *liste;    /* Liste des successeurs du sommet */
+	TypVoisins *vC;       /* Successeur courant */
+	int        date;      /* La date calculée */
+	
+	dateTard = graphePERT->dateTard;
+	liste = graphePERT->graphe->listesAdjacences[sommet-1];
+	
+	date = dateFin - graphePERT->duree[sommet-1];
+	for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+		if (dateTard[numeroVoisin(&vC)-1] - poidsVoisin(&vC) < date) {
+			date = dateTard[numeroVoisin(&vC)-1] - poidsVoisin(&vC);
 		}
-		else {
-			i++;
+	}
+	
+	return date;
+}
+
+
+	/*
+	* Fonction : ajouterDependance
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int predecesseur, le sommet dont dépendra sommet
+	*              int sommet, le sommet qui reçoit la dépendance
+	*
+	* Retour : int, 0 si la dépendance est ajoutée sinon un code d'erreur
+	*             (ARETE_EXISTANTE, CIRCUIT, ERREUR_MEMOIRE)
+	*
+	* Description : Ajoute l'arête predecesseur -> sommet et retire les
+	*               arêtes alpha -> sommet et predecesseur -> oméga devenues
+	*               inutiles. Si l'ordre topologique n'est plus respecté,
+	*               seuls les sommets compris entre les deux rangs sont
+	*               réordonnés (algorithme de Pearce et Kelly).
+	*/
+static int ajouterDependance(TypGraphePERT *graphePERT, int predecesseur, int sommet) {
+	int nbSommets;  /* Le nombre de sommets du graphe */
+	int erreur;     /* Code d'erreur renvoyé */
+	
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	
+	if (areteExistante(graphePERT->graphe,predecesseur,sommet) == 0) {
+		return ARETE_EXISTANTE;
+	}
+	
+	if (graphePERT->rangTopo[predecesseur-1] > graphePERT->rangTopo[sommet-1]) {
+		erreur = reordonner(graphePERT,predecesseur,sommet);
+		if (erreur != 0) {
+			return erreur;
 		}
 	}
+	
+	relierSommets(graphePERT,predecesseur,sommet,LIEN_SIMPLE);
+	
+	if (areteExistante(graphePERT->graphe,nbSommets-1,sommet) == 0) {
+		delierSommets(graphePERT,nbSommets-1,sommet);
+	}
+	if (areteExistante(graphePERT->graphe,predecesseur,nbSommets) == 0) {
+		delierSommets(graphePERT,predecesseur,nbSommets);
+	}
+	
+	return 0;
 }
 
 
 	/*
-	* Fonction : affecteTaches
+	* Fonction : reordonner
 	*
-	* Paramètres : TypTache **tachesL, tableau de tâches libres trié dans
-	*                  l'ordre croissant de leur durée restante
-	*              TypTacheEnCours **tachesEC, tableau de tâches en cours.
-	*              int *nbTachesL, nb de tâches libres.
-	*              int *nbTachesEC, nb de tâches en cours.
-	*              int nbOuvriers, le nombre d'ouvriers.
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int predecesseur, int sommet, l'arête predecesseur ->
+	*                  sommet qui va être ajoutée, avec
+	*                  rang(predecesseur) > rang(sommet)
 	*
-	* Description : Affecte des ouvriers à des tâches : déplace de tachesL à
-	*               tachesEC certaines tâches. Le choix des tâches à affecter
-	*               se fait selon l'ordre suivant :
-	*               1. Une tâche se situe dans le chemin critique.
-	*               2. Tâche dont la date au plus tard est la plus éloignée
-	*                  de la fin du chantier
+	* Retour : int, 0 si l'ordre a été corrigé, CIRCUIT si l'arête
+	*             fermerait un circuit, ERREUR_MEMOIRE (l'ordre est alors
+	*             inchangé)
 	*
-	*               Les 2 entiers nbTachesL et nbTachesEC sont susceptibles
-	*               d'être modifiés.
+	* Description : Corrige l'ordre topologique du graphe avec
+	*               reordonnerRangs.
 	*/
-static void affecteTaches(TypTache **tachesL,TypTacheEnCours **tachesEC,
-								int *nbTachesL,int *nbTachesEC,int nbOuvriers) {
+static int reordonner(TypGraphePERT *graphePERT, int predecesseur, int sommet) {
+	TypReordonnement reordonnement;  /* Ordre du graphe et zones de travail */
+	int              nbSommets;      /* Le nombre de sommets du graphe */
+	int              erreur;         /* Code d'erreur renvoyé */
 	
-	int i;  /* Permet le parcours des tâches libres */
-	TypTache *tacheL;  /* Une tâche libre */
-	bool choixCCTermine; /* true si il n'y a plus de tâche libre 
-							se trouvant sur le chemin critique */
-	int indDateMin;  /* indice de la date au + tard la plus faible */
-							
-	i = 0;
-	choixCCTermine = false;
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
 	
-	/* 
-	* La boucle s'arrête soit lorsque tous les ouvriers ont été affectés à une
-	* tâche, soit lorsqu'il n'y a plus de tâche libre
+	reordonnement.ordreTopo = graphePERT->ordreTopo;
+	reordonnement.rangTopo = graphePERT->rangTopo;
+	reordonnement.vu = calloc(nbSommets, sizeof(int));
+	reordonnement.parcours = 1;
+	reordonnement.pile = malloc(nbSommets * sizeof(int));
+	reordonnement.rangsAval = malloc(nbSommets * sizeof(int));
+	reordonnement.rangsAmont = malloc(nbSommets * sizeof(int));
+	reordonnement.rangs = malloc(nbSommets * sizeof(int));
+	reordonnement.voisins = malloc(nbSommets * sizeof(int));
+	reordonnement.sommets = malloc(nbSommets * sizeof(int));
+	reordonnement.listerVoisins = voisinsPERT;
+	reordonnement.contexte = graphePERT;
+	
+	if (reordonnement.vu == NULL || reordonnement.pile == NULL || reordonnement.rangsAval == NULL
+	    || reordonnement.rangsAmont == NULL || reordonnement.rangs == NULL
+	    || reordonnement.voisins == NULL || reordonnement.sommets == NULL) {
+		erreur = ERREUR_MEMOIRE;
+	} else {
+		erreur = reordonnerRangs(&reordonnement,predecesseur,sommet);
+	}
+	
+	free(reordonnement.vu);
+	free(reordonnement.pile);
+	free(reordonnement.rangsAval);
+	free(reordonnement.rangsAmont);
+	free(reordonnement.rangs);
+	free(reordonnement.voisins);
+	free(reordonnement.sommets);
+	
+	return erreur;
+}
+
+
+	/*
+	* Fonction : voisinsPERT
+	*
+	* Paramètres : void *contexte, pointeur sur le TypGraphePERT
+	*              int sommet, un sommet du graphe
+	*              bool successeurs, true pour les successeurs, false pour
+	*                  les prédécesseurs
+	*              int *voisins, tableau d'au moins nbSommets entiers
+	*
+	* Retour : int, le nombre de voisins, rangés dans voisins
+	*
+	* Description : Lecture des voisins pour reordonnerRangs.
 	*/
-	while ((nbOuvriers != *nbTachesEC) && (*nbTachesL > 0)) {
-		tacheL = tachesL[i];
-        
-        if (choixCCTermine == false) {
-        
-            /* 
-			* Si la tâche libre se trouve sur le chemin critique alors on
-			* l'affecte à un ouvrier
-			*/
-			if (tacheL->dateTot == tacheL->dateTard) {
-				tachesL[i] = tachesL[*nbTachesL - 1];
-				(*nbTachesL)--;
-				tachesEC[*nbTachesEC] = creerTacheEnCours(tacheL);
-				(*nbTachesEC)++;
-                
-                /*
-                * Si on a fini de parcourir toutes les tâches libres une première
-                * fois, alors on est sûr qu'il n'y a plus de tâche libre se
-                * trouvant sur le chemin critique
-                */
-                if (i == *nbTachesL) {
-                    choixCCTermine = true;
-                }
-			}
-			else {
-                if (i == *nbTachesL - 1) {
-                    choixCCTermine = true;
-                }
-                i++;
-			}
+static int voisinsPERT(void *contexte, int sommet, bool successeurs, int *voisins) {
+	TypGraphePERT *graphePERT;  /* Le graphe PERT */
+	TypVoisins    *liste;       /* Liste d'adjacence du sommet */
+	TypVoisins    *vC;          /* Voisin courant */
+	int           nbVoisins;
+	
+	graphePERT = contexte;
+	if (successeurs) {
+		liste = graphePERT->graphe->listesAdjacences[sommet-1];
+	} else {
+		liste = graphePERT->grapheInverse->listesAdjacences[sommet-1];
+	}
+	
+	nbVoisins = 0;
+	for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+		voisins[nbVoisins++] = numeroVoisin(&vC);
+	}
+	
+	return nbVoisins;
+}
+
+
+	/*
+	* Fonction : relierSommets
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int depart, int arrivee, les extrémités de l'arête
+	*              int lien, le code de la dépendance (voir LIEN)
+	*
+	* Description : Ajoute l'arête au graphe, pondérée par l'écart entre
+	*               les débuts, et l'arête inverse au graphe des
+	*               prédécesseurs, pondérée par le code de la dépendance.
+	*/
+static void relierSommets(TypGraphePERT *graphePERT, int depart, int arrivee, int lien) {
+	insertionAreteOriente(graphePERT->graphe,depart,arrivee,
+	                      ecartLien(lien,graphePERT->duree[depart-1],graphePERT->duree[arrivee-1]));
+	insertionAreteOriente(graphePERT->grapheInverse,arrivee,depart,lien);
+}
+
+
+	/*
+	* Fonction : debutBorne
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int sommet, un sommet du graphe
+	*
+	* Retour : bool, true si un prédécesseur du sommet borne son début
+	*             (voir borneDebut) : le sommet n'a pas à être relié à alpha
+	*/
+static bool debutBorne(TypGraphePERT *graphePERT, int sommet) {
+	TypVoisins *liste;  /* Liste des prédécesseurs du sommet */
+	TypVoisins *vC;     /* Prédécesseur courant */
+
+	liste = graphePERT->grapheInverse->listesAdjacences[sommet-1];
+	for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+		if (borneDebut(poidsVoisin(&vC))) {
+			return true;
 		}
-		else {
-            /* 
-			* On cherche la tâche libre dont la date au plus tard est la plus
-			* éloignée de la fin du chantier
-			*/
-			indDateMin = 0;
-			for (i = 1; i <= *nbTachesL - 1; i++) {
-				if (tachesL[i]->dateTard < tachesL[indDateMin]->dateTard) {
-					indDateMin = i;
-				}
-			}
-			
-			/*
-			* On affecte la tâche trouvée à un ouvrier
-			*/
-			tacheL = tachesL[indDateMin];
-			tachesL[indDateMin] = tachesL[*nbTachesL - 1];
-			(*nbTachesL)--;
-			tachesEC[*nbTachesEC] = creerTacheEnCours(tacheL);
-			(*nbTachesEC)++;
+	}
+
+	return false;
+}
+
+
+	/*
+	* Fonction : finBornee
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int sommet, un sommet du graphe
+	*
+	* Retour : bool, true si un successeur du sommet borne sa fin (voir
+	*             borneFin) : le sommet n'a pas à être relié à oméga
+	*/
+static bool finBornee(TypGraphePERT *graphePERT, int sommet) {
+	TypVoisins *liste;  /* Liste des successeurs du sommet */
+	TypVoisins *vC;     /* Successeur courant */
+
+	liste = graphePERT->graphe->listesAdjacences[sommet-1];
+	for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+		if (!graphePERT->liensTypes
+				|| borneFin(poidsArete(graphePERT->grapheInverse,numeroVoisin(&vC),sommet))) {
+			return true;
 		}
 	}
+
+	return false;
+}
+
+
+	/*
+	* Fonction : delierSommets
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int depart, int arrivee, les extrémités de l'arête
+	*
+	* Description : Supprime l'arête du graphe et l'arête inverse du graphe
+	*               des prédécesseurs.
+	*/
+static void delierSommets(TypGraphePERT *graphePERT, int depart, int arrivee) {
+	suppressionArete(graphePERT->graphe,depart,arrivee,'o');
+	suppressionArete(graphePERT->grapheInverse,arrivee,depart,'o');
+}
+
+
+	/*
+	* Fonction : dureeTotale
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int nbOuvriers, le nombre d'ouvriers (>= 1)
+	*
+	* Retour : int, la durée totale du chantier
+	*
+	* Description : Renvoie la durée totale du chantier représenté par le
+	*				graphe PERT passé en paramètre selon le nombre d'ouvriers.
+	*				Au-delà du parallélisme maximal (voir parallelismeMaximal),
+	*				la durée est celle du chemin critique, sans simulation.
+	*/
+int dureeTotale(TypGraphePERT *graphePERT, int nbOuvriers) {
+	int nbTaches = graphePERT->graphe->nbrMaxSommets; /* Nombre de tâches */
+	
+	/* Assez d'ouvriers pour que chaque tâche commence au plus tôt */
+	if (nbOuvriers >= nbTaches || nbOuvriers >= parallelismeMaximal(graphePERT)) {
+		return graphePERT->dateTot[graphePERT->graphe->nbrMaxSommets - 1];
+	}
+	else {
+		TypEspaceOrdo *espace; /* Espace de travail de la simulation */
+		int dureeTotale; /* Durée totale du chantier (résultat à renvoyer) */
+		
+		espace = creerEspaceOrdo(graphePERT);
+		dureeTotale = simulerOrdo(espace,nbOuvriers);
+		deleteEspaceOrdo(espace);
+		
+		return dureeTotale;
+	}
 }
 
 
 	/*
-	* Fonction : triTachesEnCours
+	* Fonction : dureeTotaleRessources
 	*
-	* Paramètres : TypTacheEnCours **tachesEC, tableau de tâches en cours.
-	*              int nbTachesEC, nb de tâches en cours.
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              TypRessources *ressources, les ressources du chantier
 	*
-	* Description : Trie le tableau des tâches en cours par ordre croissant
-	*               de leur durée de réalisation restante.
+	* Retour : int, la durée totale du chantier, ou -1 si une tâche demande
+	*              plus d'unités d'une ressource qu'il n'en existe
+	*
+	* Description : Équivalent de dureeTotale lorsque les ouvriers ont des
+	*				métiers différents (voir simulerOrdoRessources).
 	*/
-static void triTachesEnCours(TypTacheEnCours **tachesEC,int nbTachesEC) {
-	int      i, j;        /* indice de parcours */
-	TypTacheEnCours *tmp;
+int dureeTotaleRessources(TypGraphePERT *graphePERT, TypRessources *ressources) {
+	TypEspaceOrdo *espace; /* Espace de travail de l'ordonnancement */
+	int dureeTotale; /* Durée totale du chantier (résultat à renvoyer) */
 	
-	do {
-        j = 0;
-        for(i = 0; i <= nbTachesEC - 2; i++){
-            if(tachesEC[i]->dureeRestante > tachesEC[i+1]->dureeRestante) {
-                tmp = tachesEC[i];
-                tachesEC[i] = tachesEC[i+1];
-                tachesEC[i+1] = tmp;
-                j = 1;
-            }
-        }
-    } while(j == 1);
+	espace = creerEspaceOrdo(graphePERT);
+	dureeTotale = simulerOrdoRessources(espace,ressources);
+	deleteEspaceOrdo(espace);
+	
+	return dureeTotale;
 }
 
 
@@ -636,11 +1121,13 @@ static void triTachesEnCours(TypTacheEnCours **tachesEC,int nbTachesEC) {
 	*
 	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
 	*
-	* Description : Affiche les dates des tâches du graphe sous la forme suivante :
+	* Description : Affiche les dates et les marges des tâches du graphe sous
+	*				la forme suivante :
 	*
-	*				# nom, date au plus tot, date au plus tard
-	*				A, 2, 5
-	*				B, 7, 9
+	*				# nom, date au plus tot, date au plus tard, marge totale,
+	*				#   marge libre, marge independante
+	*				A, 2, 5, 3, 1, 0
+	*				B, 7, 9, 2, 2, 2
 	*/
 void afficherDates(TypGraphePERT *graphePERT) {
 	TypTache **taches; /* Les tâches associées au graphe PERT */
@@ -648,12 +1135,16 @@ void afficherDates(TypGraphePERT *graphePERT) {
 	
 	taches = graphePERT->taches;
 	
-	printf("# nom, date au plus tot, date au plus tard\n");
+	printf("# nom, date au plus tot, date au plus tard, marge totale, ");
+	printf("marge libre, marge independante\n");
 	
 	for (i = 1; i <= graphePERT->graphe->nbrMaxSommets - 2; i++) {
-		printf("%c, ",taches[i-1]->nom);
-		printf("%d, ",taches[i-1]->dateTot);
-		printf("%d\n",taches[i-1]->dateTard);
+		printf("%s, ",taches[i-1]->nom);
+		printf("%d, ",graphePERT->dateTot[i-1]);
+		printf("%d, ",graphePERT->dateTard[i-1]);
+		printf("%d, ",graphePERT->margeTotale[i-1]);
+		printf("%d, ",graphePERT->margeLibre[i-1]);
+		printf("%d\n",graphePERT->margeIndependante[i-1]);
 	}
 }
 
@@ -663,37 +1154,44 @@ void afficherDates(TypGraphePERT *graphePERT) {
 	*
 	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
 	*
-	* Description : Affiche le Chemin critique sous la forme :
+	* Description : Affiche le nombre de chemins critiques puis chacun d'eux
+	*				(au plus NB_CHEMINS_AFFICHES) sous la forme :
 	*
 	*				# nomTache1 -> nomTache2 -> .....
 	*				A -> B -> C -> D
 	*				
 	*/
 void afficherCheminCritique(TypGraphePERT* graphePERT){
-	TypTache      **taches;            /* Les tâches associées au graphe PERT */
-	int 		i;		/* variable de parcours des tâches du graphe*/
-	int 		tmp1;		/* date au plus tôt de la tâche courante */
-	int 		tmp2;		/* ate au plus tard de la tâche courante */
-    int         cmp;        /* Le nombre de sommets trouvés sur le chemin critique */
+	TypTache            **taches;   /* Les tâches associées au graphe PERT */
+	TypCheminsCritiques *chemins;   /* Parcours des chemins critiques */
+	unsigned long long  nbChemins;  /* Nombre de chemins critiques */
+	int                 *chemin;    /* Tâches d'un chemin critique */
+	int                 longueur;   /* Nombre de tâches du chemin */
+	int                 i;          /* Permet le parcours du chemin */
 
-    cmp = 0;
 	taches = graphePERT->taches;
-	printf("Chemin critique correspondant au graphe en cours :\n");
+	nbChemins = nombreCheminsCritiques(graphePERT);
+	printf("Chemin(s) critique(s) correspondant au graphe en cours : %llu\n",nbChemins);
 
-	for(i = 1; i <= graphePERT->graphe->nbrMaxSommets - 2; i++){
+	chemin = malloc(graphePERT->graphe->nbrMaxSommets * sizeof(int));
+	chemins = creerCheminsCritiques(graphePERT,NB_CHEMINS_AFFICHES);
 
-		tmp1 = taches[i-1]->dateTot;
-		tmp2 = taches[i-1]->dateTard;
+	while ((longueur = cheminCritiqueSuivant(chemins,chemin)) != -1) {
+		for (i = 0; i < longueur; i++) {
+			if (i != 0) {
+				printf(" --> ");
+			}
+			printf("%s",taches[chemin[i]]->nom);
+		}
+		printf("\n");
+	}
 
-        if(tmp1 == tmp2){
-            if (cmp != 0) {
-                printf(" --> ");
-            }
-            
-            printf("%c",taches[i-1]->nom);
-            cmp++;
-        }
+	if (nbChemins > NB_CHEMINS_AFFICHES) {
+		printf("... (%llu autres)\n",nbChemins - NB_CHEMINS_AFFICHES);
 	}
+
+	deleteCheminsCritiques(chemins);
+	free(chemin);
 }
 
 
@@ -703,138 +1201,482 @@ void afficherCheminCritique(TypGraphePERT* graphePERT){
 	* Paramètres : FILE *fichier, un fichier de type chantier.txt 
     *                 ouvert en lecture
     *
-    * Retour : TypGraphePERT*, le graphe créé
+    * Retour : TypGraphePERT*, le graphe créé, ou NULL si le fichier est
+    *              mal formé (voir aussi creerGraphePERT)
 	*
 	* Description : Lit un fichier de type chantier.txt, puis crée le graphe
-    *               correspondant et le renvoie
+    *               correspondant et le renvoie. Le fichier est projeté en
+    *               mémoire (ou lu d'un bloc s'il ne peut l'être) puis
+    *               découpé sur place : les noms, intitulés et dépendances
+    *               des tâches pointent dans ce texte, qui appartient au
+    *               graphe. Les lignes vides ou commençant par '#' sont
+    *               ignorées. La durée est un entier positif ou trois
+    *               entiers optimiste/probable/pessimiste croissants, ex :
+    *               2/4/9.
+    *               Un chantier compilé (voir binaire.h) est reconnu à son
+    *               en-tête et chargé sans analyse.
 	*/
 TypGraphePERT* lireGraphePERT(FILE *fichier) {
     TypGraphePERT *graphePERT; /* Le graphe PERT créé */
     TypTache      **taches;    /* Les tâches du graphe */
-    char          ligne[512];  /* Ligne lue dans le fichier */
+    int           *durees;     /* Durées de chaque tâche : probable, */
+    int           *optimistes; /*   optimiste et pessimiste */
+    int           *pessimistes;
+    char          *texte;      /* Le texte du fichier */
+    size_t        taille;      /* Taille du texte */
+    bool          projete;     /* true si le texte est projeté par mmap */
+    char          *ligne;      /* Début de la ligne courante */
+    char          *finLigne;   /* Fin de la ligne courante */
+    char          *c;          /* Position courante dans la ligne */
+    char          *suite;      /* Fin d'un entier lu */
+    int           nbLignes;    /* Nombre de lignes du fichier */
     int           nbTaches;    /* Nombre de tâches total */
+    bool          valide;      /* false si une ligne est mal formée */
+    TypArene      *arene;      /* Arène du graphe */
     
-    nbTaches = 0;
-    taches = malloc(10 * sizeof(TypTache));
+    if ((texte = lireTexte(fichier,&taille,&projete)) == NULL) {
+        return NULL;
+    }
+    
+    /* Un chantier compilé se charge sans analyse */
+    if (estGraphePERTBinaire(texte,taille)) {
+        graphePERT = chargerGraphePERTBinaire(texte,taille);
+        if (graphePERT == NULL) {
+            libererTexte(texte,taille + 1,projete);
+            return NULL;
+        }
+        graphePERT->texte = texte;
+        graphePERT->tailleTexte = taille + 1;
+        graphePERT->texteProjete = projete;
+        return graphePERT;
+    }
+    
+    /* Un premier passage compte les lignes pour dimensionner taches */
+    nbLignes = 1;
+    for (c = memchr(texte,'\n',taille); c != NULL; c = memchr(c + 1,'\n',texte + taille - c - 1)) {
+        nbLignes++;
+    }
     
-    /* Lecture des 2 premières lignes */
-    fgets(ligne,sizeof(ligne),fichier);
-    fgets(ligne,sizeof(ligne),fichier);
+    /* L'arène est dimensionnée pour une ligne par tâche avec une
+       dépendance ; elle grandit d'elle-même au-delà */
+    arene = creerArene(nbLignes * (sizeof(TypTache) + 6 * sizeof(TypVoisins)
+                                   + 2 * sizeof(TypEntreeNom) + 8 * sizeof(int)));
+    taches = allouerArene(arene,(nbLignes + 2) * sizeof(TypTache*));
+    durees = allouerArene(arene,(nbLignes + 2) * sizeof(int));
+    optimistes = allouerArene(arene,nbLignes * sizeof(int));
+    pessimistes = allouerArene(arene,nbLignes * sizeof(int));
     
-    while (! feof(fichier)) {
-        char nom;
+    nbTaches = 0;
+    valide = true;
+    ligne = texte;
+    while (ligne < texte + taille && valide) {
+        char *nom;
         char *intitule;
         int  duree;
+        int  dureeOptimiste;
+        int  dureePessimiste;
         char *dependances;
         
-        intitule = malloc(200 * sizeof(char));
-        dependances = malloc(50 * sizeof(char));
-        
-        /* Lecture d'une ligne */
-        fgets(ligne,sizeof(ligne),fichier);
-        
-        sscanf(ligne,"%c, '%[^']', %d, %[^\r\n]",&nom,intitule,&duree,dependances);
-        
-        if (strcmp(dependances,"-") == 0) {
-            dependances = replace(dependances,"-","");
+        /* Découpage de la ligne : texte[taille] est réservé au '\0' final */
+        finLigne = memchr(ligne,'\n',texte + taille - ligne);
+        if (finLigne == NULL) {
+            finLigne = texte + taille;
         }
-        else {
-            dependances = replace(dependances,", ","");
+        *finLigne = '\0';
+        if (finLigne > ligne && finLigne[-1] == '\r') {
+            finLigne[-1] = '\0';
+        }
+        c = sauterEspaces(ligne);
+        ligne = finLigne + 1;
+        if (*c == '\0' || *c == '#') {
+            continue;
         }
         
-        intitule = realloc(intitule,strlen(intitule)+1);
-        dependances = realloc(dependances,strlen(dependances)+1);
-        
-        /* Création de la tâche décrite dans cette ligne */
-        if ( ((nbTaches % 10) == 0) && (nbTaches != 0) ) {
-            taches = realloc(taches,(nbTaches + 10) * sizeof(TypTache));
+        /* nom, 'intitule', duree, dependances */
+        nom = c;
+        c = strchr(c,',');
+        valide = (c != NULL);
+        if (valide) {
+            *c = '\0';
+            couperEspaces(nom);
+            c = sauterEspaces(c + 1);
+            valide = (*c == '\'');
+        }
+        if (valide) {
+            intitule = c + 1;
+            c = strchr(intitule,'\'');
+            valide = (c != NULL);
+        }
+        if (valide) {
+            *c = '\0';
+            c = sauterEspaces(c + 1);
+            valide = (*c == ',');
+        }
+        if (valide) {
+            duree = (int) strtol(c + 1,&suite,10);
+            valide = (suite != c + 1);
+            dureeOptimiste = duree;
+            dureePessimiste = duree;
+            if (valide && *suite == '/') {
+                dureeOptimiste = duree;
+                c = suite + 1;
+                duree = (int) strtol(c,&suite,10);
+                valide = (suite != c && *suite == '/');
+                if (valide) {
+                    c = suite + 1;
+                    dureePessimiste = (int) strtol(c,&suite,10);
+                    valide = (suite != c);
+                }
+            }
+            /* Durées positives et ordonnées : 0 <= o <= m <= p */
+            valide = valide && 0 <= dureeOptimiste && dureeOptimiste <= duree
+                     && duree <= dureePessimiste;
+            c = sauterEspaces(suite);
+            valide = valide && (*c == ',' || *c == '\0');
+        }
+        if (valide) {
+            dependances = (*c == ',') ? sauterEspaces(c + 1) : c;
+            couperEspaces(dependances);
+            if (strcmp(dependances,"-") == 0) {
+                dependances[0] = '\0';
+            }
+            
+            /* Création de la tâche décrite dans cette ligne */
+            taches[nbTaches] = creerTache(arene,nom,intitule,dependances);
+            durees[nbTaches] = duree;
+            optimistes[nbTaches] = dureeOptimiste;
+            pessimistes[nbTaches] = dureePessimiste;
+            nbTaches++;
         }
-        taches[nbTaches] = creerTache(nom,intitule,duree,dependances);
-        nbTaches++;
-	
-	//free(intitule);
-    //free(dependances);
     }
     
-    taches = realloc(taches,nbTaches * sizeof(TypTache));
-    
     /* Création du graphe PERT */
-    graphePERT = creerGraphePERT(taches,nbTaches);
+    graphePERT = valide ? creerGraphePERT(arene,taches,durees,nbTaches) : NULL;
+    
+    if (graphePERT == NULL) {
+        deleteArene(arene);
+        libererTexte(texte,taille + 1,projete);
+        return NULL;
+    }
+    
+    memcpy(graphePERT->dureeOptimiste,optimistes,nbTaches * sizeof(int));
+    memcpy(graphePERT->dureePessimiste,pessimistes,nbTaches * sizeof(int));
+    graphePERT->texte = texte;
+    graphePERT->tailleTexte = taille + 1;
+    graphePERT->texteProjete = projete;
     
     return graphePERT;
 }
 
 
 	/*
-	* Fonction : tacheEnSommet
+	* Fonction : ajouterArete
 	*
-	* Paramètres : char nom, le nom d'une tâche
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int depart, int arrivee, les extrémités de l'arête
+	*              int lien, le code de la dépendance (voir LIEN)
+	*
+	* Description : Comme relierSommets, sans vérifier que l'arête
+	*               n'existe pas déjà (construction du graphe uniquement).
+	*/
+static void ajouterArete(TypGraphePERT *graphePERT, int depart, int arrivee, int lien) {
+	ajouterVoisinArene(&(graphePERT->graphe->listesAdjacences[depart-1]),arrivee,
+	                   ecartLien(lien,graphePERT->duree[depart-1],graphePERT->duree[arrivee-1]),graphePERT->arene);
+	ajouterVoisinArene(&(graphePERT->grapheInverse->listesAdjacences[arrivee-1]),depart,lien,graphePERT->arene);
+}
+
+
+	/*
+	* Fonction : hacherNom
 	*
-	* Retour : int, le numéro du sommet correspondant
+	* Paramètres : const char *nom, size_t longueur, un nom de tâche
 	*
-	* Description : Renvoie le numéro du sommet correspondant au nom
-	*               de la tâche. On considère que :
-	*               'A' <-> 1
-	*               'B' <-> 2  etc...
+	* Retour : unsigned int, l'empreinte FNV-1a du nom
 	*/
-static int tacheEnSommet(char nom) {
-	return (int) nom - 64;
+static unsigned int hacherNom(const char *nom, size_t longueur) {
+	unsigned int empreinte = 2166136261u;
+	size_t       i;
+
+	for (i = 0; i < longueur; i++) {
+		empreinte ^= (unsigned char) nom[i];
+		empreinte *= 16777619u;
+	}
+
+	return empreinte;
 }
 
 
 	/*
-	* Fonction : sommetEnTache
+	* Fonction : chercherNom
 	*
-	* Paramètres : int sommet, le numéro d'un sommet d'un graphe
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              const char *nom, size_t longueur, un nom de tâche (pas
+	*                  forcément terminé par '\0')
+	*
+	* Retour : int, le sommet de la tâche, ou 0 si le nom est inconnu
+	*/
+static int chercherNom(TypGraphePERT *graphePERT, const char *nom, size_t longueur) {
+	int          masque;  /* tailleTableNoms - 1 */
+	int          i;
+	TypEntreeNom *entree;
+
+	masque = graphePERT->tailleTableNoms - 1;
+	i = hacherNom(nom,longueur) & masque;
+	while ((entree = &graphePERT->tableNoms[i])->sommet != 0) {
+		if (strncmp(entree->nom,nom,longueur) == 0 && entree->nom[longueur] == '\0') {
+			return entree->sommet;
+		}
+		i = (i + 1) & masque;
+	}
+
+	return 0;
+}
+
+
+	/*
+	* Fonction : dependanceSuivante
 	*
-	* Retour : char, le nom de la tâche correspondante
+	* Paramètres : const char *dependances, une liste de noms séparés par
+	*                  des virgules, ou la fin du nom précédent
+	*              size_t *longueur, reçoit la longueur du nom trouvé
 	*
-	* Description : Renvoie le nom de la tâche correspondant au numéro
-	*               du sommet. On considère que :
-	*               1 <-> 'A'
-	*               2 <-> 'B'  etc...
+	* Retour : const char*, le début du nom suivant, ou NULL s'il n'y en a
+	*              plus
 	*/
-static char sommetEnTache(int sommet) {
-	return (char) (sommet + 64);
+static const char* dependanceSuivante(const char *dependances, size_t *longueur) {
+	const char *fin;
+
+	while (*dependances == ',' || *dependances == ' ' || *dependances == '\t') {
+		dependances++;
+	}
+	if (*dependances == '\0') {
+		return NULL;
+	}
+
+	fin = dependances;
+	while (*fin != ',' && *fin != '\0') {
+		fin++;
+	}
+	while (fin > dependances && (fin[-1] == ' ' || fin[-1] == '\t')) {
+		fin--;
+	}
+	*longueur = fin - dependances;
+
+	return dependances;
 }
 
 
 	/*
-	* Fonction : replace
+	* Fonction : chercherDependance
 	*
-	* Paramètres : char *str, la chaîne d'origine
-    *              char *old, la sous-chaîne à modifier par new
-    *              char *new, la sous-chaîne qui remplace old
-    *
-    * Retour : char*, pointeur sur la nouvelle chaîne
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              const char *dependance, size_t longueur, une dépendance
+	*                  telle que donnée par dependanceSuivante
+	*              int *lien, reçoit le code de la dépendance
+	*
+	* Retour : int, le sommet du prédécesseur, ou 0 s'il est inconnu
 	*
-	* Description : Remplace new par old dans str et renvoie un pointeur
-    *               sur la nouvelle chaine
+	* Description : Une dépendance est le nom du prédécesseur, suivi
+	*               éventuellement d'un type et d'un décalage, ex : "B SS+2"
+	*               (voir TypTypeLien). Le nom entier est cherché d'abord :
+	*               une tâche peut s'appeler "B SS".
 	*/
-static char* replace(const char *str, const char *old, const char *new) {
-	char *ret, *r;
-	const char *p, *q;
-	size_t oldlen = strlen(old);
-	size_t count, retlen, newlen = strlen(new);
+static int chercherDependance(TypGraphePERT *graphePERT, const char *dependance, size_t longueur, int *lien) {
+	size_t nom;     /* Longueur du nom sans le type */
+	int    sommet;
 
-	if (oldlen != newlen) {
-		for (count = 0, p = str; (q = strstr(p, old)) != NULL; p = q + oldlen)
-			count++;
-		retlen = p - str + strlen(p) + count * (newlen - oldlen);
-	} else
-		retlen = strlen(str);
+	*lien = LIEN_SIMPLE;
+	sommet = chercherNom(graphePERT,dependance,longueur);
+	if (sommet != 0) {
+		return sommet;
+	}
 
-	if ((ret = malloc(retlen + 1)) == NULL)
-		return NULL;
+	/* Le type est le dernier mot, séparé du nom par des espaces */
+	nom = longueur;
+	while (nom > 0 && dependance[nom-1] != ' ' && dependance[nom-1] != '\t') {
+		nom--;
+	}
+	if (nom == 0 || ! lireLien(dependance + nom,longueur - nom,lien)) {
+		return 0;
+	}
+	while (nom > 0 && (dependance[nom-1] == ' ' || dependance[nom-1] == '\t')) {
+		nom--;
+	}
+
+	return chercherNom(graphePERT,dependance,nom);
+}
 
-	for (r = ret, p = str; (q = strstr(p, old)) != NULL; p = q + oldlen) {
-		ptrdiff_t l = q - p;
-		memcpy(r, p, l);
-		r += l;
-		memcpy(r, new, newlen);
-		r += newlen;
+
+	/*
+	* Fonction : lireLien
+	*
+	* Paramètres : const char *texte, size_t longueur, un type de
+	*                  dépendance suivi d'un décalage facultatif, ex : "FS",
+	*                  "SS+2", "FF-1" (pas forcément terminé par '\0')
+	*              int *lien, reçoit le code de la dépendance
+	*
+	* Retour : bool, true si le texte est un type de dépendance valide,
+	*             de décalage au plus DECALAGE_MAX en valeur absolue
+	*/
+static bool lireLien(const char *texte, size_t longueur, int *lien) {
+	static const char *types[] = {"FS","SS","FF","SF"};  /* Dans l'ordre
+	                                                        de TypTypeLien */
+	int    type;
+	int    decalage;
+	int    signe;
+	size_t i;
+
+	for (type = 0; type < 4; type++) {
+		if (longueur >= 2 && strncmp(texte,types[type],2) == 0) {
+			break;
+		}
 	}
-	strcpy(r, p);
+	if (type == 4) {
+		return false;
+	}
+
+	decalage = 0;
+	if (longueur > 2) {
+		signe = (texte[2] == '-') ? -1 : 1;
+		if ((texte[2] != '+' && texte[2] != '-') || longueur == 3) {
+			return false;
+		}
+		for (i = 3; i < longueur; i++) {
+			if (texte[i] < '0' || texte[i] > '9' || decalage > (DECALAGE_MAX - (texte[i] - '0')) / 10) {
+				return false;
+			}
+			decalage = decalage * 10 + (texte[i] - '0');
+		}
+		decalage *= signe;
+	}
+	*lien = LIEN(type,decalage);
+
+	return true;
+}
+
 
-	return ret;
-}
\ No newline at end of file
+	/*
+	* Fonction : borneDebut
+	*
+	* Paramètres : int lien, le code d'une dépendance P -> T
+	*
+	* Retour : bool, true si la dépendance empêche T de commencer avant P
+	*             (FS ou SS de décalage positif ou nul)
+	*/
+bool borneDebut(int lien) {
+	return (TYPE_LIEN(lien) == LIEN_FIN_DEBUT || TYPE_LIEN(lien) == LIEN_DEBUT_DEBUT)
+	    && DECALAGE_LIEN(lien) >= 0;
+}
+
+
+	/*
+	* Fonction : borneFin
+	*
+	* Paramètres : int lien, le code d'une dépendance P -> T
+	*
+	* Retour : bool, true si la dépendance empêche P de finir après T
+	*             (FS ou FF de décalage positif ou nul)
+	*/
+bool borneFin(int lien) {
+	return (TYPE_LIEN(lien) == LIEN_FIN_DEBUT || TYPE_LIEN(lien) == LIEN_FIN_FIN)
+	    && DECALAGE_LIEN(lien) >= 0;
+}
+
+
+	/*
+	* Fonction : lireTexte
+	*
+	* Paramètres : FILE *fichier, un fichier ouvert en lecture
+	*              size_t *taille, reçoit la taille du texte
+	*              bool *projete, reçoit true si le texte est projeté
+	*
+	* Retour : char*, le texte modifiable du fichier, suivi d'un octet
+	*              réservé au '\0' final, ou NULL en cas d'erreur
+	*
+	* Description : Projette le fichier en mémoire, en copie privée. Les
+	*               octets qui suivent la fin du fichier dans sa dernière
+	*               page sont utilisables ; si le fichier remplit exactement
+	*               sa dernière page, ou n'est pas un fichier ordinaire, il
+	*               est lu dans un tableau alloué.
+	*/
+static char* lireTexte(FILE *fichier, size_t *taille, bool *projete) {
+	struct stat etat;
+	char        *texte;
+	size_t      capacite;
+	size_t      lus;
+
+	if (fstat(fileno(fichier),&etat) == 0 && S_ISREG(etat.st_mode) && etat.st_size > 0
+			&& etat.st_size % sysconf(_SC_PAGESIZE) != 0) {
+		*taille = etat.st_size;
+		texte = mmap(NULL,*taille + 1,PROT_READ | PROT_WRITE,MAP_PRIVATE,fileno(fichier),0);
+		if (texte != MAP_FAILED) {
+			*projete = true;
+			return texte;
+		}
+	}
+
+	*projete = false;
+	capacite = 4096;
+	*taille = 0;
+	texte = malloc(capacite + 1);
+	while ((lus = fread(texte + *taille,1,capacite - *taille,fichier)) > 0) {
+		*taille += lus;
+		if (*taille == capacite) {
+			capacite *= 2;
+			texte = realloc(texte,capacite + 1);
+		}
+	}
+	texte[*taille] = '\0';
+
+	return texte;
+}
+
+
+	/*
+	* Fonction : sauterEspaces
+	*
+	* Paramètres : char *c, une position dans une chaîne
+	*
+	* Retour : char*, le premier caractère qui n'est ni espace ni tabulation
+	*/
+static char* sauterEspaces(char *c) {
+	while (*c == ' ' || *c == '\t') {
+		c++;
+	}
+
+	return c;
+}
+
+
+	/*
+	* Fonction : couperEspaces
+	*
+	* Paramètres : char *chaine, une chaîne
+	*
+	* Description : Retire les espaces et tabulations de fin de chaîne.
+	*/
+static void couperEspaces(char *chaine) {
+	size_t longueur = strlen(chaine);
+
+	while (longueur > 0 && (chaine[longueur-1] == ' ' || chaine[longueur-1] == '\t')) {
+		longueur--;
+	}
+	chaine[longueur] = '\0';
+}
+
+
+	/*
+	* Fonction : libererTexte
+	*
+	* Paramètres : char *texte, le texte d'un fichier lu (ou NULL)
+	*              size_t taille, la taille projetée
+	*              bool projete, true si le texte est projeté par mmap
+	*/
+static void libererTexte(char *texte, size_t taille, bool projete) {
+	if (projete) {
+		munmap(texte,taille);
+	}
+	else {
+		free(texte);
+	}
+}
@@ -1,35 +1,145 @@
 #ifndef pert_H
 #define pert_H
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <limits.h>
 #include "libgraphe.h"
+#include "arene.h"
 
 
 
+/*
+* Type d'une dépendance d'une tâche T envers son prédécesseur P. Le
+* décalage, positif ou négatif, s'ajoute au délai imposé :
+* FS : T commence après la fin de P (dépendance ordinaire) ;
+* SS : T commence après le début de P ;
+* FF : T finit après la fin de P ;
+* SF : T finit après le début de P.
+* Dans un fichier chantier, le type et le décalage suivent le nom du
+* prédécesseur, ex : "A, B SS+2, C FF-1" (FS sans décalage par défaut).
+*/
+typedef enum TypTypeLien {
+	LIEN_FIN_DEBUT,
+	LIEN_DEBUT_DEBUT,
+	LIEN_FIN_FIN,
+	LIEN_DEBUT_FIN
+} TypTypeLien;
+
+/* Code d'une dépendance : type et décalage dans un seul entier */
+#define LIEN(type,decalage) ((decalage) * 4 + (type))
+#define TYPE_LIEN(lien) (((lien) % 4 + 4) % 4)
+#define DECALAGE_LIEN(lien) (((lien) - TYPE_LIEN(lien)) / 4)
+
+/* Dépendance fin -> début sans décalage */
+#define LIEN_SIMPLE LIEN(LIEN_FIN_DEBUT,0)
+
+/* Plus grand décalage en valeur absolue que LIEN peut coder dans un int */
+#define DECALAGE_MAX ((INT_MAX - 3) / 4)
+
+/* Plus grande somme des durées et des décalages (en valeur absolue) d'un
+   chantier : toute date, marge ou durée simulée tient alors dans un int */
+#define DUREE_MAX_CHANTIER (INT_MAX / 4)
+
+/*
+* Données froides d'une tâche, utiles à l'affichage seulement. Les durées
+* et les dates sont dans des tableaux du graphe PERT (voir duree).
+*/
 typedef struct TypTache {
-	char nom;
+	char *nom;          /* ex : "A" ou "T12" */
 	char *intitule;
-	int duree;
-	char *dependances;  /* ex : "ACD" */
-	int dateTot;
-	int dateTard;
+	char *dependances;  /* Noms des prédécesseurs, ex : "A, C SS+2, D" */
 } TypTache;
 
+/*
+* Case de la table des noms : le nom est gardé à côté du sommet pour
+* qu'une recherche ne passe pas par le tableau des tâches.
+*/
+typedef struct TypEntreeNom {
+	const char *nom;
+	int        sommet;
+} TypEntreeNom;
+
+/*
+* Le poids d'une arête P -> T du graphe est l'écart minimal entre les
+* débuts de P et de T (voir ecartLien) : la durée de P pour une dépendance
+* ordinaire. Dans le graphe inverse, le poids de l'arête T -> P est le
+* code de la dépendance (voir LIEN).
+*/
 typedef struct TypGraphePERT {
 	TypGraphe *graphe;
+	TypGraphe *grapheInverse;  /* Arêtes inversées : prédécesseurs */
 	TypTache **taches;
+	int *duree;                /* Durées et dates de chaque sommet, en */
+	int *dureeOptimiste;       /*   tableaux contigus indicés par sommet - 1 */
+	int *dureePessimiste;      /*   (estimations à trois points égales à */
+	int *dateTot;              /*   duree si le fichier ne donne qu'une */
+	int *dateTard;             /*   durée) */
+	int *ordreTopo;            /* Sommets dans un ordre topologique */
+	int *rangTopo;             /* Position de chaque sommet dans ordreTopo */
+	int *margeTotale;          /* Marges de chaque sommet (indicées par */
+	int *margeLibre;           /*   sommet - 1), calculées avec les dates */
+	int *margeIndependante;
+	TypEntreeNom *tableNoms;   /* Table de hachage nom -> sommet (sommet 0 :
+	                              case vide), voir chercherTache */
+	int tailleTableNoms;       /* Taille de tableNoms (puissance de 2) */
+	char *texte;               /* Texte du fichier lu, découpé sur place :
+	                              noms, intitulés et dépendances y pointent
+	                              (NULL si le graphe n'a pas été lu) */
+	size_t tailleTexte;
+	bool texteProjete;         /* true si texte est projeté par mmap */
+	bool datesCalculees;       /* true si dates et marges sont à jour */
+	bool liensTypes;           /* true si une dépendance n'est pas
+	                              LIEN_SIMPLE (peut le rester après sa
+	                              suppression) */
+	long long sommeDurees;     /* Somme des durées et des décalages en
+	                              valeur absolue, au plus
+	                              DUREE_MAX_CHANTIER (un décalage supprimé
+	                              y reste compté) */
+	TypArene *arene;           /* Arène d'où vient toute la mémoire du
+	                              graphe (sauf texte) */
 } TypGraphePERT;
 
+typedef enum TypTypeModification {
+	MODIF_DUREE,
+	MODIF_AJOUT_DEPENDANCE,
+	MODIF_SUPPRESSION_DEPENDANCE
+} TypTypeModification;
+
+typedef struct TypModification {
+	TypTypeModification type;
+	int sommet;        /* Sommet de la tâche modifiée */
+	int predecesseur;  /* Sommet de la dépendance ajoutée ou supprimée */
+	int duree;         /* Nouvelle durée (MODIF_DUREE) */
+} TypModification;
+
 
-TypTache* creerTache(char, char*, int, char*);
+TypTache* creerTache(TypArene*, char*, char*, char*);
 
-TypGraphePERT* creerGraphePERT(TypTache**, int);
+TypGraphePERT* creerGraphePERT(TypArene*, TypTache**, int*, int);
 
 void deleteGraphePERT(TypGraphePERT*);
 
+int chercherTache(TypGraphePERT*,const char*);
+
+int ecartLien(int,int,int);
+
+bool borneDebut(int);
+
+bool borneFin(int);
+
 void calculDates(TypGraphePERT*);
 
+int majDates(TypGraphePERT*,TypModification*,int);
+
+void calculMarges(TypGraphePERT*);
+
 int dureeTotale(TypGraphePERT*,int);
 
+struct TypRessources;
+
+int dureeTotaleRessources(TypGraphePERT*,struct TypRessources*);
+
 void afficherDates(TypGraphePERT*);
 
 void afficherCheminCritique(TypGraphePERT*);
@@ -0,0 +1,526 @@
+/*
+******************************************************************************
+*
+* Programme : programme.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Programmes de chantiers : des sous-projets, chantiers ou
+*          programmes imbriqués, reliés par leurs dépendances. Chaque
+*          niveau ne voit de ses sous-projets qu'une tâche résumée dont la
+*          durée est gardée en cache ; une mise à jour ne relit que les
+*          fichiers modifiés et ne recalcule que les niveaux touchés.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <sys/stat.h>
+#include "libgraphe.h"
+#include "pert.h"
+#include "arene.h"
+#include "erreurs.h"
+#include "programme.h"
+
+
+/* Longueur maximale d'un nom de sous-projet */
+#define TAILLE_NOM 64
+
+/* Longueur maximale d'un chemin de fichier */
+#define TAILLE_CHEMIN 256
+
+
+static TypProgramme* chargerNiveau(const char*,TypProgramme*,int,int*);
+static int majNiveau(TypProgramme*,int,int*);
+static TypProgramme* reprendreSousProjet(TypProgramme*,const char*,int*);
+static bool lireEtat(const char*,struct timespec*,off_t*);
+static char* cheminRelatif(const char*,const char*);
+static char* copierArene(TypArene*,const char*);
+static void couperFin(char*);
+
+
+	/*
+	* Fonction : chargerProgramme
+	*
+	* Paramètres : const char *chemin, un fichier de chantier ou de
+	*                  programme
+	*
+	* Retour : TypProgramme*, le programme chargé et ses dates calculées,
+	*              ou NULL si un fichier manque ou est invalide, ou si les
+	*              programmes s'imbriquent trop profondément (voir
+	*              PROFONDEUR_MAX_PROGRAMME)
+	*
+	* Description : Un fichier de chantier donne un niveau sans
+	*               sous-projet. Sinon le fichier est lu comme un programme :
+	*               les lignes commençant par '#' sont ignorées, les autres
+	*               sont de la forme
+	*                   LOT2, batimentB.txt, ETUDES, LOT1 SS+5
+	*               (nom du sous-projet, fichier relatif au programme,
+	*               dépendances comme dans un chantier, voir TypTypeLien).
+	*/
+TypProgramme* chargerProgramme(const char *chemin) {
+	int nbRecalculs;
+
+	nbRecalculs = 0;
+
+	return chargerNiveau(chemin,NULL,0,&nbRecalculs);
+}
+
+
+	/*
+	* Fonction : deleteProgramme
+	*
+	* Paramètres : TypProgramme *programme, le programme à supprimer
+	*
+	* Description : Libère le programme et ses sous-projets.
+	*/
+void deleteProgramme(TypProgramme *programme) {
+	int i;
+
+	for (i = 0; i < programme->graphePERT->graphe->nbrMaxSommets && programme->sousProjets != NULL; i++) {
+		if (programme->sousProjets[i] != NULL) {
+			deleteProgramme(programme->sousProjets[i]);
+		}
+	}
+	free(programme->sousProjets);
+	deleteGraphePERT(programme->graphePERT);
+	free(programme->chemin);
+	free(programme);
+}
+
+
+	/*
+	* Fonction : majProgramme
+	*
+	* Paramètres : TypProgramme *programme, un programme chargé
+	*
+	* Retour : int, le nombre de niveaux relus ou recalculés (0 si aucun
+	*              fichier n'a changé), ou -1 si un fichier manque ou est
+	*              devenu invalide
+	*
+	* Description : Un fichier dont la date ou la taille a changé est relu ;
+	*               les sous-projets d'un programme relu sont repris s'ils
+	*               désignent le même fichier. Un niveau dont un sous-projet
+	*               a changé de durée est mis à jour par majDates. Les
+	*               niveaux intacts gardent leurs dates. En cas d'échec, le
+	*               niveau fautif garde son état précédent.
+	*/
+int majProgramme(TypProgramme *programme) {
+	int nbRecalculs;
+
+	nbRecalculs = 0;
+	if (majNiveau(programme,0,&nbRecalculs) != 0) {
+		return -1;
+	}
+
+	return nbRecalculs;
+}
+
+
+	/*
+	* Fonction : datesTacheProgramme
+	*
+	* Paramètres : TypProgramme *programme, un programme chargé
+	*              const char *nom, nom qualifié d'une tâche ou d'un
+	*                  sous-projet, ex : "LOT1/B"
+	*              int *debutTot, rempli avec la date de début au plus tôt
+	*              int *debutTard, rempli avec la date de début au plus tard
+	*
+	* Retour : int, 0 ou SOMMET_INEXISTANT si le nom ne désigne rien
+	*
+	* Description : Descend dans les sous-projets nommés ; les dates d'un
+	*               niveau, relatives à son début, sont décalées de celles
+	*               de sa tâche résumée. Les dates sont celles du programme
+	*               entier, à partir du jour 0.
+	*/
+int datesTacheProgramme(TypProgramme *programme, const char *nom, int *debutTot, int *debutTard) {
+	char       segment[TAILLE_NOM];  /* Nom cherché dans le niveau courant */
+	const char *fin;                 /* Fin du segment dans nom */
+	size_t     longueur;
+	int        sommet;
+
+	*debutTot = 0;
+	*debutTard = 0;
+	while (true) {
+		fin = strchr(nom,SEPARATEUR_PROGRAMME);
+		longueur = (fin != NULL) ? (size_t) (fin - nom) : strlen(nom);
+		if (longueur >= TAILLE_NOM) {
+			return SOMMET_INEXISTANT;
+		}
+		memcpy(segment,nom,longueur);
+		segment[longueur] = '\0';
+
+		calculDates(programme->graphePERT);
+		sommet = chercherTache(programme->graphePERT,segment);
+		if (sommet == -1) {
+			return SOMMET_INEXISTANT;
+		}
+		*debutTot += programme->graphePERT->dateTot[sommet-1];
+		*debutTard += programme->graphePERT->dateTard[sommet-1];
+
+		if (fin == NULL) {
+			return 0;
+		}
+		if (programme->sousProjets == NULL || programme->sousProjets[sommet-1] == NULL) {
+			return SOMMET_INEXISTANT;
+		}
+		programme = programme->sousProjets[sommet-1];
+		nom = fin + 1;
+	}
+}
+
+
+	/*
+	* Fonction : chargerNiveau
+	*
+	* Paramètres : const char *chemin, le fichier du niveau
+	*              TypProgramme *ancien, l'état précédent du niveau dont les
+	*                  sous-projets peuvent être repris, ou NULL
+	*              int profondeur, la profondeur du niveau
+	*              int *nbRecalculs, compte les niveaux relus ou recalculés
+	*
+	* Retour : TypProgramme*, le niveau chargé, ou NULL en cas d'échec
+	*
+	* Description : Voir chargerProgramme. Un sous-projet repris est retiré
+	*               de ancien puis mis à jour (voir majNiveau) ; en cas
+	*               d'échec il y est remis.
+	*/
+static TypProgramme* chargerNiveau(const char *chemin, TypProgramme *ancien, int profondeur, int *nbRecalculs) {
+	TypProgramme  *programme;   /* Le niveau chargé */
+	TypProgramme  **enfants;    /* Sous-projet de chaque ligne */
+	int           *origine;     /* Indice du sous-projet repris dans
+	                               ancien, ou -1 */
+	TypArene      *arene;       /* Arène du graphe du niveau */
+	TypTache      **taches;
+	int           *durees;
+	TypGraphePERT *graphePERT;
+	FILE          *fichier;
+	char          ligne[512];   /* Ligne lue dans le fichier */
+	char          nom[TAILLE_NOM];
+	char          nomFichier[TAILLE_CHEMIN];
+	char          *dependances;
+	char          *cheminEnfant;
+	struct timespec dateFichier;
+	off_t         tailleFichier;
+	int           position;     /* Caractères lus par sscanf */
+	int           nbLignes;
+	int           nbTaches;
+	bool          valide;
+	int           k;
+
+	if (profondeur > PROFONDEUR_MAX_PROGRAMME || !lireEtat(chemin,&dateFichier,&tailleFichier)
+			|| (fichier = fopen(chemin,"r")) == NULL) {
+		return NULL;
+	}
+
+	programme = malloc(sizeof(TypProgramme));
+	programme->chemin = malloc(strlen(chemin) + 1);
+	strcpy(programme->chemin,chemin);
+	programme->dateFichier = dateFichier;
+	programme->tailleFichier = tailleFichier;
+	programme->nbSousProjets = 0;
+	programme->sousProjets = NULL;
+	(*nbRecalculs)++;
+
+	/* Un chantier : niveau sans sous-projet */
+	graphePERT = lireGraphePERT(fichier);
+	if (graphePERT != NULL) {
+		fclose(fichier);
+		calculDates(graphePERT);
+		programme->graphePERT = graphePERT;
+		programme->dateFin = graphePERT->dateTot[graphePERT->graphe->nbrMaxSommets-1];
+		return programme;
+	}
+
+	/* Un programme : une tâche résumée par ligne */
+	rewind(fichier);
+	nbLignes = 0;
+	while (fgets(ligne,sizeof(ligne),fichier) != NULL) {
+		nbLignes++;
+	}
+	rewind(fichier);
+
+	arene = creerArene(nbLignes * (sizeof(TypTache) + TAILLE_NOM + TAILLE_CHEMIN) + 1024);
+	taches = allouerArene(arene,(nbLignes + 2) * sizeof(TypTache*));
+	durees = allouerArene(arene,(nbLignes + 2) * sizeof(int));
+	enfants = malloc((nbLignes > 0 ? nbLignes : 1) * sizeof(TypProgramme*));
+	origine = malloc((nbLignes > 0 ? nbLignes : 1) * sizeof(int));
+
+	nbTaches = 0;
+	valide = true;
+	while (valide && fgets(ligne,sizeof(ligne),fichier) != NULL) {
+		ligne[strcspn(ligne,"\r\n")] = '\0';
+		position = (int) strspn(ligne," \t");
+		if (ligne[position] == '#' || ligne[position] == '\0') {
+			continue;
+		}
+		position = 0;
+		valide = (sscanf(ligne," %63[^,], %255[^,]%n",nom,nomFichier,&position) == 2);
+		if (!valide) {
+			break;
+		}
+		couperFin(nom);
+		couperFin(nomFichier);
+		dependances = ligne + position;
+		dependances += (*dependances == ',') ? 1 : 0;
+		dependances += strspn(dependances," \t");
+		couperFin(dependances);
+		if (strcmp(dependances,"-") == 0) {
+			dependances[0] = '\0';
+		}
+
+		/* Un sous-projet repris reste compté, même en échec, pour être
+		   rendu à ancien */
+		cheminEnfant = cheminRelatif(chemin,nomFichier);
+		enfants[nbTaches] = reprendreSousProjet(ancien,cheminEnfant,&origine[nbTaches]);
+		if (enfants[nbTaches] != NULL) {
+			valide = (majNiveau(enfants[nbTaches],profondeur + 1,nbRecalculs) == 0);
+		}
+		else {
+			enfants[nbTaches] = chargerNiveau(cheminEnfant,NULL,profondeur + 1,nbRecalculs);
+			valide = (enfants[nbTaches] != NULL);
+		}
+		if (enfants[nbTaches] != NULL) {
+			taches[nbTaches] = creerTache(arene,copierArene(arene,nom),copierArene(arene,cheminEnfant),
+			                              copierArene(arene,dependances));
+			durees[nbTaches] = enfants[nbTaches]->dateFin;
+			nbTaches++;
+		}
+		free(cheminEnfant);
+	}
+	fclose(fichier);
+
+	graphePERT = (valide && nbTaches > 0) ? creerGraphePERT(arene,taches,durees,nbTaches) : NULL;
+
+	if (graphePERT == NULL) {
+		for (k = 0; k < nbTaches; k++) {
+			if (origine[k] != -1) {
+				ancien->sousProjets[origine[k]] = enfants[k];
+			}
+			else {
+				deleteProgramme(enfants[k]);
+			}
+		}
+		free(enfants);
+		free(origine);
+		deleteArene(arene);
+		free(programme->chemin);
+		free(programme);
+		return NULL;
+	}
+
+	calculDates(graphePERT);
+	programme->graphePERT = graphePERT;
+	programme->nbSousProjets = nbTaches;
+	programme->sousProjets = calloc(graphePERT->graphe->nbrMaxSommets,sizeof(TypProgramme*));
+	memcpy(programme->sousProjets,enfants,nbTaches * sizeof(TypProgramme*));
+	programme->dateFin = graphePERT->dateTot[graphePERT->graphe->nbrMaxSommets-1];
+	free(enfants);
+	free(origine);
+
+	return programme;
+}
+
+
+	/*
+	* Fonction : majNiveau
+	*
+	* Paramètres : TypProgramme *programme, un niveau chargé
+	*              int profondeur, sa profondeur
+	*              int *nbRecalculs, compte les niveaux relus ou recalculés
+	*
+	* Retour : int, 0 ou ERREUR_FICHIER si un fichier manque ou est
+	*              invalide
+	*
+	* Description : Voir majProgramme. Le niveau est modifié en place : son
+	*               adresse, connue du niveau au-dessus, ne change pas.
+	*/
+static int majNiveau(TypProgramme *programme, int profondeur, int *nbRecalculs) {
+	TypProgramme    *nouveau;        /* Le niveau relu */
+	TypModification *modifications;  /* Durées des tâches résumées */
+	TypGraphePERT   *graphePERT;
+	struct timespec dateFichier;
+	off_t           tailleFichier;
+	int             nbModifications;
+	int             nbSommets;
+	int             i;
+
+	if (!lireEtat(programme->chemin,&dateFichier,&tailleFichier)) {
+		return ERREUR_FICHIER;
+	}
+
+	/* Fichier modifié : le niveau est relu */
+	if (dateFichier.tv_sec != programme->dateFichier.tv_sec || dateFichier.tv_nsec != programme->dateFichier.tv_nsec
+			|| tailleFichier != programme->tailleFichier) {
+		nouveau = chargerNiveau(programme->chemin,programme,profondeur,nbRecalculs);
+		if (nouveau == NULL) {
+			return ERREUR_FICHIER;
+		}
+		for (i = 0; i < programme->graphePERT->graphe->nbrMaxSommets && programme->sousProjets != NULL; i++) {
+			if (programme->sousProjets[i] != NULL) {
+				deleteProgramme(programme->sousProjets[i]);
+			}
+		}
+		free(programme->sousProjets);
+		deleteGraphePERT(programme->graphePERT);
+		free(programme->chemin);
+		*programme = *nouveau;
+		free(nouveau);
+		return 0;
+	}
+
+	/* Fichier intact : seules les durées des sous-projets changés */
+	if (programme->sousProjets == NULL) {
+		return 0;
+	}
+	graphePERT = programme->graphePERT;
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	modifications = malloc(nbSommets * sizeof(TypModification));
+	nbModifications = 0;
+	for (i = 0; i < nbSommets; i++) {
+		if (programme->sousProjets[i] == NULL) {
+			continue;
+		}
+		if (majNiveau(programme->sousProjets[i],profondeur + 1,nbRecalculs) != 0) {
+			free(modifications);
+			return ERREUR_FICHIER;
+		}
+		if (programme->sousProjets[i]->dateFin != graphePERT->duree[i]) {
+			modifications[nbModifications].type = MODIF_DUREE;
+			modifications[nbModifications].sommet = i + 1;
+			modifications[nbModifications].predecesseur = 0;
+			modifications[nbModifications].duree = programme->sousProjets[i]->dateFin;
+			nbModifications++;
+		}
+	}
+	if (nbModifications > 0) {
+		calculDates(graphePERT);
+		majDates(graphePERT,modifications,nbModifications);
+		programme->dateFin = graphePERT->dateTot[nbSommets-1];
+		(*nbRecalculs)++;
+	}
+	free(modifications);
+
+	return 0;
+}
+
+
+	/*
+	* Fonction : reprendreSousProjet
+	*
+	* Paramètres : TypProgramme *ancien, un niveau, ou NULL
+	*              const char *chemin, le fichier d'un sous-projet
+	*              int *origine, rempli avec l'indice du sous-projet repris
+	*                  dans ancien, ou -1
+	*
+	* Retour : TypProgramme*, le sous-projet de ancien lu dans chemin,
+	*              retiré de ancien, ou NULL s'il n'y en a pas
+	*/
+static TypProgramme* reprendreSousProjet(TypProgramme *ancien, const char *chemin, int *origine) {
+	TypProgramme *sousProjet;
+	int          i;
+
+	*origine = -1;
+	if (ancien == NULL || ancien->sousProjets == NULL) {
+		return NULL;
+	}
+	for (i = 0; i < ancien->graphePERT->graphe->nbrMaxSommets; i++) {
+		if (ancien->sousProjets[i] != NULL && strcmp(ancien->sousProjets[i]->chemin,chemin) == 0) {
+			sousProjet = ancien->sousProjets[i];
+			ancien->sousProjets[i] = NULL;
+			*origine = i;
+			return sousProjet;
+		}
+	}
+
+	return NULL;
+}
+
+
+	/*
+	* Fonction : lireEtat
+	*
+	* Paramètres : const char *chemin, un fichier
+	*              struct timespec *date, rempli avec sa date de
+	*                  modification à la nanoseconde (une modification dans
+	*                  la même seconde, à taille égale, est ainsi vue)
+	*              off_t *taille, rempli avec sa taille
+	*
+	* Retour : bool, false si le fichier n'existe pas
+	*/
+static bool lireEtat(const char *chemin, struct timespec *date, off_t *taille) {
+	struct stat etat;
+
+	if (stat(chemin,&etat) != 0) {
+		return false;
+	}
+	*date = etat.st_mtim;
+	*taille = etat.st_size;
+
+	return true;
+}
+
+
+	/*
+	* Fonction : cheminRelatif
+	*
+	* Paramètres : const char *base, le fichier qui cite un autre fichier
+	*              const char *fichier, le fichier cité
+	*
+	* Retour : char*, le chemin du fichier cité, relatif au répertoire de
+	*              base s'il n'est pas absolu (mémoire allouée dans la
+	*              fonction)
+	*/
+static char* cheminRelatif(const char *base, const char *fichier) {
+	const char *separateur;  /* Dernier '/' de base */
+	size_t     longueur;     /* Longueur du répertoire de base */
+	char       *chemin;
+
+	separateur = strrchr(base,'/');
+	longueur = (fichier[0] != '/' && separateur != NULL) ? (size_t) (separateur - base + 1) : 0;
+	chemin = malloc(longueur + strlen(fichier) + 1);
+	memcpy(chemin,base,longueur);
+	strcpy(chemin + longueur,fichier);
+
+	return chemin;
+}
+
+
+	/*
+	* Fonction : copierArene
+	*
+	* Paramètres : TypArene *arene, une arène
+	*              const char *chaine, une chaîne
+	*
+	* Retour : char*, une copie de chaine prise dans l'arène
+	*/
+static char* copierArene(TypArene *arene, const char *chaine) {
+	char *copie;
+
+	copie = allouerArene(arene,strlen(chaine) + 1);
+	strcpy(copie,chaine);
+
+	return copie;
+}
+
+
+	/*
+	* Fonction : couperFin
+	*
+	* Paramètres : char *chaine, une chaîne
+	*
+	* Description : Retire les espaces en fin de chaîne.
+	*/
+static void couperFin(char *chaine) {
+	size_t longueur;
+
+	longueur = strlen(chaine);
+	while (longueur > 0 && (chaine[longueur-1] == ' ' || chaine[longueur-1] == '\t')) {
+		chaine[--longueur] = '\0';
+	}
+}
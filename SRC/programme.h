@@ -0,0 +1,46 @@
+#ifndef PROGRAMME_H
+#define PROGRAMME_H
+
+#include <stdbool.h>
+#include <time.h>
+#include <sys/types.h>
+#include "pert.h"
+
+
+/* Profondeur maximale d'imbrication des programmes */
+#define PROFONDEUR_MAX_PROGRAMME 32
+
+/* Séparateur des noms qualifiés, ex : "LOT1/B" */
+#define SEPARATEUR_PROGRAMME '/'
+
+/*
+* Programme : chantiers reliés par quelques dépendances. Chaque
+* sous-projet est une tâche résumée du niveau au-dessus, dont la durée est
+* la date de fin de son propre chantier ; un sous-projet peut lui-même
+* être un programme. Les dates d'un niveau sont relatives à son début.
+*/
+typedef struct TypProgramme {
+	char          *chemin;          /* Fichier lu pour ce niveau */
+	struct timespec dateFichier;    /* Date de modification du fichier lu,
+	                                   à la nanoseconde */
+	off_t         tailleFichier;    /* Taille du fichier lu */
+	TypGraphePERT *graphePERT;      /* Chantier de ce niveau : une tâche
+	                                   résumée par sous-projet pour un
+	                                   programme */
+	int           nbSousProjets;    /* 0 pour un chantier */
+	struct TypProgramme **sousProjets; /* Sous-projet de chaque tâche
+	                                      (indicé par sommet - 1) */
+	int           dateFin;          /* Résumé gardé en cache : durée du
+	                                   niveau */
+} TypProgramme;
+
+
+TypProgramme* chargerProgramme(const char*);
+
+void deleteProgramme(TypProgramme*);
+
+int majProgramme(TypProgramme*);
+
+int datesTacheProgramme(TypProgramme*,const char*,int*,int*);
+
+#endif
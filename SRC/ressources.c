@@ -0,0 +1,196 @@
+/*
+******************************************************************************
+*
+* Programme : ressources.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Ressources typées d'un chantier : capacité de chaque type et
+*          besoins de chaque tâche, lus dans un fichier de ressources.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include "libgraphe.h"
+#include "pert.h"
+#include "ressources.h"
+
+
+/* Longueur maximale du nom d'un type de ressource */
+#define TAILLE_NOM 64
+
+
+static int chercherType(TypRessources*,const char*);
+
+
+	/*
+	* Fonction : creerRessourcesOuvriers
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*              int nbOuvriers, le nombre d'ouvriers (>= 1)
+	*
+	* Retour : TypRessources*, les ressources créées
+	*
+	* Description : Crée un unique type "ouvrier" de nbOuvriers unités,
+	*               chaque tâche (hors alpha et oméga) en demandant une.
+	*               C'est le modèle utilisé par dureeTotale.
+	*/
+TypRessources* creerRessourcesOuvriers(TypGraphePERT *graphePERT, int nbOuvriers) {
+	TypRessources *ressources;  /* Les ressources créées */
+	int           i;            /* Permet le parcours des tâches */
+
+	ressources = malloc(sizeof(TypRessources));
+	ressources->nbTypes = 1;
+	ressources->noms = malloc(sizeof(char*));
+	ressources->noms[0] = malloc(strlen("ouvrier") + 1);
+	strcpy(ressources->noms[0],"ouvrier");
+	ressources->capacite = malloc(sizeof(int));
+	ressources->capacite[0] = nbOuvriers;
+	ressources->nbSommets = graphePERT->graphe->nbrMaxSommets;
+	ressources->besoin = malloc(ressources->nbSommets * sizeof(int));
+	for (i = 0; i < ressources->nbSommets; i++) {
+		ressources->besoin[i] = (i < ressources->nbSommets - 2) ? 1 : 0;
+	}
+
+	return ressources;
+}
+
+
+	/*
+	* Fonction : lireRessources
+	*
+	* Paramètres : FILE *fichier, un fichier de ressources ouvert en lecture
+	*              TypGraphePERT *graphePERT, le graphe PERT du chantier
+	*
+	* Retour : TypRessources*, les ressources lues, ou NULL si le fichier
+	*              cite une tâche inconnue ou un type non encore déclaré,
+	*              si une capacité ou une quantité est négative ou si une
+	*              ligne n'a aucune des deux formes
+	*
+	* Description : Lit un fichier de ressources. Les lignes commençant par
+	*               '#' sont ignorées ; les autres sont de la forme :
+	*                   macon, 2            (type de ressource, capacité)
+	*                   A, macon, 1         (tâche, type, quantité)
+	*               Un type doit être déclaré avant d'être demandé. Une tâche
+	*               sans besoin déclaré n'utilise aucune ressource. Les
+	*               lignes vides sont ignorées.
+	*/
+TypRessources* lireRessources(FILE *fichier, TypGraphePERT *graphePERT) {
+	TypRessources *ressources;        /* Les ressources lues */
+	char          ligne[512];         /* Ligne lue dans le fichier */
+	char          champ1[TAILLE_NOM]; /* Premier champ de la ligne */
+	char          champ2[TAILLE_NOM]; /* Deuxième champ de la ligne */
+	int           valeur;             /* Capacité ou quantité */
+	int           nbLignesBesoin;     /* Nombre de lignes de besoin lues */
+	int           type;               /* Indice d'un type de ressource */
+	int           sommet;             /* Indice d'une tâche */
+	bool          valide;             /* false si une ligne est invalide */
+
+	ressources = malloc(sizeof(TypRessources));
+	ressources->nbTypes = 0;
+	ressources->noms = NULL;
+	ressources->capacite = NULL;
+	ressources->nbSommets = graphePERT->graphe->nbrMaxSommets;
+	ressources->besoin = NULL;
+
+	/* Première passe : les types de ressources */
+	nbLignesBesoin = 0;
+	valide = true;
+	while (valide && fgets(ligne,sizeof(ligne),fichier) != NULL) {
+		if (ligne[0] == '#' || ligne[strspn(ligne," \t\r\n")] == '\0') {
+			continue;
+		}
+		if (sscanf(ligne," %63[^,], %63[^,], %d",champ1,champ2,&valeur) == 3) {
+			/* Le type doit avoir été déclaré sur une ligne précédente */
+			valide = (chercherType(ressources,champ2) != -1);
+			nbLignesBesoin++;
+		}
+		else if (sscanf(ligne," %63[^,], %d",champ1,&valeur) == 2 && valeur >= 0) {
+			ressources->noms = realloc(ressources->noms,(ressources->nbTypes + 1) * sizeof(char*));
+			ressources->capacite = realloc(ressources->capacite,(ressources->nbTypes + 1) * sizeof(int));
+			ressources->noms[ressources->nbTypes] = malloc(strlen(champ1) + 1);
+			strcpy(ressources->noms[ressources->nbTypes],champ1);
+			ressources->capacite[ressources->nbTypes] = valeur;
+			ressources->nbTypes++;
+		}
+		else {
+			valide = false;
+		}
+	}
+
+	if (!valide) {
+		deleteRessources(ressources);
+		return NULL;
+	}
+
+	ressources->besoin = calloc((ressources->nbSommets * ressources->nbTypes > 0)
+		? ressources->nbSommets * ressources->nbTypes : 1, sizeof(int));
+
+	/* Seconde passe : les besoins des tâches */
+	rewind(fichier);
+	while (nbLignesBesoin > 0 && fgets(ligne,sizeof(ligne),fichier) != NULL) {
+		if (ligne[0] == '#'
+				|| sscanf(ligne," %63[^,], %63[^,], %d",champ1,champ2,&valeur) != 3) {
+			continue;
+		}
+
+		sommet = chercherTache(graphePERT,champ1);
+		sommet = (sommet != -1) ? sommet - 1 : -1;
+		type = chercherType(ressources,champ2);
+
+		if (sommet == -1 || type == -1 || valeur < 0) {
+			deleteRessources(ressources);
+			return NULL;
+		}
+		ressources->besoin[sommet * ressources->nbTypes + type] = valeur;
+	}
+
+	return ressources;
+}
+
+
+	/*
+	* Fonction : deleteRessources
+	*
+	* Paramètres : TypRessources *ressources, les ressources à supprimer
+	*
+	* Description : Libère la mémoire occupée par les ressources.
+	*/
+void deleteRessources(TypRessources *ressources) {
+	int i;
+
+	for (i = 0; i < ressources->nbTypes; i++) {
+		free(ressources->noms[i]);
+	}
+	free(ressources->noms);
+	free(ressources->capacite);
+	free(ressources->besoin);
+	free(ressources);
+}
+
+
+	/*
+	* Fonction : chercherType
+	*
+	* Paramètres : TypRessources *ressources, des ressources
+	*              const char *nom, le nom d'un type de ressource
+	*
+	* Retour : int, l'indice du type, ou -1 s'il n'existe pas
+	*/
+static int chercherType(TypRessources *ressources, const char *nom) {
+	int r;
+
+	for (r = 0; r < ressources->nbTypes; r++) {
+		if (strcmp(ressources->noms[r],nom) == 0) {
+			return r;
+		}
+	}
+
+	return -1;
+}
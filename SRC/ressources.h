@@ -0,0 +1,29 @@
+#ifndef RESSOURCES_H
+#define RESSOURCES_H
+
+#include "pert.h"
+
+
+/*
+* Ressources typées d'un chantier (maçons, électriciens, ...). Chaque type
+* dispose d'un nombre d'unités fixé ; chaque tâche demande un certain
+* nombre d'unités de chaque type pendant toute sa durée. Les sommets sont
+* indicés à partir de 0 (sommet - 1).
+*/
+typedef struct TypRessources {
+	int  nbTypes;     /* Nombre de types de ressources */
+	char **noms;      /* Nom de chaque type */
+	int  *capacite;   /* Nombre d'unités de chaque type */
+	int  nbSommets;   /* Nombre de sommets du graphe PERT */
+	int  *besoin;     /* besoin[i * nbTypes + r] : unités du type r
+	                     demandées par la tâche i */
+} TypRessources;
+
+
+TypRessources* creerRessourcesOuvriers(TypGraphePERT*,int);
+
+TypRessources* lireRessources(FILE*,TypGraphePERT*);
+
+void deleteRessources(TypRessources*);
+
+#endif
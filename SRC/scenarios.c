@@ -0,0 +1,1274 @@
+/*
+******************************************************************************
+*
+* Programme : scenarios.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Évaluation par lot de scénarios « et si » (durées changées,
+*          dépendances ajoutées ou supprimées) sur un même chantier. Le
+*          graphe de départ n'est jamais modifié : chaque thread garde des
+*          copies de travail des dates, des durées et de l'ordre
+*          topologique, et les arêtes d'un scénario sont notées à part.
+*          Comme dans majDates, seules les dates touchées par le scénario
+*          sont recalculées, puis remises à leur valeur de départ. Alpha et
+*          oméga, reliés à beaucoup de tâches, ne sont jamais recalculés en
+*          parcourant tous leurs voisins.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "libgraphe.h"
+#include "pert.h"
+#include "erreurs.h"
+#include "scenarios.h"
+#include "topologie.h"
+
+
+/*
+* Copies de travail d'un thread. Les dates au plus tard sont gardées sous
+* forme de queue (plus long chemin du début du sommet à la fin du
+* chantier) : la queue ne dépend pas de la date de fin, un scénario qui la
+* change n'oblige donc pas à décaler toutes les dates.
+*/
+typedef struct TypEspaceScenario {
+	TypGraphePERT *graphePERT;      /* Le graphe de départ, en lecture seule */
+	int           nbSommets;
+	int           *dateTot;         /* Copies de travail indicées par */
+	int           *queue;           /*   sommet - 1 */
+	int           *duree;
+	int           *rangTopo;
+	int           *ordreTopo;       /* Indicé par rang */
+	int           *modifies;        /* Sommets dont une copie a changé */
+	int           nbModifies;
+	int           *marque;          /* marque[s-1] == numero : s est dans modifies */
+	int           numero;           /* Numéro du scénario en cours */
+	int           *vu;              /* vu[s-1] == parcours : s a été atteint */
+	int           parcours;         /* Numéro du parcours en cours */
+	int           *tasAval;         /* Sommets dont la date au plus tôt est à revoir */
+	int           *tasAmont;        /* Sommets dont la queue est à revoir */
+	bool          *dansAval;
+	bool          *dansAmont;
+	int           nbAval, nbAmont;
+	int           *pile;
+	int           *rangsAval;       /* Zones de travail de reordonnerScenario */
+	int           *rangsAmont;
+	int           *rangs;
+	int           *sommets;
+	int           *voisins;         /* Voisins rendus par voisinsScenario */
+	int           *ecarts;          /* Écart entre les débuts imposé par
+	                                   l'arête vers chacun (voir ecartLien) */
+	int           *ajoutDepart;     /* Arêtes ajoutées par le scénario */
+	int           *ajoutArrivee;
+	int           nbAjouts;
+	int           *retraitDepart;   /* Arêtes du graphe retirées par le scénario */
+	int           *retraitArrivee;
+	int           nbRetraits;
+	const int     *predsFin;        /* Prédécesseurs d'oméga, par fin au plus
+	                                   tôt décroissante */
+	int           nbPredsFin;
+	const int     *succsDebut;      /* Successeurs d'alpha, par queue
+	                                   décroissante */
+	const int     *critiquesDebut;  /* Les mêmes, par date au plus tôt plus
+	                                   queue décroissante */
+	int           nbSuccsDebut;
+	long long     sommeDurees;      /* Voir TypGraphePERT, pour le scénario
+	                                   en cours */
+} TypEspaceScenario;
+
+/*
+* État partagé par les threads.
+*/
+typedef struct TypLotScenarios {
+	TypGraphePERT       *graphePERT;
+	TypScenario         *scenarios;
+	TypResultatScenario *resultats;
+	int                 nbScenarios;
+	int                 suivant;          /* Prochain scénario à évaluer */
+	int                 capaciteAjouts;   /* Arêtes ajoutées par un scénario, au plus */
+	int                 capaciteVoisins;  /* Voisins d'un sommet, au plus */
+	int                 *predsFin;        /* Voir TypEspaceScenario */
+	int                 nbPredsFin;
+	int                 *succsDebut;
+	int                 *critiquesDebut;
+	int                 nbSuccsDebut;
+	pthread_mutex_t     verrou;
+} TypLotScenarios;
+
+/*
+* Sommet et clé de tri.
+*/
+typedef struct TypCleSommet {
+	int cle;
+	int sommet;
+} TypCleSommet;
+
+
+static TypResultatScenario* resultatsEnErreur(int,int);
+static void* travaillerScenarios(void*);
+static TypEspaceScenario* creerEspaceScenario(TypLotScenarios*);
+static void deleteEspaceScenario(TypEspaceScenario*);
+static void evaluerScenario(TypEspaceScenario*,TypScenario*,TypResultatScenario*);
+static int appliquerModification(TypEspaceScenario*,TypModification*);
+static void propagerDates(TypEspaceScenario*);
+static int dateFinScenario(TypEspaceScenario*);
+static int queueDebutScenario(TypEspaceScenario*);
+static void chercherCritiques(TypEspaceScenario*,TypResultatScenario*);
+static void empilerCritique(TypEspaceScenario*,int*,int,int);
+static int reordonnerScenario(TypEspaceScenario*,int,int);
+static int voisinsReordonnement(void*,int,bool,int*);
+static int voisinsScenario(TypEspaceScenario*,int,bool);
+static bool debutBorneScenario(TypEspaceScenario*,int);
+static bool finBorneeScenario(TypEspaceScenario*,int);
+static bool areteScenario(TypEspaceScenario*,int,int);
+static bool areteRetiree(TypEspaceScenario*,int,int);
+static void ajouterAreteScenario(TypEspaceScenario*,int,int);
+static void retirerAreteScenario(TypEspaceScenario*,int,int);
+static int chercherArete(const int*,const int*,int,int,int);
+static void noterModifie(TypEspaceScenario*,int);
+static void restaurer(TypEspaceScenario*);
+static int* trierSommets(TypVoisins*,const int*,int*);
+static int comparerCles(const void*, const void*);
+
+
+	/*
+	* Fonction : evaluerScenarios
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*                  dont les dates ont été calculées ; il n'est pas
+	*                  modifié et peut être lu en même temps par d'autres
+	*              TypScenario *scenarios, les scénarios à évaluer
+	*              int nbScenarios, la taille du tableau scenarios
+	*              int nbThreads, le nombre de threads (<= 0 : un par
+	*                  processeur)
+	*
+	* Retour : TypResultatScenario*, le résultat de chaque scénario, à
+	*              libérer avec deleteResultatsScenarios ; si la mémoire
+	*              manque, aucun scénario n'est évalué (ERREUR_MEMOIRE)
+	*
+	* Description : Chaque thread prend le prochain scénario non évalué.
+	*               Ses copies de travail sont faites une fois ; un
+	*               scénario ne coûte ensuite que les sommets dont les
+	*               dates changent et le parcours de ses tâches critiques.
+	*               Les voisins d'alpha et d'oméga sont triés une fois pour
+	*               tous les scénarios.
+	*/
+TypResultatScenario* evaluerScenarios(TypGraphePERT *graphePERT, TypScenario *scenarios, int nbScenarios, int nbThreads) {
+	TypLotScenarios     lot;        /* État partagé */
+	pthread_t           *threads;   /* Les threads lancés */
+	int                 *cle;       /* Clé de tri de chaque sommet */
+	int                 nbSommets;  /* Le nombre de sommets du graphe */
+	int                 dateFin;    /* Date de fin du chantier */
+	int                 degre;
+	int                 i, t;
+
+	if (nbThreads <= 0) {
+		nbThreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	if (nbThreads > nbScenarios) {
+		nbThreads = nbScenarios;
+	}
+	if (nbThreads < 1) {
+		nbThreads = 1;
+	}
+
+	/* Un scénario ajoute au plus deux arêtes par modification */
+	lot.capaciteAjouts = 0;
+	for (i = 0; i < nbScenarios; i++) {
+		if (2 * scenarios[i].nbModifications > lot.capaciteAjouts) {
+			lot.capaciteAjouts = 2 * scenarios[i].nbModifications;
+		}
+	}
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	if (nbSommets < 2) {
+		/* Alpha et oméga manquent : le graphe n'est pas un graphe PERT */
+		return resultatsEnErreur(nbScenarios,GRAPHE_INEXISTANT);
+	}
+	lot.capaciteVoisins = 0;
+	for (i = 1; i <= nbSommets; i++) {
+		degre = degreSommet(graphePERT->graphe,i);
+		if (degre > lot.capaciteVoisins) {
+			lot.capaciteVoisins = degre;
+		}
+		degre = degreSommet(graphePERT->grapheInverse,i);
+		if (degre > lot.capaciteVoisins) {
+			lot.capaciteVoisins = degre;
+		}
+	}
+	lot.capaciteVoisins += lot.capaciteAjouts;
+
+	dateFin = graphePERT->dateTot[nbSommets-1];
+	cle = malloc(nbSommets * sizeof(int));
+	if (cle == NULL) {
+		return resultatsEnErreur(nbScenarios,ERREUR_MEMOIRE);
+	}
+	for (i = 0; i < nbSommets; i++) {
+		cle[i] = graphePERT->dateTot[i] + graphePERT->duree[i];
+	}
+	lot.predsFin = trierSommets(graphePERT->grapheInverse->listesAdjacences[nbSommets-1],cle,&lot.nbPredsFin);
+	for (i = 0; i < nbSommets; i++) {
+		cle[i] = dateFin - graphePERT->dateTard[i];
+	}
+	lot.succsDebut = trierSommets(graphePERT->graphe->listesAdjacences[nbSommets-2],cle,&lot.nbSuccsDebut);
+	for (i = 0; i < nbSommets; i++) {
+		cle[i] += graphePERT->dateTot[i];
+	}
+	lot.critiquesDebut = trierSommets(graphePERT->graphe->listesAdjacences[nbSommets-2],cle,&lot.nbSuccsDebut);
+	free(cle);
+
+	lot.graphePERT = graphePERT;
+	lot.scenarios = scenarios;
+	lot.nbScenarios = nbScenarios;
+	lot.resultats = calloc((nbScenarios > 0) ? nbScenarios : 1, sizeof(TypResultatScenario));
+	lot.suivant = 0;
+	pthread_mutex_init(&lot.verrou,NULL);
+
+	threads = malloc(nbThreads * sizeof(pthread_t));
+	for (t = 1; t < nbThreads; t++) {
+		pthread_create(&threads[t],NULL,travaillerScenarios,&lot);
+	}
+	travaillerScenarios(&lot);
+	for (t = 1; t < nbThreads; t++) {
+		pthread_join(threads[t],NULL);
+	}
+
+	free(threads);
+	free(lot.predsFin);
+	free(lot.succsDebut);
+	free(lot.critiquesDebut);
+	pthread_mutex_destroy(&lot.verrou);
+
+	return lot.resultats;
+}
+
+
+	/*
+	* Fonction : deleteResultatsScenarios
+	*
+	* Paramètres : TypResultatScenario *resultats, les résultats renvoyés
+	*                  par evaluerScenarios
+	*              int nbScenarios, le nombre de scénarios évalués
+	*/
+void deleteResultatsScenarios(TypResultatScenario *resultats, int nbScenarios) {
+	int i;
+
+	for (i = 0; i < nbScenarios; i++) {
+		free(resultats[i].critiques);
+	}
+	free(resultats);
+}
+
+
+	/*
+	* Fonction : resultatsEnErreur
+	*
+	* Paramètres : int nbScenarios, le nombre de scénarios
+	*              int erreur, le code d'erreur de chaque scénario
+	*
+	* Retour : TypResultatScenario*, les résultats de scénarios non
+	*              évalués, ou NULL si la mémoire manque
+	*/
+static TypResultatScenario* resultatsEnErreur(int nbScenarios, int erreur) {
+	TypResultatScenario *resultats;
+	int                 i;
+
+	resultats = calloc((nbScenarios > 0) ? nbScenarios : 1, sizeof(TypResultatScenario));
+	if (resultats != NULL) {
+		for (i = 0; i < nbScenarios; i++) {
+			resultats[i].erreur = erreur;
+		}
+	}
+	return resultats;
+}
+
+
+	/*
+	* Fonction : travaillerScenarios
+	*
+	* Paramètres : void *arg, pointeur sur le TypLotScenarios partagé
+	*
+	* Retour : void*, NULL
+	*
+	* Description : Évalue des scénarios tant qu'il en reste, avec un seul
+	*               espace de travail.
+	*/
+static void* travaillerScenarios(void *arg) {
+	TypLotScenarios   *lot;
+	TypEspaceScenario *espace;
+	int               i;
+
+	lot = arg;
+	espace = creerEspaceScenario(lot);
+
+	while (true) {
+		pthread_mutex_lock(&lot->verrou);
+		i = lot->suivant;
+		lot->suivant++;
+		pthread_mutex_unlock(&lot->verrou);
+
+		if (i >= lot->nbScenarios) {
+			break;
+		}
+		evaluerScenario(espace,&lot->scenarios[i],&lot->resultats[i]);
+	}
+
+	deleteEspaceScenario(espace);
+
+	return NULL;
+}
+
+
+	/*
+	* Fonction : creerEspaceScenario
+	*
+	* Paramètres : TypLotScenarios *lot, l'état partagé
+	*
+	* Retour : TypEspaceScenario*, un espace dont les copies sont égales
+	*              au graphe de départ
+	*/
+static TypEspaceScenario* creerEspaceScenario(TypLotScenarios *lot) {
+	TypEspaceScenario *espace;
+	TypGraphePERT     *graphePERT;
+	int               capaciteAjouts;
+	int               capaciteVoisins;
+	int               nbSommets;
+	int               dateFin;
+	int               i;
+
+	graphePERT = lot->graphePERT;
+	capaciteAjouts = lot->capaciteAjouts;
+	capaciteVoisins = lot->capaciteVoisins;
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	dateFin = graphePERT->dateTot[nbSommets-1];
+
+	espace = malloc(sizeof(TypEspaceScenario));
+	espace->graphePERT = graphePERT;
+	espace->nbSommets = nbSommets;
+	espace->dateTot = malloc(nbSommets * sizeof(int));
+	espace->queue = malloc(nbSommets * sizeof(int));
+	espace->duree = malloc(nbSommets * sizeof(int));
+	espace->rangTopo = malloc(nbSommets * sizeof(int));
+	espace->ordreTopo = malloc(nbSommets * sizeof(int));
+	espace->modifies = malloc(nbSommets * sizeof(int));
+	espace->marque = calloc(nbSommets, sizeof(int));
+	espace->numero = 0;
+	espace->vu = calloc(nbSommets, sizeof(int));
+	espace->parcours = 0;
+	espace->tasAval = malloc(nbSommets * sizeof(int));
+	espace->tasAmont = malloc(nbSommets * sizeof(int));
+	espace->dansAval = calloc(nbSommets, sizeof(bool));
+	espace->dansAmont = calloc(nbSommets, sizeof(bool));
+	espace->pile = malloc(nbSommets * sizeof(int));
+	espace->rangsAval = malloc(nbSommets * sizeof(int));
+	espace->rangsAmont = malloc(nbSommets * sizeof(int));
+	espace->rangs = malloc(nbSommets * sizeof(int));
+	espace->sommets = malloc(nbSommets * sizeof(int));
+	espace->voisins = malloc((capaciteVoisins > 0 ? capaciteVoisins : 1) * sizeof(int));
+	espace->ecarts = malloc((capaciteVoisins > 0 ? capaciteVoisins : 1) * sizeof(int));
+	espace->ajoutDepart = malloc((capaciteAjouts > 0 ? capaciteAjouts : 1) * sizeof(int));
+	espace->ajoutArrivee = malloc((capaciteAjouts > 0 ? capaciteAjouts : 1) * sizeof(int));
+	espace->retraitDepart = malloc((capaciteAjouts > 0 ? capaciteAjouts : 1) * sizeof(int));
+	espace->retraitArrivee = malloc((capaciteAjouts > 0 ? capaciteAjouts : 1) * sizeof(int));
+	espace->predsFin = lot->predsFin;
+	espace->nbPredsFin = lot->nbPredsFin;
+	espace->succsDebut = lot->succsDebut;
+	espace->critiquesDebut = lot->critiquesDebut;
+	espace->nbSuccsDebut = lot->nbSuccsDebut;
+
+	for (i = 0; i < nbSommets; i++) {
+		espace->dateTot[i] = graphePERT->dateTot[i];
+		espace->queue[i] = dateFin - graphePERT->dateTard[i];
+		espace->duree[i] = graphePERT->duree[i];
+		espace->rangTopo[i] = graphePERT->rangTopo[i];
+		espace->ordreTopo[i] = graphePERT->ordreTopo[i];
+	}
+
+	return espace;
+}
+
+
+	/*
+	* Fonction : deleteEspaceScenario
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace à libérer
+	*/
+static void deleteEspaceScenario(TypEspaceScenario *espace) {
+	free(espace->dateTot);
+	free(espace->queue);
+	free(espace->duree);
+	free(espace->rangTopo);
+	free(espace->ordreTopo);
+	free(espace->modifies);
+	free(espace->marque);
+	free(espace->vu);
+	free(espace->tasAval);
+	free(espace->tasAmont);
+	free(espace->dansAval);
+	free(espace->dansAmont);
+	free(espace->pile);
+	free(espace->rangsAval);
+	free(espace->rangsAmont);
+	free(espace->rangs);
+	free(espace->sommets);
+	free(espace->voisins);
+	free(espace->ecarts);
+	free(espace->ajoutDepart);
+	free(espace->ajoutArrivee);
+	free(espace->retraitDepart);
+	free(espace->retraitArrivee);
+	free(espace);
+}
+
+
+	/*
+	* Fonction : evaluerScenario
+	*
+	* Paramètres : TypEspaceScenario *espace, un espace égal au graphe de
+	*                  départ
+	*              TypScenario *scenario, le scénario à évaluer
+	*              TypResultatScenario *resultat, le résultat à remplir
+	*
+	* Description : Applique les modifications aux copies de travail (les
+	*               sommets à revoir sont notés, comme dans majDates), met
+	*               les dates à jour, relève la date de fin et les tâches
+	*               critiques, puis remet l'espace dans son état de départ.
+	*/
+static void evaluerScenario(TypEspaceScenario *espace, TypScenario *scenario, TypResultatScenario *resultat) {
+	int erreur;  /* Code d'erreur de la modification courante */
+	int i;
+
+	espace->numero++;
+	espace->sommeDurees = espace->graphePERT->sommeDurees;
+	espace->nbModifies = 0;
+	espace->nbAjouts = 0;
+	espace->nbRetraits = 0;
+	espace->nbAval = 0;
+	espace->nbAmont = 0;
+
+	erreur = 0;
+	for (i = 0; i < scenario->nbModifications && erreur == 0; i++) {
+		erreur = appliquerModification(espace,&scenario->modifications[i]);
+	}
+
+	resultat->erreur = erreur;
+	resultat->dateFin = 0;
+	resultat->nbCritiques = 0;
+	resultat->critiques = NULL;
+
+	if (erreur == 0) {
+		propagerDates(espace);
+		resultat->dateFin = espace->dateTot[espace->nbSommets-1];
+		chercherCritiques(espace,resultat);
+	}
+	else {
+		for (i = 0; i < espace->nbAval; i++) {
+			espace->dansAval[espace->tasAval[i]-1] = false;
+		}
+		for (i = 0; i < espace->nbAmont; i++) {
+			espace->dansAmont[espace->tasAmont[i]-1] = false;
+		}
+	}
+
+	restaurer(espace);
+}
+
+
+	/*
+	* Fonction : appliquerModification
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario
+	*              TypModification *modif, la modification à appliquer
+	*
+	* Retour : int, 0 si la modification est appliquée sinon un code
+	*             d'erreur, avec les mêmes règles que majDates
+	*
+	* Description : Les arêtes alpha -> sommet et predecesseur -> oméga
+	*               rendues inutiles par un ajout sont gardées : elles ne
+	*               changent aucune date.
+	*/
+static int appliquerModification(TypEspaceScenario *espace, TypModification *modif) {
+	int nbSommets;  /* Le nombre de sommets du graphe */
+	int nbVoisins;
+	int erreur;
+	int s, p, i;
+
+	nbSommets = espace->nbSommets;
+	s = modif->sommet;
+	p = modif->predecesseur;
+
+	/* Seules les tâches du chantier (ni alpha ni oméga) sont modifiables */
+	if (s < 1 || s > nbSommets - 2) {
+		return SOMMET_INEXISTANT;
+	}
+
+	if (modif->type == MODIF_DUREE) {
+		if (modif->duree < 0 || espace->sommeDurees - espace->duree[s-1] + modif->duree > DUREE_MAX_CHANTIER) {
+			return POIDS_INVALIDE;
+		}
+		noterModifie(espace,s);
+		espace->sommeDurees += modif->duree - espace->duree[s-1];
+		espace->duree[s-1] = modif->duree;
+		nbVoisins = voisinsScenario(espace,s,true);
+		for (i = 0; i < nbVoisins; i++) {
+			noterSommet(espace->tasAval,&espace->nbAval,espace->dansAval,espace->voisins[i]);
+		}
+		/* Les dépendances FF et SF vers s dépendent de sa durée */
+		if (espace->graphePERT->liensTypes) {
+			noterSommet(espace->tasAval,&espace->nbAval,espace->dansAval,s);
+			nbVoisins = voisinsScenario(espace,s,false);
+			for (i = 0; i < nbVoisins; i++) {
+				noterSommet(espace->tasAmont,&espace->nbAmont,espace->dansAmont,espace->voisins[i]);
+			}
+		}
+		noterSommet(espace->tasAmont,&espace->nbAmont,espace->dansAmont,s);
+		return 0;
+	}
+
+	if (p < 1 || p > nbSommets - 2 || p == s) {
+		return SOMMET_INEXISTANT;
+	}
+
+	if (modif->type == MODIF_AJOUT_DEPENDANCE) {
+		if (areteScenario(espace,p,s)) {
+			return ARETE_EXISTANTE;
+		}
+		if (espace->rangTopo[p-1] > espace->rangTopo[s-1]) {
+			erreur = reordonnerScenario(espace,p,s);
+			if (erreur != 0) {
+				return erreur;
+			}
+		}
+		ajouterAreteScenario(espace,p,s);
+	}
+	else {
+		if (! areteScenario(espace,p,s)) {
+			return ARETE_INEXISTANTE;
+		}
+		retirerAreteScenario(espace,p,s);
+
+		/* Une tâche dont aucun prédécesseur ne borne le début est
+		   reliée à alpha */
+		if (! debutBorneScenario(espace,s) && ! areteScenario(espace,nbSommets-1,s)) {
+			ajouterAreteScenario(espace,nbSommets-1,s);
+			noterSommet(espace->tasAmont,&espace->nbAmont,espace->dansAmont,nbSommets-1);
+		}
+		/* Une tâche dont aucun successeur ne borne la fin est reliée à
+		   oméga */
+		if (! finBorneeScenario(espace,p) && ! areteScenario(espace,p,nbSommets)) {
+			ajouterAreteScenario(espace,p,nbSommets);
+			noterSommet(espace->tasAval,&espace->nbAval,espace->dansAval,nbSommets);
+		}
+	}
+	noterSommet(espace->tasAval,&espace->nbAval,espace->dansAval,s);
+	noterSommet(espace->tasAmont,&espace->nbAmont,espace->dansAmont,p);
+
+	return 0;
+}
+
+
+	/*
+	* Fonction : propagerDates
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario, où les
+	*                  sommets à revoir sont notés
+	*
+	* Description : Recalcule les dates au plus tôt vers l'aval dans l'ordre
+	*               topologique, puis les queues vers l'amont dans l'ordre
+	*               inverse, avec l'écart qu'impose chaque dépendance
+	*               (comme dateAuPlusTot et dateAuPlusTard). La propagation
+	*               s'arrête dès qu'une valeur ne change plus.
+	*/
+static void propagerDates(TypEspaceScenario *espace) {
+	int nbVoisins;
+	int date;       /* Une date ou une queue recalculée */
+	int n;
+	int s, v, i;
+
+	/* Les sommets notés sont rangés en tas selon l'ordre topologique */
+	n = espace->nbAval;
+	espace->nbAval = 0;
+	while (espace->nbAval < n) {
+		tasInsererRang(espace->tasAval,&espace->nbAval,espace->rangTopo,1,espace->tasAval[espace->nbAval]);
+	}
+	n = espace->nbAmont;
+	espace->nbAmont = 0;
+	while (espace->nbAmont < n) {
+		tasInsererRang(espace->tasAmont,&espace->nbAmont,espace->rangTopo,-1,espace->tasAmont[espace->nbAmont]);
+	}
+
+	/* Dates au plus tôt : plus grand début d'un prédécesseur plus l'écart */
+	while (espace->nbAval > 0) {
+		s = tasExtraireRang(espace->tasAval,&espace->nbAval,espace->rangTopo,1);
+		espace->dansAval[s-1] = false;
+
+		if (s == espace->nbSommets) {
+			date = dateFinScenario(espace);
+		}
+		else {
+			date = 0;
+			nbVoisins = voisinsScenario(espace,s,false);
+			for (i = 0; i < nbVoisins; i++) {
+				v = espace->voisins[i];
+				if (espace->dateTot[v-1] + espace->ecarts[i] > date) {
+					date = espace->dateTot[v-1] + espace->ecarts[i];
+				}
+			}
+		}
+
+		if (date != espace->dateTot[s-1]) {
+			noterModifie(espace,s);
+			espace->dateTot[s-1] = date;
+			nbVoisins = voisinsScenario(espace,s,true);
+			for (i = 0; i < nbVoisins; i++) {
+				v = espace->voisins[i];
+				if (! espace->dansAval[v-1]) {
+					espace->dansAval[v-1] = true;
+					tasInsererRang(espace->tasAval,&espace->nbAval,espace->rangTopo,1,v);
+				}
+			}
+		}
+	}
+
+	/* Queues : au moins la durée, et l'écart plus la queue de chaque
+	   successeur */
+	while (espace->nbAmont > 0) {
+		s = tasExtraireRang(espace->tasAmont,&espace->nbAmont,espace->rangTopo,-1);
+		espace->dansAmont[s-1] = false;
+
+		if (s == espace->nbSommets - 1) {
+			/* Alpha dure 0 et ses dépendances sont fin-début */
+			date = queueDebutScenario(espace);
+		}
+		else {
+			date = espace->duree[s-1];
+			nbVoisins = voisinsScenario(espace,s,true);
+			for (i = 0; i < nbVoisins; i++) {
+				v = espace->voisins[i];
+				if (espace->ecarts[i] + espace->queue[v-1] > date) {
+					date = espace->ecarts[i] + espace->queue[v-1];
+				}
+			}
+		}
+
+		if (date != espace->queue[s-1]) {
+			noterModifie(espace,s);
+			espace->queue[s-1] = date;
+			nbVoisins = voisinsScenario(espace,s,false);
+			for (i = 0; i < nbVoisins; i++) {
+				v = espace->voisins[i];
+				if (! espace->dansAmont[v-1]) {
+					espace->dansAmont[v-1] = true;
+					tasInsererRang(espace->tasAmont,&espace->nbAmont,espace->rangTopo,-1,v);
+				}
+			}
+		}
+	}
+}
+
+
+	/*
+	* Fonction : dateFinScenario
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario, dont
+	*                  les autres dates au plus tôt sont à jour
+	*
+	* Retour : int, la date au plus tôt d'oméga
+	*
+	* Description : Seuls les prédécesseurs modifiés par le scénario sont
+	*               examinés un par un. Les autres ont gardé leur fin de
+	*               départ : le premier d'entre eux dans predsFin a la plus
+	*               grande.
+	*/
+static int dateFinScenario(TypEspaceScenario *espace) {
+	TypGraphe *graphe;
+	int       omega;   /* Le sommet oméga */
+	int       date;    /* La date calculée */
+	int       v, i;
+
+	graphe = espace->graphePERT->graphe;
+	omega = espace->nbSommets;
+	date = 0;
+
+	for (i = 0; i < espace->nbModifies; i++) {
+		v = espace->modifies[i];
+		if (areteExistante(graphe,v,omega) == 0 && espace->dateTot[v-1] + espace->duree[v-1] > date) {
+			date = espace->dateTot[v-1] + espace->duree[v-1];
+		}
+	}
+	for (i = 0; i < espace->nbAjouts; i++) {
+		v = espace->ajoutDepart[i];
+		if (espace->ajoutArrivee[i] == omega && espace->dateTot[v-1] + espace->duree[v-1] > date) {
+			date = espace->dateTot[v-1] + espace->duree[v-1];
+		}
+	}
+	for (i = 0; i < espace->nbPredsFin; i++) {
+		v = espace->predsFin[i];
+		if (espace->marque[v-1] != espace->numero) {
+			if (espace->dateTot[v-1] + espace->duree[v-1] > date) {
+				date = espace->dateTot[v-1] + espace->duree[v-1];
+			}
+			break;
+		}
+	}
+
+	return date;
+}
+
+
+	/*
+	* Fonction : queueDebutScenario
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario, dont
+	*                  les autres queues sont à jour
+	*
+	* Retour : int, la plus grande queue d'un successeur d'alpha
+	*
+	* Description : Comme dateFinScenario, avec succsDebut.
+	*/
+static int queueDebutScenario(TypEspaceScenario *espace) {
+	TypGraphe *grapheInverse;
+	int       alpha;   /* Le sommet alpha */
+	int       date;    /* La queue calculée */
+	int       v, i;
+
+	grapheInverse = espace->graphePERT->grapheInverse;
+	alpha = espace->nbSommets - 1;
+	date = 0;
+
+	for (i = 0; i < espace->nbModifies; i++) {
+		v = espace->modifies[i];
+		if (areteExistante(grapheInverse,v,alpha) == 0 && espace->queue[v-1] > date) {
+			date = espace->queue[v-1];
+		}
+	}
+	for (i = 0; i < espace->nbAjouts; i++) {
+		v = espace->ajoutArrivee[i];
+		if (espace->ajoutDepart[i] == alpha && espace->queue[v-1] > date) {
+			date = espace->queue[v-1];
+		}
+	}
+	for (i = 0; i < espace->nbSuccsDebut; i++) {
+		v = espace->succsDebut[i];
+		if (espace->marque[v-1] != espace->numero) {
+			if (espace->queue[v-1] > date) {
+				date = espace->queue[v-1];
+			}
+			break;
+		}
+	}
+
+	return date;
+}
+
+
+	/*
+	* Fonction : chercherCritiques
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario, dont
+	*                  les dates sont à jour
+	*              TypResultatScenario *resultat, le résultat à compléter
+	*
+	* Description : Une tâche est critique si sa date au plus tôt plus sa
+	*               queue égale la date de fin. Toute tâche critique est sur
+	*               un chemin de tâches critiques depuis alpha : un parcours
+	*               depuis alpha qui ne traverse que des tâches critiques
+	*               les trouve toutes, sans parcourir le reste du graphe.
+	*               Les successeurs d'alpha non modifiés sont pris dans
+	*               critiquesDebut tant qu'ils sont critiques.
+	*/
+static void chercherCritiques(TypEspaceScenario *espace, TypResultatScenario *resultat) {
+	TypGraphe *grapheInverse;
+	int       *critiques;  /* Tâches critiques trouvées */
+	int       nbCritiques;
+	int       nbPile;
+	int       nbVoisins;
+	int       alpha;       /* Le sommet alpha */
+	int       s, v, i;
+
+	grapheInverse = espace->graphePERT->grapheInverse;
+	alpha = espace->nbSommets - 1;
+	critiques = espace->rangsAval;
+	nbCritiques = 0;
+	nbPile = 0;
+	espace->parcours++;
+	espace->vu[alpha-1] = espace->parcours;
+
+	/* Successeurs critiques d'alpha */
+	for (i = 0; i < espace->nbModifies; i++) {
+		v = espace->modifies[i];
+		if (areteExistante(grapheInverse,v,alpha) == 0) {
+			empilerCritique(espace,&nbPile,v,resultat->dateFin);
+		}
+	}
+	for (i = 0; i < espace->nbAjouts; i++) {
+		if (espace->ajoutDepart[i] == alpha) {
+			empilerCritique(espace,&nbPile,espace->ajoutArrivee[i],resultat->dateFin);
+		}
+	}
+	for (i = 0; i < espace->nbSuccsDebut; i++) {
+		v = espace->critiquesDebut[i];
+		if (espace->marque[v-1] == espace->numero) {
+			continue;
+		}
+		if (espace->dateTot[v-1] + espace->queue[v-1] != resultat->dateFin) {
+			break;
+		}
+		empilerCritique(espace,&nbPile,v,resultat->dateFin);
+	}
+
+	while (nbPile > 0) {
+		s = espace->pile[--nbPile];
+		if (s <= espace->nbSommets - 2) {
+			critiques[nbCritiques++] = s - 1;
+		}
+		nbVoisins = voisinsScenario(espace,s,true);
+		for (i = 0; i < nbVoisins; i++) {
+			empilerCritique(espace,&nbPile,espace->voisins[i],resultat->dateFin);
+		}
+	}
+
+	qsort(critiques,nbCritiques,sizeof(int),comparerEntiers);
+	resultat->nbCritiques = nbCritiques;
+	resultat->critiques = malloc((nbCritiques > 0 ? nbCritiques : 1) * sizeof(int));
+	for (i = 0; i < nbCritiques; i++) {
+		resultat->critiques[i] = critiques[i];
+	}
+}
+
+
+	/*
+	* Fonction : empilerCritique
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario
+	*              int *nbPile, la taille de la pile du parcours
+	*              int sommet, un sommet atteint par le parcours
+	*              int dateFin, la date de fin du scénario
+	*
+	* Description : Empile le sommet s'il est critique et n'a pas encore
+	*               été atteint.
+	*/
+static void empilerCritique(TypEspaceScenario *espace, int *nbPile, int sommet, int dateFin) {
+	if (espace->vu[sommet-1] != espace->parcours
+			&& espace->dateTot[sommet-1] + espace->queue[sommet-1] == dateFin) {
+		espace->vu[sommet-1] = espace->parcours;
+		espace->pile[(*nbPile)++] = sommet;
+	}
+}
+
+
+	/*
+	* Fonction : reordonnerScenario
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario
+	*              int predecesseur, int sommet, l'arête predecesseur ->
+	*                  sommet qui va être ajoutée, avec
+	*                  rang(predecesseur) > rang(sommet)
+	*
+	* Retour : int, 0 si l'ordre a été corrigé, CIRCUIT si l'arête
+	*             fermerait un circuit (l'ordre est alors inchangé)
+	*
+	* Description : Corrige les rangs de travail avec reordonnerRangs,
+	*               comme majDates, sur les arêtes du scénario. Les sommets
+	*               déplacés sont notés pour être restaurés.
+	*/
+static int reordonnerScenario(TypEspaceScenario *espace, int predecesseur, int sommet) {
+	TypReordonnement reordonnement;  /* Ordre de travail et zones de travail */
+	int              erreur;
+	int              k;
+
+	espace->parcours++;
+	reordonnement.ordreTopo = espace->ordreTopo;
+	reordonnement.rangTopo = espace->rangTopo;
+	reordonnement.vu = espace->vu;
+	reordonnement.parcours = espace->parcours;
+	reordonnement.pile = espace->pile;
+	reordonnement.rangsAval = espace->rangsAval;
+	reordonnement.rangsAmont = espace->rangsAmont;
+	reordonnement.rangs = espace->rangs;
+	reordonnement.voisins = espace->voisins;
+	reordonnement.sommets = espace->sommets;
+	reordonnement.listerVoisins = voisinsReordonnement;
+	reordonnement.contexte = espace;
+
+	erreur = reordonnerRangs(&reordonnement,predecesseur,sommet);
+	for (k = 0; k < reordonnement.nbDeplaces; k++) {
+		noterModifie(espace,espace->sommets[k]);
+	}
+
+	return erreur;
+}
+
+
+	/*
+	* Fonction : voisinsReordonnement
+	*
+	* Paramètres : void *contexte, pointeur sur le TypEspaceScenario
+	*              int sommet, un sommet du graphe
+	*              bool successeurs, true pour les successeurs, false pour
+	*                  les prédécesseurs
+	*              int *voisins, espace->voisins
+	*
+	* Retour : int, le nombre de voisins
+	*
+	* Description : Lecture des voisins pour reordonnerRangs, qui reçoit
+	*               espace->voisins comme tableau de voisins.
+	*/
+static int voisinsReordonnement(void *contexte, int sommet, bool successeurs, int *voisins) {
+	return voisinsScenario(contexte,sommet,successeurs);
+}
+
+
+	/*
+	* Fonction : voisinsScenario
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario
+	*              int sommet, un sommet du graphe
+	*              bool successeurs, true pour les successeurs, false pour
+	*                  les prédécesseurs
+	*
+	* Retour : int, le nombre de voisins, rangés dans espace->voisins
+	*
+	* Description : Voisins du sommet dans le graphe du scénario : ceux du
+	*               graphe de départ moins les arêtes retirées, plus les
+	*               arêtes ajoutées (dépendances fin-début). L'écart entre
+	*               les débuts imposé par chaque arête, avec les durées du
+	*               scénario, est rangé dans espace->ecarts.
+	*/
+static int voisinsScenario(TypEspaceScenario *espace, int sommet, bool successeurs) {
+	TypGraphePERT *graphePERT;
+	TypVoisins    *liste;      /* Liste d'adjacence du sommet */
+	TypVoisins    *vC;         /* Voisin courant */
+	const int     *duree;      /* Durées du scénario */
+	int           nbVoisins;
+	int           lien;        /* Code d'une dépendance */
+	int           v, i;
+
+	graphePERT = espace->graphePERT;
+	duree = espace->duree;
+	liste = successeurs ? graphePERT->graphe->listesAdjacences[sommet-1]
+	                    : graphePERT->grapheInverse->listesAdjacences[sommet-1];
+	nbVoisins = 0;
+
+	for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+		v = numeroVoisin(&vC);
+		if (areteRetiree(espace,successeurs ? sommet : v,successeurs ? v : sommet)) {
+			continue;
+		}
+		espace->voisins[nbVoisins] = v;
+		if (! successeurs) {
+			/* Le poids de l'arête inverse est le code de la dépendance */
+			espace->ecarts[nbVoisins] = ecartLien(poidsVoisin(&vC),duree[v-1],duree[sommet-1]);
+		}
+		else if (! graphePERT->liensTypes) {
+			espace->ecarts[nbVoisins] = duree[sommet-1];
+		}
+		else if (duree[sommet-1] == graphePERT->duree[sommet-1] && duree[v-1] == graphePERT->duree[v-1]) {
+			/* Durées de départ : le poids de l'arête est à jour */
+			espace->ecarts[nbVoisins] = poidsVoisin(&vC);
+		}
+		else {
+			lien = poidsArete(graphePERT->grapheInverse,v,sommet);
+			espace->ecarts[nbVoisins] = ecartLien(lien,duree[sommet-1],duree[v-1]);
+		}
+		nbVoisins++;
+	}
+
+	for (i = 0; i < espace->nbAjouts; i++) {
+		if (successeurs && espace->ajoutDepart[i] == sommet) {
+			espace->voisins[nbVoisins] = espace->ajoutArrivee[i];
+			espace->ecarts[nbVoisins++] = duree[sommet-1];
+		}
+		else if (! successeurs && espace->ajoutArrivee[i] == sommet) {
+			espace->voisins[nbVoisins] = espace->ajoutDepart[i];
+			espace->ecarts[nbVoisins++] = duree[espace->ajoutDepart[i]-1];
+		}
+	}
+
+	return nbVoisins;
+}
+
+
+	/*
+	* Fonction : debutBorneScenario
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario
+	*              int sommet, un sommet du graphe
+	*
+	* Retour : bool, true si un prédécesseur du sommet dans le graphe du
+	*             scénario borne son début (voir borneDebut)
+	*/
+static bool debutBorneScenario(TypEspaceScenario *espace, int sommet) {
+	TypVoisins *liste;  /* Liste des prédécesseurs du sommet */
+	TypVoisins *vC;     /* Prédécesseur courant */
+	int        i;
+
+	for (i = 0; i < espace->nbAjouts; i++) {
+		if (espace->ajoutArrivee[i] == sommet) {
+			return true;
+		}
+	}
+
+	liste = espace->graphePERT->grapheInverse->listesAdjacences[sommet-1];
+	for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+		if (borneDebut(poidsVoisin(&vC)) && ! areteRetiree(espace,numeroVoisin(&vC),sommet)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+	/*
+	* Fonction : finBorneeScenario
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario
+	*              int sommet, un sommet du graphe
+	*
+	* Retour : bool, true si un successeur du sommet dans le graphe du
+	*             scénario borne sa fin (voir borneFin)
+	*/
+static bool finBorneeScenario(TypEspaceScenario *espace, int sommet) {
+	TypGraphePERT *graphePERT;
+	TypVoisins    *liste;  /* Liste des successeurs du sommet */
+	TypVoisins    *vC;     /* Successeur courant */
+	int           v, i;
+
+	graphePERT = espace->graphePERT;
+	for (i = 0; i < espace->nbAjouts; i++) {
+		if (espace->ajoutDepart[i] == sommet) {
+			return true;
+		}
+	}
+
+	liste = graphePERT->graphe->listesAdjacences[sommet-1];
+	for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+		v = numeroVoisin(&vC);
+		if (! areteRetiree(espace,sommet,v)
+				&& (! graphePERT->liensTypes || borneFin(poidsArete(graphePERT->grapheInverse,v,sommet)))) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+	/*
+	* Fonction : areteScenario
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario
+	*              int depart, int arrivee, les extrémités d'une arête
+	*
+	* Retour : bool, true si l'arête est dans le graphe du scénario
+	*/
+static bool areteScenario(TypEspaceScenario *espace, int depart, int arrivee) {
+	if (chercherArete(espace->ajoutDepart,espace->ajoutArrivee,espace->nbAjouts,depart,arrivee) != -1) {
+		return true;
+	}
+	return areteExistante(espace->graphePERT->graphe,depart,arrivee) == 0
+		&& ! areteRetiree(espace,depart,arrivee);
+}
+
+
+	/*
+	* Fonction : areteRetiree
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario
+	*              int depart, int arrivee, une arête du graphe de départ
+	*
+	* Retour : bool, true si le scénario a retiré l'arête
+	*/
+static bool areteRetiree(TypEspaceScenario *espace, int depart, int arrivee) {
+	return espace->nbRetraits > 0
+		&& chercherArete(espace->retraitDepart,espace->retraitArrivee,espace->nbRetraits,depart,arrivee) != -1;
+}
+
+
+	/*
+	* Fonction : ajouterAreteScenario
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario
+	*              int depart, int arrivee, une arête absente du graphe du
+	*                  scénario
+	*
+	* Description : Une arête du graphe de départ retirée plus tôt dans le
+	*               scénario y est simplement remise.
+	*/
+static void ajouterAreteScenario(TypEspaceScenario *espace, int depart, int arrivee) {
+	int i;
+
+	i = chercherArete(espace->retraitDepart,espace->retraitArrivee,espace->nbRetraits,depart,arrivee);
+	if (i != -1) {
+		espace->nbRetraits--;
+		espace->retraitDepart[i] = espace->retraitDepart[espace->nbRetraits];
+		espace->retraitArrivee[i] = espace->retraitArrivee[espace->nbRetraits];
+	}
+	else {
+		espace->ajoutDepart[espace->nbAjouts] = depart;
+		espace->ajoutArrivee[espace->nbAjouts] = arrivee;
+		espace->nbAjouts++;
+	}
+}
+
+
+	/*
+	* Fonction : retirerAreteScenario
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario
+	*              int depart, int arrivee, une arête du graphe du scénario
+	*/
+static void retirerAreteScenario(TypEspaceScenario *espace, int depart, int arrivee) {
+	int i;
+
+	i = chercherArete(espace->ajoutDepart,espace->ajoutArrivee,espace->nbAjouts,depart,arrivee);
+	if (i != -1) {
+		espace->nbAjouts--;
+		espace->ajoutDepart[i] = espace->ajoutDepart[espace->nbAjouts];
+		espace->ajoutArrivee[i] = espace->ajoutArrivee[espace->nbAjouts];
+	}
+	else {
+		espace->retraitDepart[espace->nbRetraits] = depart;
+		espace->retraitArrivee[espace->nbRetraits] = arrivee;
+		espace->nbRetraits++;
+	}
+}
+
+
+	/*
+	* Fonction : chercherArete
+	*
+	* Paramètres : const int *departs, const int *arrivees, une liste
+	*                  d'arêtes
+	*              int nbAretes, la taille de la liste
+	*              int depart, int arrivee, l'arête cherchée
+	*
+	* Retour : int, la position de l'arête dans la liste, -1 si elle n'y
+	*             est pas
+	*/
+static int chercherArete(const int *departs, const int *arrivees, int nbAretes, int depart, int arrivee) {
+	int i;
+
+	for (i = 0; i < nbAretes; i++) {
+		if (departs[i] == depart && arrivees[i] == arrivee) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+
+	/*
+	* Fonction : noterModifie
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace du scénario
+	*              int sommet, un sommet dont une copie va changer
+	*
+	* Description : Note le sommet, une seule fois par scénario, pour que
+	*               restaurer remette ses copies à leur valeur de départ.
+	*/
+static void noterModifie(TypEspaceScenario *espace, int sommet) {
+	if (espace->marque[sommet-1] != espace->numero) {
+		espace->marque[sommet-1] = espace->numero;
+		espace->modifies[espace->nbModifies++] = sommet;
+	}
+}
+
+
+	/*
+	* Fonction : restaurer
+	*
+	* Paramètres : TypEspaceScenario *espace, l'espace d'un scénario évalué
+	*
+	* Description : Remet les copies des sommets notés à leur valeur de
+	*               départ. Les rangs changés forment une permutation des
+	*               rangs de ces sommets : remettre chaque sommet à son
+	*               ancien rang suffit à restaurer ordreTopo.
+	*/
+static void restaurer(TypEspaceScenario *espace) {
+	TypGraphePERT *graphePERT;
+	int           dateFin;    /* Date de fin du graphe de départ */
+	int           s, i;
+
+	graphePERT = espace->graphePERT;
+	dateFin = graphePERT->dateTot[espace->nbSommets-1];
+
+	for (i = 0; i < espace->nbModifies; i++) {
+		s = espace->modifies[i];
+		espace->dateTot[s-1] = graphePERT->dateTot[s-1];
+		espace->queue[s-1] = dateFin - graphePERT->dateTard[s-1];
+		espace->duree[s-1] = graphePERT->duree[s-1];
+		espace->rangTopo[s-1] = graphePERT->rangTopo[s-1];
+		espace->ordreTopo[graphePERT->rangTopo[s-1]] = s;
+	}
+	espace->nbModifies = 0;
+}
+
+
+	/*
+	* Fonction : trierSommets
+	*
+	* Paramètres : TypVoisins *liste, une liste d'adjacence
+	*              const int *cle, la clé de chaque sommet (indicée par
+	*                  sommet - 1)
+	*              int *nbSommets, reçoit la taille du tableau renvoyé
+	*
+	* Retour : int*, les sommets de la liste par clé décroissante
+	*/
+static int* trierSommets(TypVoisins *liste, const int *cle, int *nbSommets) {
+	TypVoisins   *vC;       /* Voisin courant */
+	TypCleSommet *paires;   /* Sommets et clés à trier */
+	int          *sommets;  /* Le tableau renvoyé */
+	int          n, i;
+
+	n = 0;
+	for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+		n++;
+	}
+
+	paires = malloc((n > 0 ? n : 1) * sizeof(TypCleSommet));
+	n = 0;
+	for (vC = voisinSuivant(&liste); vC != liste; vC = voisinSuivant(&vC)) {
+		paires[n].sommet = numeroVoisin(&vC);
+		paires[n].cle = cle[paires[n].sommet-1];
+		n++;
+	}
+	qsort(paires,n,sizeof(TypCleSommet),comparerCles);
+
+	sommets = malloc((n > 0 ? n : 1) * sizeof(int));
+	for (i = 0; i < n; i++) {
+		sommets[i] = paires[i].sommet;
+	}
+	free(paires);
+
+	*nbSommets = n;
+	return sommets;
+}
+
+
+	/*
+	* Fonction : comparerCles
+	*
+	* Paramètres : const void *a, const void *b, deux TypCleSommet
+	*
+	* Retour : int, < 0 si a a la plus grande clé (tri décroissant)
+	*/
+static int comparerCles(const void *a, const void *b) {
+	const TypCleSommet *x = a;
+	const TypCleSommet *y = b;
+
+	if (x->cle != y->cle) {
+		return (x->cle > y->cle) ? -1 : 1;
+	}
+	return x->sommet - y->sommet;
+}
+
+
@@ -0,0 +1,34 @@
+#ifndef SCENARIOS_H
+#define SCENARIOS_H
+
+#include "pert.h"
+
+
+/*
+* Scénario « et si » : modifications (voir majDates) appliquées à une
+* copie de travail du chantier, sans toucher au graphe de départ.
+*/
+typedef struct TypScenario {
+	TypModification *modifications;
+	int             nbModifications;
+} TypScenario;
+
+/*
+* Résultat d'un scénario.
+*/
+typedef struct TypResultatScenario {
+	int erreur;       /* 0, ou code d'erreur de la première modification
+	                     refusée (voir erreurs.h) : le scénario n'est
+	                     alors pas évalué */
+	int dateFin;      /* Date de fin du chantier */
+	int nbCritiques;
+	int *critiques;   /* Tâches critiques (indices dans taches), par
+	                     ordre croissant */
+} TypResultatScenario;
+
+
+TypResultatScenario* evaluerScenarios(TypGraphePERT*,TypScenario*,int,int);
+
+void deleteResultatsScenarios(TypResultatScenario*,int);
+
+#endif
@@ -0,0 +1,903 @@
+/*
+******************************************************************************
+*
+* Programme : separation.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Recherche par séparation et évaluation d'un ordonnancement de
+*          durée minimale du chantier avec un nombre limité d'ouvriers.
+*          L'exploration est répartie sur plusieurs threads ; un thread
+*          inoccupé vole du travail dans la pile d'un autre.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include "libgraphe.h"
+#include "pert.h"
+#include "ordonnancement.h"
+#include "separation.h"
+
+
+/* Au-delà de ce nombre de sommets, le raisonnement énergétique (en n^3)
+   n'est pas appliqué */
+#define SEUIL_ENERGETIQUE 400
+
+
+/*
+* Données du problème, partagées en lecture seule par tous les threads.
+* Les sommets sont indicés à partir de 0.
+*/
+typedef struct TypProbleme {
+	int nbSommets;
+	int nbOuvriers;
+	int horizon;       /* Durée de la solution initiale : taille du profil */
+	int *duree;
+	int *dateTot;      /* Date au plus tôt sans contrainte d'ouvriers */
+	int *queue;        /* Plus long chemin du début de la tâche à la fin */
+	int *rang;         /* Rang de priorité (heuristique) */
+	int *ordreTopo;    /* Les sommets dans un ordre topologique */
+	int *debutPred;    /* Prédécesseurs de i : pred[debutPred[i]] à */
+	int *pred;         /*   pred[debutPred[i+1]-1] */
+} TypProbleme;
+
+/*
+* Noeud de l'arbre de recherche : un ordonnancement partiel. Le tableau
+* donnees contient la date de début de chaque sommet (-1 s'il n'est pas
+* encore placé) suivie du nombre d'ouvriers occupés à chaque date.
+*/
+typedef struct TypNoeud {
+	int borne;     /* Borne inférieure des ordonnancements complétés */
+	int nbPlaces;  /* Nombre de sommets placés */
+	int donnees[];
+} TypNoeud;
+
+/*
+* Pile de noeuds d'un thread. Le thread propriétaire empile et dépile
+* en fin de tableau, les autres volent en début de tableau.
+*/
+typedef struct TypPile {
+	TypNoeud        **noeuds;
+	int             debut;
+	int             fin;
+	int             capacite;
+	pthread_mutex_t verrou;
+} TypPile;
+
+/*
+* État global d'une recherche.
+*/
+typedef struct TypRecherche {
+	TypProbleme     *probleme;
+	TypPile         *piles;
+	int             nbThreads;
+	atomic_long     nbNoeuds;       /* Noeuds explorés */
+	atomic_long     nbEnAttente;    /* Noeuds créés et non encore explorés */
+	atomic_bool     arret;          /* true si le budget est épuisé */
+	atomic_int      meilleure;      /* Durée de la meilleure solution */
+	int             *meilleurDebut; /* Dates de début de la meilleure solution */
+	pthread_mutex_t verrouMeilleur;
+	struct timespec depart;
+	double          tempsMax;
+	long            nbNoeudsMax;
+} TypRecherche;
+
+/*
+* Paramètres et zones de travail propres à un thread.
+*/
+typedef struct TypTravailleur {
+	TypRecherche *recherche;
+	int          indice;
+	int          *dateMin;     /* Date de début au plus tôt des sommets */
+	TypNoeud     **enfants;    /* Enfants du noeud en cours d'exploration */
+} TypTravailleur;
+
+
+static TypProbleme* creerProbleme(TypGraphePERT*,int);
+static void deleteProbleme(TypProbleme*);
+static bool energetiquementRealisable(TypProbleme*,int);
+static int borneInitiale(TypProbleme*,int);
+static TypNoeud* creerNoeud(TypProbleme*);
+static TypNoeud* copierNoeud(TypProbleme*,TypNoeud*);
+static int evaluerNoeud(TypProbleme*,TypNoeud*,int*);
+static void explorerNoeud(TypTravailleur*,TypNoeud*);
+static void empiler(TypPile*,TypNoeud*);
+static TypNoeud* depiler(TypPile*);
+static TypNoeud* voler(TypPile*);
+static void* travailler(void*);
+static int comparerEnfants(const void*, const void*);
+
+
+	/*
+	* Fonction : borneInferieureOrdo
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*                  dont les dates ont été calculées
+	*              int nbOuvriers, le nombre d'ouvriers (>= 1)
+	*
+	* Retour : int, une borne inférieure de la durée du chantier
+	*
+	* Description : Renvoie le maximum de la longueur du chemin critique,
+	*               du travail total divisé par le nombre d'ouvriers et de
+	*               la borne obtenue par raisonnement énergétique.
+	*/
+int borneInferieureOrdo(TypGraphePERT *graphePERT, int nbOuvriers) {
+	TypProbleme *probleme;  /* Données du problème */
+	int         borne;      /* La borne calculée */
+
+	probleme = creerProbleme(graphePERT,nbOuvriers);
+	borne = borneInitiale(probleme,dureeTotale(graphePERT,nbOuvriers));
+	deleteProbleme(probleme);
+
+	return borne;
+}
+
+
+	/*
+	* Fonction : resoudreOptimal
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*                  dont les dates ont été calculées
+	*              int nbOuvriers, le nombre d'ouvriers (>= 1)
+	*              int nbThreads, le nombre de threads (<= 0 : un par
+	*                  processeur)
+	*              double tempsMax, durée maximale de la recherche en
+	*                  secondes (<= 0 : pas de limite)
+	*              long nbNoeudsMax, nombre maximal de noeuds explorés
+	*                  (<= 0 : pas de limite)
+	*
+	* Retour : TypResultatOptimal*, le meilleur ordonnancement trouvé et la
+	*              borne inférieure prouvée (mémoire allouée dans la fonction),
+	*              ou NULL si le graphe a des liens typés
+	*
+	* Description : Part de l'ordonnancement de dureeTotale puis explore
+	*               les ordonnancements obtenus en plaçant les tâches une à
+	*               une au plus tôt (toute solution optimale est atteinte de
+	*               cette façon). Un noeud est abandonné dès que sa borne
+	*               inférieure atteint la meilleure durée connue.
+	*               La recherche s'arrête proprement quand le budget de temps
+	*               ou de noeuds est épuisé ; la borne inférieure renvoyée
+	*               est alors la plus petite borne des noeuds non explorés.
+	*/
+TypResultatOptimal* resoudreOptimal(TypGraphePERT *graphePERT, int nbOuvriers,
+		int nbThreads, double tempsMax, long nbNoeudsMax) {
+	TypResultatOptimal *resultat;     /* Le résultat renvoyé */
+	TypProbleme        *probleme;     /* Données du problème */
+	TypRecherche       recherche;     /* État de la recherche */
+	TypTravailleur     *travailleurs; /* Paramètres de chaque thread */
+	pthread_t          *threads;      /* Les threads lancés */
+	TypEspaceOrdo      *espace;       /* Pour la solution initiale */
+	TypNoeud           *noeud;        /* Un noeud non exploré */
+	int                borneRacine;   /* Borne inférieure initiale */
+	int                borneRestante; /* Plus petite borne non explorée */
+	int                nbSommets;     /* Le nombre de sommets */
+	int                i;             /* Permet le parcours des boucles */
+	int                t;             /* Permet le parcours des threads */
+
+	if (graphePERT->liensTypes) {
+		return NULL;
+	}
+	if (nbThreads <= 0) {
+		nbThreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	if (nbThreads < 1) {
+		nbThreads = 1;
+	}
+
+	nbSommets = graphePERT->graphe->nbrMaxSommets;
+	resultat = malloc(sizeof(TypResultatOptimal));
+	resultat->nbSommets = nbSommets;
+	resultat->debut = malloc(nbSommets * sizeof(int));
+	resultat->nbNoeuds = 0;
+
+	/* Solution initiale : celle de la simulation gloutonne */
+	espace = creerEspaceOrdo(graphePERT);
+	resultat->duree = simulerOrdo(espace,nbOuvriers);
+	for (i = 0; i < nbSommets; i++) {
+		resultat->debut[i] = espace->fin[i] - espace->duree[i];
+	}
+	deleteEspaceOrdo(espace);
+
+	probleme = creerProbleme(graphePERT,nbOuvriers);
+	probleme->horizon = resultat->duree;
+	borneRacine = borneInitiale(probleme,resultat->duree);
+
+	if (borneRacine >= resultat->duree) {
+		resultat->borneInf = resultat->duree;
+		resultat->optimal = true;
+		deleteProbleme(probleme);
+		return resultat;
+	}
+
+	/* Initialisation de la recherche */
+	recherche.probleme = probleme;
+	recherche.nbThreads = nbThreads;
+	recherche.piles = malloc(nbThreads * sizeof(TypPile));
+	for (t = 0; t < nbThreads; t++) {
+		recherche.piles[t].capacite = 64;
+		recherche.piles[t].noeuds = malloc(64 * sizeof(TypNoeud*));
+		recherche.piles[t].debut = 0;
+		recherche.piles[t].fin = 0;
+		pthread_mutex_init(&(recherche.piles[t].verrou),NULL);
+	}
+	atomic_init(&recherche.nbNoeuds,0);
+	atomic_init(&recherche.nbEnAttente,1);
+	atomic_init(&recherche.arret,false);
+	atomic_init(&recherche.meilleure,resultat->duree);
+	recherche.meilleurDebut = resultat->debut;
+	pthread_mutex_init(&recherche.verrouMeilleur,NULL);
+	clock_gettime(CLOCK_MONOTONIC,&recherche.depart);
+	recherche.tempsMax = tempsMax;
+	recherche.nbNoeudsMax = nbNoeudsMax;
+
+	noeud = creerNoeud(probleme);
+	noeud->borne = borneRacine;
+	empiler(&recherche.piles[0],noeud);
+
+	/* Exploration */
+	travailleurs = malloc(nbThreads * sizeof(TypTravailleur));
+	threads = malloc(nbThreads * sizeof(pthread_t));
+	for (t = 0; t < nbThreads; t++) {
+		travailleurs[t].recherche = &recherche;
+		travailleurs[t].indice = t;
+		travailleurs[t].dateMin = malloc(nbSommets * sizeof(int));
+		travailleurs[t].enfants = malloc(nbSommets * sizeof(TypNoeud*));
+	}
+	for (t = 1; t < nbThreads; t++) {
+		pthread_create(&threads[t],NULL,travailler,&travailleurs[t]);
+	}
+	travailler(&travailleurs[0]);
+	for (t = 1; t < nbThreads; t++) {
+		pthread_join(threads[t],NULL);
+	}
+
+	/* Les noeuds restants bornent la durée minimale */
+	resultat->duree = atomic_load(&recherche.meilleure);
+	borneRestante = resultat->duree;
+	for (t = 0; t < nbThreads; t++) {
+		while ((noeud = depiler(&recherche.piles[t])) != NULL) {
+			if (noeud->borne < borneRestante) {
+				borneRestante = noeud->borne;
+			}
+			free(noeud);
+		}
+		free(recherche.piles[t].noeuds);
+		pthread_mutex_destroy(&(recherche.piles[t].verrou));
+		free(travailleurs[t].dateMin);
+		free(travailleurs[t].enfants);
+	}
+
+	resultat->borneInf = (borneRestante > borneRacine) ? borneRestante : borneRacine;
+	resultat->optimal = (resultat->borneInf == resultat->duree);
+	resultat->nbNoeuds = atomic_load(&recherche.nbNoeuds);
+
+	pthread_mutex_destroy(&recherche.verrouMeilleur);
+	free(recherche.piles);
+	free(travailleurs);
+	free(threads);
+	deleteProbleme(probleme);
+
+	return resultat;
+}
+
+
+	/*
+	* Fonction : deleteResultatOptimal
+	*
+	* Paramètres : TypResultatOptimal *resultat, le résultat à supprimer
+	*
+	* Description : Libère la mémoire occupée par le résultat.
+	*/
+void deleteResultatOptimal(TypResultatOptimal *resultat) {
+	free(resultat->debut);
+	free(resultat);
+}
+
+
+	/*
+	* Fonction : creerProbleme
+	*
+	* Paramètres : TypGraphePERT *graphePERT, pointeur sur un graphe PERT
+	*                  dont les dates ont été calculées
+	*              int nbOuvriers, le nombre d'ouvriers
+	*
+	* Retour : TypProbleme*, les données du problème
+	*
+	* Description : Recopie dans des tableaux contigus les durées, dates,
+	*               prédécesseurs et un ordre topologique des sommets.
+	*/
+static TypProbleme* creerProbleme(TypGraphePERT *graphePERT, int nbOuvriers) {
+	TypProbleme   *probleme;   /* Le problème créé */
+	TypEspaceOrdo *espace;     /* Fournit successeurs et rangs */
+	int           *position;   /* Prochaine case libre des prédécesseurs */
+	int           *nbPred;     /* Prédécesseurs non encore ordonnés */
+	int           dureeCritique; /* Longueur du chemin critique */
+	int           n;           /* Le nombre de sommets */
+	int           nbOrdonnes;  /* Nombre de sommets dans ordreTopo */
+	int           i, j;        /* Permettent le parcours des boucles */
+
+	espace = creerEspaceOrdo(graphePERT);
+	n = espace->nbSommets;
+	dureeCritique = espace->dureeCritique;
+
+	probleme = malloc(sizeof(TypProbleme));
+	probleme->nbSommets = n;
+	probleme->nbOuvriers = nbOuvriers;
+	probleme->horizon = 0;
+	probleme->duree = malloc(n * sizeof(int));
+	probleme->dateTot = malloc(n * sizeof(int));
+	probleme->queue = malloc(n * sizeof(int));
+	probleme->rang = malloc(n * sizeof(int));
+	probleme->ordreTopo = malloc(n * sizeof(int));
+	probleme->debutPred = malloc((n + 1) * sizeof(int));
+	probleme->pred = malloc((espace->debutSucc[n] > 0 ? espace->debutSucc[n] : 1) * sizeof(int));
+
+	for (i = 0; i < n; i++) {
+		probleme->duree[i] = espace->duree[i];
+		probleme->dateTot[i] = graphePERT->dateTot[i];
+		probleme->queue[i] = dureeCritique - graphePERT->dateTard[i];
+		probleme->rang[i] = espace->rang[i];
+	}
+
+	/* Inversion des listes de successeurs */
+	probleme->debutPred[0] = 0;
+	for (i = 0; i < n; i++) {
+		probleme->debutPred[i+1] = probleme->debutPred[i] + espace->nbPred[i];
+	}
+	position = malloc(n * sizeof(int));
+	memcpy(position,probleme->debutPred,n * sizeof(int));
+	for (i = 0; i < n; i++) {
+		for (j = espace->debutSucc[i]; j < espace->debutSucc[i+1]; j++) {
+			probleme->pred[position[espace->succ[j]]++] = i;
+		}
+	}
+	free(position);
+
+	/* Ordre topologique (algorithme de Kahn) */
+	nbPred = malloc(n * sizeof(int));
+	memcpy(nbPred,espace->nbPred,n * sizeof(int));
+	nbOrdonnes = 0;
+	for (i = 0; i < n; i++) {
+		if (nbPred[i] == 0) {
+			probleme->ordreTopo[nbOrdonnes++] = i;
+		}
+	}
+	for (i = 0; i < nbOrdonnes; i++) {
+		int s = probleme->ordreTopo[i];
+		for (j = espace->debutSucc[s]; j < espace->debutSucc[s+1]; j++) {
+			if (--nbPred[espace->succ[j]] == 0) {
+				probleme->ordreTopo[nbOrdonnes++] = espace->succ[j];
+			}
+		}
+	}
+	free(nbPred);
+
+	deleteEspaceOrdo(espace);
+
+	return probleme;
+}
+
+
+	/*
+	* Fonction : deleteProbleme
+	*
+	* Paramètres : TypProbleme *probleme, le problème à supprimer
+	*
+	* Description : Libère la mémoire occupée par le problème.
+	*/
+static void deleteProbleme(TypProbleme *probleme) {
+	free(probleme->duree);
+	free(probleme->dateTot);
+	free(probleme->queue);
+	free(probleme->rang);
+	free(probleme->ordreTopo);
+	free(probleme->debutPred);
+	free(probleme->pred);
+	free(probleme);
+}
+
+
+	/*
+	* Fonction : borneInitiale
+	*
+	* Paramètres : TypProbleme *probleme, les données du problème
+	*              int borneSup, une durée réalisable
+	*
+	* Retour : int, une borne inférieure de la durée minimale
+	*
+	* Description : Maximum du chemin critique et du travail total divisé
+	*               par le nombre d'ouvriers, puis plus petite date entre
+	*               cette borne et borneSup dont le raisonnement énergétique
+	*               ne prouve pas qu'aucun ordonnancement ne peut y finir.
+	*               Une date qui passe le test le passe aussi quand elle est
+	*               repoussée (chaque fenêtre s'élargit) : les dates sont
+	*               essayées à pas doublés depuis la borne, puis par
+	*               dichotomie, soit un nombre de tests logarithmique en
+	*               l'écart à la borne.
+	*/
+static int borneInitiale(TypProbleme *probleme, int borneSup) {
+	int  borne;    /* La borne calculée */
+	int  haut;     /* Plus petite date connue qui passe le test */
+	int  essai;    /* Date testée */
+	long pas;      /* Pas de la recherche, 0 une fois la dichotomie commencée */
+	long travail;  /* Travail total du chantier */
+	int  i;        /* Permet le parcours des sommets */
+
+	travail = 0;
+	borne = 0;
+	for (i = 0; i < probleme->nbSommets; i++) {
+		travail += probleme->duree[i];
+		if (probleme->dateTot[i] + probleme->queue[i] > borne) {
+			borne = probleme->dateTot[i] + probleme->queue[i];
+		}
+	}
+	if ((travail + probleme->nbOuvriers - 1) / probleme->nbOuvriers > borne) {
+		borne = (int) ((travail + probleme->nbOuvriers - 1) / probleme->nbOuvriers);
+	}
+
+	if (probleme->nbSommets <= SEUIL_ENERGETIQUE) {
+		haut = borneSup;
+		pas = 1;
+		while (borne < haut) {
+			if (pas > 0 && pas <= haut - borne) {
+				essai = (int) (borne + pas - 1);
+			}
+			else {
+				essai = borne + (haut - borne) / 2;
+			}
+			if (energetiquementRealisable(probleme,essai)) {
+				haut = essai;
+				pas = 0;
+			}
+			else {
+				borne = essai + 1;
+				pas *= 2;
+			}
+		}
+	}
+
+	return borne;
+}
+
+
+	/*
+	* Fonction : energetiquementRealisable
+	*
+	* Paramètres : TypProbleme *probleme, les données du problème
+	*              int dateFin, la date de fin du chantier testée
+	*
+	* Retour : bool, false si le chantier ne peut pas finir à dateFin
+	*
+	* Description : Chaque tâche doit s'exécuter entre sa date au plus tôt et
+	*               sa date de fin au plus tard pour dateFin. Sur tout
+	*               intervalle [t1,t2], la partie de chaque tâche qui y tombe
+	*               obligatoirement ne peut dépasser nbOuvriers * (t2 - t1).
+	*/
+static bool energetiquementRealisable(TypProbleme *probleme, int dateFin) {
+	int  *dates;    /* Bornes des intervalles testés */
+	int  nbDates;   /* Nombre de dates */
+	int  n;         /* Le nombre de sommets */
+	int  a, b, i;   /* Permettent le parcours des boucles */
+	bool realisable;
+
+	n = probleme->nbSommets;
+	dates = malloc(4 * n * sizeof(int));
+	nbDates = 0;
+
+	for (i = 0; i < n; i++) {
+		if (probleme->duree[i] > 0) {
+			int finTard = dateFin - probleme->queue[i] + probleme->duree[i];
+			dates[nbDates++] = probleme->dateTot[i];
+			dates[nbDates++] = probleme->dateTot[i] + probleme->duree[i];
+			dates[nbDates++] = finTard - probleme->duree[i];
+			dates[nbDates++] = finTard;
+		}
+	}
+
+	realisable = true;
+	for (a = 0; a < nbDates && realisable; a++) {
+		for (b = 0; b < nbDates && realisable; b++) {
+			int  t1 = dates[a];
+			int  t2 = dates[b];
+			long energie = 0;
+
+			if (t2 <= t1) {
+				continue;
+			}
+			for (i = 0; i < n; i++) {
+				int d = probleme->duree[i];
+				int finTard = dateFin - probleme->queue[i] + d;
+				int part = t2 - t1;
+
+				if (d < part) part = d;
+				if (probleme->dateTot[i] + d - t1 < part) part = probleme->dateTot[i] + d - t1;
+				if (t2 - (finTard - d) < part) part = t2 - (finTard - d);
+				if (part > 0) {
+					energie += part;
+				}
+			}
+			if (energie > (long) probleme->nbOuvriers * (t2 - t1)) {
+				realisable = false;
+			}
+		}
+	}
+
+	free(dates);
+
+	return realisable;
+}
+
+
+	/*
+	* Fonction : creerNoeud
+	*
+	* Paramètres : TypProbleme *probleme, les données du problème
+	*
+	* Retour : TypNoeud*, la racine de l'arbre de recherche
+	*
+	* Description : Crée un noeud où aucune tâche n'est placée.
+	*/
+static TypNoeud* creerNoeud(TypProbleme *probleme) {
+	TypNoeud *noeud;  /* Le noeud créé */
+	int      i;
+
+	noeud = malloc(sizeof(TypNoeud) + (probleme->nbSommets + probleme->horizon) * sizeof(int));
+	noeud->borne = 0;
+	noeud->nbPlaces = 0;
+	for (i = 0; i < probleme->nbSommets; i++) {
+		noeud->donnees[i] = -1;
+	}
+	memset(noeud->donnees + probleme->nbSommets,0,probleme->horizon * sizeof(int));
+
+	return noeud;
+}
+
+
+	/*
+	* Fonction : copierNoeud
+	*
+	* Paramètres : TypProbleme *probleme, les données du problème
+	*              TypNoeud *noeud, le noeud à copier
+	*
+	* Retour : TypNoeud*, une copie du noeud
+	*/
+static TypNoeud* copierNoeud(TypProbleme *probleme, TypNoeud *noeud) {
+	size_t   taille;  /* Taille du noeud en octets */
+	TypNoeud *copie;  /* La copie */
+
+	taille = sizeof(TypNoeud) + (probleme->nbSommets + probleme->horizon) * sizeof(int);
+	copie = malloc(taille);
+	memcpy(copie,noeud,taille);
+
+	return copie;
+}
+
+
+	/*
+	* Fonction : evaluerNoeud
+	*
+	* Paramètres : TypProbleme *probleme, les données du problème
+	*              TypNoeud *noeud, un ordonnancement partiel
+	*              int *dateMin, tableau qui reçoit la date de début au plus
+	*                  tôt de chaque sommet compte tenu des tâches placées
+	*
+	* Retour : int, une borne inférieure des ordonnancements complétant
+	*              le noeud
+	*
+	* Description : Propage les dates au plus tôt dans l'ordre topologique,
+	*               puis prend le maximum de date de début + queue sur tous
+	*               les sommets et de la borne sur le travail restant à
+	*               placer après la plus petite date de début possible.
+	*/
+static int evaluerNoeud(TypProbleme *probleme, TypNoeud *noeud, int *dateMin) {
+	int  *debut;    /* Dates de début des sommets placés */
+	int  *profil;   /* Nombre d'ouvriers occupés à chaque date */
+	int  borne;     /* La borne calculée */
+	int  dateMinRestante; /* Plus petite date de début d'un sommet non placé */
+	long travailRestant;  /* Travail des sommets non placés */
+	long occupation;      /* Travail déjà placé après dateMinRestante */
+	int  i, k, s;
+
+	debut = noeud->donnees;
+	profil = noeud->donnees + probleme->nbSommets;
+	borne = 0;
+	dateMinRestante = probleme->horizon;
+	travailRestant = 0;
+
+	for (i = 0; i < probleme->nbSommets; i++) {
+		s = probleme->ordreTopo[i];
+
+		if (debut[s] >= 0) {
+			dateMin[s] = debut[s];
+		}
+		else {
+			dateMin[s] = probleme->dateTot[s];
+			for (k = probleme->debutPred[s]; k < probleme->debutPred[s+1]; k++) {
+				int p = probleme->pred[k];
+				if (dateMin[p] + probleme->duree[p] > dateMin[s]) {
+					dateMin[s] = dateMin[p] + probleme->duree[p];
+				}
+			}
+			if (dateMin[s] < dateMinRestante) {
+				dateMinRestante = dateMin[s];
+			}
+			travailRestant += probleme->duree[s];
+		}
+
+		if (dateMin[s] + probleme->queue[s] > borne) {
+			borne = dateMin[s] + probleme->queue[s];
+		}
+	}
+
+	if (travailRestant > 0) {
+		occupation = 0;
+		for (i = dateMinRestante; i < probleme->horizon; i++) {
+			occupation += profil[i];
+		}
+		k = dateMinRestante + (int) ((travailRestant + occupation + probleme->nbOuvriers - 1)
+				/ probleme->nbOuvriers);
+		if (k > borne) {
+			borne = k;
+		}
+	}
+
+	return borne;
+}
+
+
+	/*
+	* Fonction : explorerNoeud
+	*
+	* Paramètres : TypTravailleur *travailleur, le thread qui explore
+	*              TypNoeud *noeud, le noeud à explorer
+	*
+	* Description : Crée un enfant pour chaque tâche dont tous les
+	*               prédécesseurs sont placés, en la plaçant à la première
+	*               date où un ouvrier est libre pendant toute sa durée.
+	*               Les enfants complets mettent à jour la meilleure
+	*               solution, les autres sont empilés (le plus prometteur
+	*               en dernier, pour être exploré en premier).
+	*/
+static void explorerNoeud(TypTravailleur *travailleur, TypNoeud *noeud) {
+	TypRecherche *recherche;  /* État de la recherche */
+	TypProbleme  *probleme;   /* Données du problème */
+	TypNoeud     *enfant;     /* Un enfant du noeud */
+	int          *debut;      /* Dates de début des sommets du noeud */
+	int          *profil;     /* Occupation des ouvriers du noeud */
+	int          nbEnfants;   /* Nombre d'enfants conservés */
+	int          n;           /* Le nombre de sommets */
+	int          s, t, u, k;  /* Permettent le parcours des boucles */
+	bool         libre;       /* true si tous les prédécesseurs sont placés */
+
+	recherche = travailleur->recherche;
+	probleme = recherche->probleme;
+	n = probleme->nbSommets;
+	debut = noeud->donnees;
+	profil = noeud->donnees + n;
+	nbEnfants = 0;
+
+	for (s = 0; s < n; s++) {
+		if (debut[s] >= 0) {
+			continue;
+		}
+
+		/* La date de début au plus tôt découle des prédécesseurs placés */
+		libre = true;
+		t = 0;
+		for (k = probleme->debutPred[s]; k < probleme->debutPred[s+1] && libre; k++) {
+			int p = probleme->pred[k];
+			if (debut[p] < 0) {
+				libre = false;
+			}
+			else if (debut[p] + probleme->duree[p] > t) {
+				t = debut[p] + probleme->duree[p];
+			}
+		}
+		if (!libre) {
+			continue;
+		}
+
+		/* Première date où un ouvrier est libre pendant toute la durée */
+		for (u = t; u < t + probleme->duree[s] && u < probleme->horizon; u++) {
+			if (profil[u] >= probleme->nbOuvriers) {
+				t = u + 1;
+			}
+		}
+		if (t + probleme->duree[s] > probleme->horizon) {
+			continue;
+		}
+
+		enfant = copierNoeud(probleme,noeud);
+		enfant->donnees[s] = t;
+		enfant->nbPlaces++;
+		for (u = t; u < t + probleme->duree[s]; u++) {
+			enfant->donnees[n + u]++;
+		}
+		enfant->borne = evaluerNoeud(probleme,enfant,travailleur->dateMin);
+
+		if (enfant->borne >= atomic_load(&recherche->meilleure)) {
+			free(enfant);
+		}
+		else if (enfant->nbPlaces == n) {
+			/* Ordonnancement complet : la borne est sa durée */
+			pthread_mutex_lock(&recherche->verrouMeilleur);
+			if (enfant->borne < atomic_load(&recherche->meilleure)) {
+				atomic_store(&recherche->meilleure,enfant->borne);
+				memcpy(recherche->meilleurDebut,enfant->donnees,n * sizeof(int));
+			}
+			pthread_mutex_unlock(&recherche->verrouMeilleur);
+			free(enfant);
+		}
+		else {
+			travailleur->enfants[nbEnfants++] = enfant;
+		}
+	}
+
+	qsort(travailleur->enfants,nbEnfants,sizeof(TypNoeud*),comparerEnfants);
+	atomic_fetch_add(&recherche->nbEnAttente,nbEnfants);
+	for (k = 0; k < nbEnfants; k++) {
+		empiler(&recherche->piles[travailleur->indice],travailleur->enfants[k]);
+	}
+}
+
+
+	/*
+	* Fonction : travailler
+	*
+	* Paramètres : void *arg, pointeur sur un TypTravailleur
+	*
+	* Retour : void*, NULL
+	*
+	* Description : Boucle d'un thread : explore les noeuds de sa propre pile
+	*               en profondeur d'abord, et vole le noeud le plus ancien
+	*               d'une autre pile quand la sienne est vide. S'arrête quand
+	*               plus aucun noeud n'est en attente ou que le budget est
+	*               épuisé.
+	*/
+static void* travailler(void *arg) {
+	TypTravailleur  *travailleur;  /* Paramètres du thread */
+	TypRecherche    *recherche;    /* État de la recherche */
+	TypNoeud        *noeud;        /* Le noeud exploré */
+	struct timespec maintenant;    /* Pour le contrôle du budget de temps */
+	long            nbNoeuds;      /* Nombre de noeuds explorés */
+	int             t;             /* Permet le parcours des autres piles */
+
+	travailleur = arg;
+	recherche = travailleur->recherche;
+
+	while (!atomic_load(&recherche->arret)) {
+		noeud = depiler(&recherche->piles[travailleur->indice]);
+		for (t = 1; noeud == NULL && t < recherche->nbThreads; t++) {
+			noeud = voler(&recherche->piles[(travailleur->indice + t) % recherche->nbThreads]);
+		}
+
+		if (noeud == NULL) {
+			if (atomic_load(&recherche->nbEnAttente) == 0) {
+				break;
+			}
+			sched_yield();
+			continue;
+		}
+
+		if (noeud->borne < atomic_load(&recherche->meilleure)) {
+			explorerNoeud(travailleur,noeud);
+
+			/* Contrôle du budget */
+			nbNoeuds = atomic_fetch_add(&recherche->nbNoeuds,1) + 1;
+			if (recherche->nbNoeudsMax > 0 && nbNoeuds >= recherche->nbNoeudsMax) {
+				atomic_store(&recherche->arret,true);
+			}
+			if (recherche->tempsMax > 0 && (nbNoeuds & 255) == 0) {
+				clock_gettime(CLOCK_MONOTONIC,&maintenant);
+				if ((maintenant.tv_sec - recherche->depart.tv_sec)
+						+ (maintenant.tv_nsec - recherche->depart.tv_nsec) / 1e9
+						>= recherche->tempsMax) {
+					atomic_store(&recherche->arret,true);
+				}
+			}
+		}
+
+		free(noeud);
+		atomic_fetch_sub(&recherche->nbEnAttente,1);
+	}
+
+	return NULL;
+}
+
+
+	/*
+	* Fonction : empiler
+	*
+	* Paramètres : TypPile *pile, une pile de noeuds
+	*              TypNoeud *noeud, le noeud à ajouter
+	*
+	* Description : Ajoute un noeud en fin de pile.
+	*/
+static void empiler(TypPile *pile, TypNoeud *noeud) {
+	pthread_mutex_lock(&pile->verrou);
+	if (pile->fin == pile->capacite) {
+		if (pile->debut > 0) {
+			memmove(pile->noeuds,pile->noeuds + pile->debut,
+				(pile->fin - pile->debut) * sizeof(TypNoeud*));
+			pile->fin -= pile->debut;
+			pile->debut = 0;
+		}
+		else {
+			pile->capacite *= 2;
+			pile->noeuds = realloc(pile->noeuds,pile->capacite * sizeof(TypNoeud*));
+		}
+	}
+	pile->noeuds[pile->fin++] = noeud;
+	pthread_mutex_unlock(&pile->verrou);
+}
+
+
+	/*
+	* Fonction : depiler
+	*
+	* Paramètres : TypPile *pile, une pile de noeuds
+	*
+	* Retour : TypNoeud*, le dernier noeud empilé (NULL si la pile est vide)
+	*/
+static TypNoeud* depiler(TypPile *pile) {
+	TypNoeud *noeud = NULL;
+
+	pthread_mutex_lock(&pile->verrou);
+	if (pile->fin > pile->debut) {
+		noeud = pile->noeuds[--pile->fin];
+	}
+	pthread_mutex_unlock(&pile->verrou);
+
+	return noeud;
+}
+
+
+	/*
+	* Fonction : voler
+	*
+	* Paramètres : TypPile *pile, la pile d'un autre thread
+	*
+	* Retour : TypNoeud*, le plus ancien noeud de la pile (NULL si elle est
+	*              vide). Étant le moins profond, il représente en général le
+	*              plus gros sous-arbre à explorer.
+	*/
+static TypNoeud* voler(TypPile *pile) {
+	TypNoeud *noeud = NULL;
+
+	pthread_mutex_lock(&pile->verrou);
+	if (pile->fin > pile->debut) {
+		noeud = pile->noeuds[pile->debut++];
+	}
+	pthread_mutex_unlock(&pile->verrou);
+
+	return noeud;
+}
+
+
+	/*
+	* Fonction : comparerEnfants
+	*
+	* Paramètres : const void *a, const void *b, deux TypNoeud*
+	*
+	* Retour : int, < 0 si a doit être empilé avant b
+	*
+	* Description : Les enfants de plus grande borne sont empilés en premier,
+	*               de sorte que le plus prometteur soit exploré d'abord.
+	*/
+static int comparerEnfants(const void *a, const void *b) {
+	const TypNoeud *noeudA = *(TypNoeud* const *) a;
+	const TypNoeud *noeudB = *(TypNoeud* const *) b;
+
+	return noeudB->borne - noeudA->borne;
+}
@@ -0,0 +1,30 @@
+#ifndef SEPARATION_H
+#define SEPARATION_H
+
+#include <stdbool.h>
+#include "pert.h"
+
+
+/*
+* Résultat de la recherche d'un ordonnancement de durée minimale
+* avec un nombre limité d'ouvriers.
+*/
+typedef struct TypResultatOptimal {
+	int  duree;       /* Durée du meilleur ordonnancement trouvé */
+	int  borneInf;    /* Borne inférieure prouvée de la durée minimale */
+	int  *debut;      /* Date de début de chaque sommet dans le meilleur
+	                     ordonnancement (indicé à partir de 0) */
+	int  nbSommets;   /* Taille du tableau debut */
+	long nbNoeuds;    /* Nombre de noeuds explorés */
+	bool optimal;     /* true si la recherche a prouvé que duree est
+	                     la durée minimale */
+} TypResultatOptimal;
+
+
+int borneInferieureOrdo(TypGraphePERT*,int);
+
+TypResultatOptimal* resoudreOptimal(TypGraphePERT*,int,int,double,long);
+
+void deleteResultatOptimal(TypResultatOptimal*);
+
+#endif
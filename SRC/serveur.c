@@ -0,0 +1,806 @@
+/*
+******************************************************************************
+*
+* Programme : serveur.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Mode serveur. Les chantiers chargés restent en mémoire et les
+*          requêtes arrivent, une par ligne, sur une socket Unix. Un thread
+*          surveille les connexions et confie chaque requête complète à un
+*          groupe de threads qui y répondent en parallèle.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "libgraphe.h"
+#include "pert.h"
+#include "erreurs.h"
+#include "lot.h"
+#include "scenarios.h"
+#include "serveur.h"
+
+
+/* Taille maximale d'une requête (une ligne plus longue est découpée) */
+#define TAILLE_REQUETE 4096
+
+/*
+* Connexion d'un client. Une connexion occupée est dans la file ou servie
+* par un thread : elle n'est plus surveillée, ses requêtes sont donc
+* traitées une à une, dans l'ordre.
+*/
+typedef struct TypConnexion {
+	int  client;                  /* Socket du client */
+	FILE *sortie;                 /* Réponses au client */
+	char tampon[TAILLE_REQUETE];  /* Octets reçus et pas encore traités */
+	int  taille;
+	bool occupee;
+	struct TypConnexion *suivante; /* Suivante dans la file */
+} TypConnexion;
+
+/*
+* État partagé par les threads du serveur.
+*/
+typedef struct TypServeur {
+	int             ecoute;      /* Socket d'écoute */
+	int             reveil[2];   /* Tube qui réveille le thread de
+	                                surveillance (connexion libérée, arrêt) */
+	bool            arret;       /* true quand un client a demandé l'arrêt */
+	TypProjet       **projets;   /* Les chantiers chargés */
+	int             nbProjets;
+	TypConnexion    **connexions; /* Les connexions ouvertes */
+	int             nbConnexions;
+	TypConnexion    *premiere;   /* File des connexions qui ont une requête */
+	TypConnexion    *derniere;
+	pthread_cond_t  travail;     /* Signalé quand la file s'allonge ou à
+	                                l'arrêt */
+	pthread_mutex_t verrou;      /* Protège arret, la table des projets, les
+	                                connexions et la file */
+} TypServeur;
+
+
+static void surveillerConnexions(TypServeur*);
+static void lireConnexion(TypServeur*,TypConnexion*);
+static void* travaillerServeur(void*);
+static bool requeteComplete(TypConnexion*);
+static void extraireRequete(TypConnexion*,char*);
+static void enfilerConnexion(TypServeur*,TypConnexion*);
+static void fermerConnexion(TypServeur*,TypConnexion*);
+static void reveillerServeur(TypServeur*);
+static bool traiterRequete(TypServeur*,char*,FILE*);
+static void evaluerRetards(TypProjet*,char*,FILE*);
+static TypProjet* chercherProjet(TypServeur*,const char*);
+static int verrouillerProjet(TypProjet*,bool);
+static int chargerProjet(TypProjet*);
+
+
+	/*
+	* Fonction : lancerServeur
+	*
+	* Paramètres : const char *chemin, le chemin de la socket Unix
+	*              int nbThreads, le nombre de threads qui répondent aux
+	*                  requêtes (<= 0 : un par processeur)
+	*
+	* Retour : int, 0 après une demande d'arrêt, ERREUR_FICHIER si la
+	*              socket n'a pu être créée
+	*
+	* Description : Crée la socket puis répond aux clients jusqu'à ce que
+	*               l'un d'eux envoie "arreter". Requêtes (une par ligne) :
+	*                   charger <fichier>            lit ou relit le fichier
+	*                   dates <fichier>
+	*                   critique <fichier>
+	*                   ouvriers <fichier> <n>
+	*                   duree <fichier> <tache> <d>  change une durée
+	*                   retards <fichier> <tache> <d> [<tache> <d> ...]
+	*                                                évalue, sans rien
+	*                                                changer, chaque tâche
+	*                                                retardée de d
+	*                   quitter                      ferme la connexion
+	*                   arreter                      arrête le serveur
+	*               Les résultats sont écrits au format du traitement par
+	*               lot, suivis d'une ligne "ok" ou "erreur <message>".
+	*               Un fichier non chargé l'est à sa première requête.
+	*               Une connexion n'occupe un thread que le temps d'une
+	*               requête ; à l'arrêt, les connexions ouvertes sont
+	*               fermées.
+	*/
+int lancerServeur(const char *chemin, int nbThreads) {
+	TypServeur         serveur;   /* État partagé */
+	struct sockaddr_un adresse;   /* Adresse de la socket */
+	pthread_t          *threads;  /* Les threads lancés */
+	int                i, t;
+
+	if (nbThreads <= 0) {
+		nbThreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	if (nbThreads < 1) {
+		nbThreads = 1;
+	}
+
+	memset(&adresse,0,sizeof(adresse));
+	adresse.sun_family = AF_UNIX;
+	if (strlen(chemin) >= sizeof(adresse.sun_path)) {
+		return ERREUR_FICHIER;
+	}
+	strcpy(adresse.sun_path,chemin);
+
+	serveur.ecoute = socket(AF_UNIX,SOCK_STREAM,0);
+	unlink(chemin);
+	if (serveur.ecoute == -1
+			|| bind(serveur.ecoute,(struct sockaddr*) &adresse,sizeof(adresse)) == -1
+			|| listen(serveur.ecoute,SOMAXCONN) == -1) {
+		if (serveur.ecoute != -1) {
+			close(serveur.ecoute);
+		}
+		return ERREUR_FICHIER;
+	}
+
+	/* Un client qui se déconnecte ne doit pas arrêter le serveur */
+	signal(SIGPIPE,SIG_IGN);
+
+	if (pipe(serveur.reveil) == -1) {
+		close(serveur.ecoute);
+		unlink(chemin);
+		return ERREUR_FICHIER;
+	}
+	serveur.arret = false;
+	serveur.projets = NULL;
+	serveur.nbProjets = 0;
+	serveur.connexions = NULL;
+	serveur.nbConnexions = 0;
+	serveur.premiere = NULL;
+	serveur.derniere = NULL;
+	pthread_mutex_init(&serveur.verrou,NULL);
+	pthread_cond_init(&serveur.travail,NULL);
+
+	threads = malloc(nbThreads * sizeof(pthread_t));
+	for (t = 0; t < nbThreads; t++) {
+		pthread_create(&threads[t],NULL,travaillerServeur,&serveur);
+	}
+	surveillerConnexions(&serveur);
+	for (t = 0; t < nbThreads; t++) {
+		pthread_join(threads[t],NULL);
+	}
+
+	/* Les clients encore connectés voient la fin de leur connexion */
+	while (serveur.nbConnexions > 0) {
+		fermerConnexion(&serveur,serveur.connexions[0]);
+	}
+	free(serveur.connexions);
+	close(serveur.reveil[0]);
+	close(serveur.reveil[1]);
+	close(serveur.ecoute);
+	unlink(chemin);
+
+	for (i = 0; i < serveur.nbProjets; i++) {
+		if (serveur.projets[i]->graphePERT != NULL) {
+			deleteGraphePERT(serveur.projets[i]->graphePERT);
+		}
+		pthread_rwlock_destroy(&serveur.projets[i]->verrou);
+		free(serveur.projets[i]->chemin);
+		free(serveur.projets[i]);
+	}
+	free(serveur.projets);
+	free(threads);
+	pthread_cond_destroy(&serveur.travail);
+	pthread_mutex_destroy(&serveur.verrou);
+
+	return 0;
+}
+
+
+	/*
+	* Fonction : surveillerConnexions
+	*
+	* Paramètres : TypServeur *serveur, l'état partagé
+	*
+	* Description : Accepte les connexions et lit les connexions libres
+	*               jusqu'à l'arrêt du serveur. Une connexion qui a reçu une
+	*               requête complète est mise dans la file des threads.
+	*/
+static void surveillerConnexions(TypServeur *serveur) {
+	struct pollfd *surveillees;  /* Écoute, réveil puis connexions libres */
+	TypConnexion  **libres;      /* Connexion de chaque case de surveillees */
+	TypConnexion  *connexion;
+	char          vidange[64];   /* Octets lus dans le tube de réveil */
+	int           nbSurveillees;
+	int           client;
+	int           i;
+
+	surveillees = NULL;
+	libres = NULL;
+	while (true) {
+		pthread_mutex_lock(&serveur->verrou);
+		if (serveur->arret) {
+			pthread_mutex_unlock(&serveur->verrou);
+			break;
+		}
+		surveillees = realloc(surveillees,(serveur->nbConnexions + 2) * sizeof(struct pollfd));
+		libres = realloc(libres,(serveur->nbConnexions + 2) * sizeof(TypConnexion*));
+		surveillees[0].fd = serveur->ecoute;
+		surveillees[1].fd = serveur->reveil[0];
+		nbSurveillees = 2;
+		for (i = 0; i < serveur->nbConnexions; i++) {
+			if (! serveur->connexions[i]->occupee) {
+				libres[nbSurveillees] = serveur->connexions[i];
+				surveillees[nbSurveillees++].fd = serveur->connexions[i]->client;
+			}
+		}
+		pthread_mutex_unlock(&serveur->verrou);
+
+		for (i = 0; i < nbSurveillees; i++) {
+			surveillees[i].events = POLLIN;
+			surveillees[i].revents = 0;
+		}
+		if (poll(surveillees,nbSurveillees,-1) == -1) {
+			continue;
+		}
+
+		if (surveillees[1].revents != 0) {
+			read(serveur->reveil[0],vidange,sizeof(vidange));
+		}
+		if (surveillees[0].revents != 0 && (client = accept(serveur->ecoute,NULL,NULL)) != -1) {
+			connexion = malloc(sizeof(TypConnexion));
+			connexion->client = client;
+			connexion->sortie = fdopen(dup(client),"w");
+			connexion->taille = 0;
+			connexion->occupee = false;
+			connexion->suivante = NULL;
+			pthread_mutex_lock(&serveur->verrou);
+			serveur->connexions = realloc(serveur->connexions,(serveur->nbConnexions + 1) * sizeof(TypConnexion*));
+			serveur->connexions[serveur->nbConnexions++] = connexion;
+			pthread_mutex_unlock(&serveur->verrou);
+		}
+		/* Les connexions libres ne sont touchées que par ce thread */
+		for (i = 2; i < nbSurveillees; i++) {
+			if (surveillees[i].revents != 0) {
+				lireConnexion(serveur,libres[i]);
+			}
+		}
+	}
+
+	free(surveillees);
+	free(libres);
+}
+
+
+	/*
+	* Fonction : lireConnexion
+	*
+	* Paramètres : TypServeur *serveur, l'état partagé
+	*              TypConnexion *connexion, une connexion libre prête à être
+	*                  lue
+	*
+	* Description : Ajoute les octets reçus au tampon de la connexion et la
+	*               met dans la file si une requête y est complète. Une
+	*               connexion terminée par le client est fermée.
+	*/
+static void lireConnexion(TypServeur *serveur, TypConnexion *connexion) {
+	ssize_t lus;
+
+	lus = read(connexion->client,connexion->tampon + connexion->taille,
+	           TAILLE_REQUETE - connexion->taille);
+
+	pthread_mutex_lock(&serveur->verrou);
+	if (lus <= 0) {
+		fermerConnexion(serveur,connexion);
+	}
+	else {
+		connexion->taille += lus;
+		if (requeteComplete(connexion)) {
+			enfilerConnexion(serveur,connexion);
+		}
+	}
+	pthread_mutex_unlock(&serveur->verrou);
+}
+
+
+	/*
+	* Fonction : travaillerServeur
+	*
+	* Paramètres : void *arg, pointeur sur le TypServeur partagé
+	*
+	* Retour : void*, NULL
+	*
+	* Description : Prend les connexions de la file et répond à une requête
+	*               de chacune, jusqu'à l'arrêt du serveur. Une connexion
+	*               qui a encore une requête complète est remise en file,
+	*               sinon elle est rendue au thread de surveillance ; elle
+	*               est fermée après "quitter" ou "arreter".
+	*/
+static void* travaillerServeur(void *arg) {
+	TypServeur   *serveur;    /* État partagé */
+	TypConnexion *connexion;  /* Connexion servie */
+	char         ligne[TAILLE_REQUETE + 1];  /* Requête à traiter */
+	bool         continuer;
+
+	serveur = arg;
+
+	pthread_mutex_lock(&serveur->verrou);
+	while (true) {
+		while (serveur->premiere == NULL && ! serveur->arret) {
+			pthread_cond_wait(&serveur->travail,&serveur->verrou);
+		}
+		if (serveur->arret) {
+			break;
+		}
+		connexion = serveur->premiere;
+		serveur->premiere = connexion->suivante;
+		if (serveur->premiere == NULL) {
+			serveur->derniere = NULL;
+		}
+		pthread_mutex_unlock(&serveur->verrou);
+
+		/* La connexion occupée n'est touchée que par ce thread */
+		extraireRequete(connexion,ligne);
+		continuer = traiterRequete(serveur,ligne,connexion->sortie);
+		fflush(connexion->sortie);
+
+		pthread_mutex_lock(&serveur->verrou);
+		if (! continuer) {
+			fermerConnexion(serveur,connexion);
+		}
+		else if (requeteComplete(connexion)) {
+			connexion->occupee = false;
+			enfilerConnexion(serveur,connexion);
+		}
+		else {
+			connexion->occupee = false;
+			reveillerServeur(serveur);
+		}
+	}
+	pthread_mutex_unlock(&serveur->verrou);
+
+	return NULL;
+}
+
+
+	/*
+	* Fonction : requeteComplete
+	*
+	* Paramètres : TypConnexion *connexion, une connexion
+	*
+	* Retour : bool, true si le tampon contient une fin de ligne ou est
+	*             plein
+	*/
+static bool requeteComplete(TypConnexion *connexion) {
+	return connexion->taille == TAILLE_REQUETE
+	    || memchr(connexion->tampon,'\n',connexion->taille) != NULL;
+}
+
+
+	/*
+	* Fonction : extraireRequete
+	*
+	* Paramètres : TypConnexion *connexion, une connexion dont la requête
+	*                  est complète (voir requeteComplete)
+	*              char *ligne, reçoit la requête, sans fin de ligne
+	*
+	* Description : Retire la première requête du tampon.
+	*/
+static void extraireRequete(TypConnexion *connexion, char *ligne) {
+	char *fin;      /* Fin de ligne de la requête */
+	int  longueur;  /* Octets retirés du tampon */
+
+	fin = memchr(connexion->tampon,'\n',connexion->taille);
+	longueur = (fin != NULL) ? (int) (fin - connexion->tampon) + 1 : connexion->taille;
+
+	memcpy(ligne,connexion->tampon,longueur);
+	ligne[longueur] = '\0';
+	ligne[strcspn(ligne,"\r\n")] = '\0';
+	connexion->taille -= longueur;
+	memmove(connexion->tampon,connexion->tampon + longueur,connexion->taille);
+}
+
+
+	/*
+	* Fonction : enfilerConnexion
+	*
+	* Paramètres : TypServeur *serveur, l'état partagé, dont le verrou est
+	*                  pris
+	*              TypConnexion *connexion, une connexion libre qui a une
+	*                  requête complète
+	*
+	* Description : Met la connexion, désormais occupée, au bout de la file
+	*               et réveille un thread.
+	*/
+static void enfilerConnexion(TypServeur *serveur, TypConnexion *connexion) {
+	connexion->occupee = true;
+	connexion->suivante = NULL;
+	if (serveur->derniere != NULL) {
+		serveur->derniere->suivante = connexion;
+	}
+	else {
+		serveur->premiere = connexion;
+	}
+	serveur->derniere = connexion;
+	pthread_cond_signal(&serveur->travail);
+}
+
+
+	/*
+	* Fonction : fermerConnexion
+	*
+	* Paramètres : TypServeur *serveur, l'état partagé, dont le verrou est
+	*                  pris (ou seul thread restant)
+	*              TypConnexion *connexion, une connexion qui n'est pas
+	*                  dans la file
+	*
+	* Description : Ferme la connexion et la retire de la table.
+	*/
+static void fermerConnexion(TypServeur *serveur, TypConnexion *connexion) {
+	int i;
+
+	for (i = 0; serveur->connexions[i] != connexion; i++);
+	serveur->connexions[i] = serveur->connexions[--serveur->nbConnexions];
+
+	shutdown(connexion->client,SHUT_RDWR);
+	fclose(connexion->sortie);
+	close(connexion->client);
+	free(connexion);
+}
+
+
+	/*
+	* Fonction : reveillerServeur
+	*
+	* Paramètres : TypServeur *serveur, l'état partagé
+	*
+	* Description : Fait revenir le thread de surveillance de poll, pour
+	*               qu'il surveille de nouveau une connexion libérée ou
+	*               constate l'arrêt.
+	*/
+static void reveillerServeur(TypServeur *serveur) {
+	char octet;
+
+	octet = 0;
+	write(serveur->reveil[1],&octet,1);
+}
+
+
+	/*
+	* Fonction : traiterRequete
+	*
+	* Paramètres : TypServeur *serveur, l'état partagé
+	*              char *ligne, la requête (modifiée par la fonction)
+	*              FILE *sortie, le flux de réponse
+	*
+	* Retour : bool, false si la connexion doit être fermée
+	*
+	* Description : Exécute une requête (voir lancerServeur).
+	*/
+static bool traiterRequete(TypServeur *serveur, char *ligne, FILE *sortie) {
+	TypRequetesLot  requetes;     /* Requête de lecture à exécuter */
+	TypModification modification; /* Changement de durée */
+	TypProjet       *projet;      /* Le chantier visé */
+	char            commande[32];
+	char            chemin[4096];
+	char            nom[256];     /* Nom d'une tâche */
+	int             valeur;       /* Nombre d'ouvriers ou durée */
+	int             nbChamps;     /* Nombre de champs lus */
+	int             erreur;
+
+	nbChamps = sscanf(ligne,"%31s %4095s",commande,chemin);
+	if (nbChamps < 1) {
+		return true;
+	}
+
+	if (strcmp(commande,"quitter") == 0) {
+		return false;
+	}
+	if (strcmp(commande,"arreter") == 0) {
+		fprintf(sortie,"ok\n");
+		pthread_mutex_lock(&serveur->verrou);
+		serveur->arret = true;
+		pthread_cond_broadcast(&serveur->travail);
+		reveillerServeur(serveur);
+		pthread_mutex_unlock(&serveur->verrou);
+		return false;
+	}
+	if (strcmp(commande,"charger") != 0 && strcmp(commande,"dates") != 0
+			&& strcmp(commande,"critique") != 0 && strcmp(commande,"ouvriers") != 0
+			&& strcmp(commande,"duree") != 0 && strcmp(commande,"retards") != 0) {
+		fprintf(sortie,"erreur requete inconnue\n");
+		return true;
+	}
+	if (nbChamps < 2) {
+		fprintf(sortie,"erreur requete invalide\n");
+		return true;
+	}
+
+	projet = chercherProjet(serveur,chemin);
+
+	if (strcmp(commande,"charger") == 0) {
+		pthread_rwlock_wrlock(&projet->verrou);
+		if (projet->graphePERT != NULL) {
+			deleteGraphePERT(projet->graphePERT);
+			projet->graphePERT = NULL;
+		}
+		erreur = chargerProjet(projet);
+		pthread_rwlock_unlock(&projet->verrou);
+		fprintf(sortie,(erreur == 0) ? "ok\n" : "erreur fichier introuvable\n");
+		return true;
+	}
+
+	if (strcmp(commande,"duree") == 0) {
+		if (sscanf(ligne,"%*s %*s %255s %d",nom,&valeur) != 2) {
+			fprintf(sortie,"erreur requete invalide\n");
+			return true;
+		}
+
+		if (verrouillerProjet(projet,true) != 0) {
+			fprintf(sortie,"erreur fichier introuvable\n");
+			return true;
+		}
+		modification.type = MODIF_DUREE;
+		modification.sommet = chercherTache(projet->graphePERT,nom);
+		modification.predecesseur = 0;
+		modification.duree = valeur;
+		erreur = majDates(projet->graphePERT,&modification,1);
+		pthread_rwlock_unlock(&projet->verrou);
+
+		if (erreur == 0) {
+			fprintf(sortie,"ok\n");
+		}
+		else {
+			fprintf(sortie,"erreur %s\n",(erreur == POIDS_INVALIDE) ? "duree invalide" : "tache inconnue");
+		}
+		return true;
+	}
+
+	if (strcmp(commande,"retards") == 0) {
+		if (verrouillerProjet(projet,false) != 0) {
+			fprintf(sortie,"erreur fichier introuvable\n");
+			return true;
+		}
+		evaluerRetards(projet,ligne,sortie);
+		pthread_rwlock_unlock(&projet->verrou);
+		return true;
+	}
+
+	requetes.dates = (strcmp(commande,"dates") == 0);
+	requetes.critique = (strcmp(commande,"critique") == 0);
+	requetes.nbDurees = 0;
+	requetes.ouvriers = &valeur;
+	requetes.nbThreads = 1;
+	requetes.cache = NULL;
+	if (strcmp(commande,"ouvriers") == 0) {
+		if (sscanf(ligne,"%*s %*s %d",&valeur) != 1 || valeur < 1) {
+			fprintf(sortie,"erreur requete invalide\n");
+			return true;
+		}
+		requetes.nbDurees = 1;
+	}
+
+	if (verrouillerProjet(projet,false) != 0) {
+		fprintf(sortie,"erreur fichier introuvable\n");
+		return true;
+	}
+	ecrireRequetes(projet->graphePERT,projet->chemin,&requetes,sortie);
+	pthread_rwlock_unlock(&projet->verrou);
+	fprintf(sortie,"ok\n");
+
+	return true;
+}
+
+
+	/*
+	* Fonction : evaluerRetards
+	*
+	* Paramètres : TypProjet *projet, un projet chargé dont le verrou est
+	*                  pris en lecture
+	*              char *ligne, la requête "retards <fichier> <tache> <d> ..."
+	*              FILE *sortie, le flux de réponse
+	*
+	* Description : Chaque couple tâche, retard est un scénario (voir
+	*               evaluerScenarios). Pour chacun, écrit une ligne
+	*               # fichier, retard, tache, d, date de fin, taches critiques
+	*               puis "ok", ou "erreur <message>" si un couple est
+	*               invalide ou si un scénario n'a pu être évalué.
+	*/
+static void evaluerRetards(TypProjet *projet, char *ligne, FILE *sortie) {
+	TypGraphePERT       *graphePERT;
+	TypScenario         *scenarios;
+	TypModification     *modifications; /* Une modification par scénario */
+	TypResultatScenario *resultats;
+	char                nom[256];       /* Nom d'une tâche */
+	int                 retard;
+	int                 nbScenarios;
+	int                 position;       /* Caractères lus par sscanf */
+	int                 erreur;         /* Code d'erreur d'un scénario */
+	int                 s, i, k;
+
+	graphePERT = projet->graphePERT;
+	scenarios = NULL;
+	modifications = NULL;
+	nbScenarios = 0;
+
+	/* Saute la commande et le fichier */
+	position = 0;
+	sscanf(ligne,"%*s %*s%n",&position);
+	ligne += position;
+	while (sscanf(ligne," %255s %d%n",nom,&retard,&position) == 2) {
+		ligne += position;
+		s = chercherTache(graphePERT,nom);
+		if (s < 1 || graphePERT->duree[s-1] + retard < 0) {
+			fprintf(sortie,"erreur %s\n",(s < 1) ? "tache inconnue" : "duree invalide");
+			free(scenarios);
+			free(modifications);
+			return;
+		}
+		modifications = realloc(modifications,(nbScenarios + 1) * sizeof(TypModification));
+		modifications[nbScenarios].type = MODIF_DUREE;
+		modifications[nbScenarios].sommet = s;
+		modifications[nbScenarios].predecesseur = 0;
+		modifications[nbScenarios].duree = graphePERT->duree[s-1] + retard;
+		nbScenarios++;
+	}
+	if (nbScenarios == 0) {
+		fprintf(sortie,"erreur requete invalide\n");
+		return;
+	}
+
+	scenarios = malloc(nbScenarios * sizeof(TypScenario));
+	for (i = 0; i < nbScenarios; i++) {
+		scenarios[i].modifications = &modifications[i];
+		scenarios[i].nbModifications = 1;
+	}
+	resultats = evaluerScenarios(graphePERT,scenarios,nbScenarios,0);
+	erreur = (resultats == NULL) ? ERREUR_MEMOIRE : 0;
+	for (i = 0; i < nbScenarios && erreur == 0; i++) {
+		erreur = resultats[i].erreur;
+	}
+	if (erreur != 0) {
+		fprintf(sortie,"erreur %s\n",(erreur == POIDS_INVALIDE) ? "duree invalide" : "memoire");
+		if (resultats != NULL) {
+			deleteResultatsScenarios(resultats,nbScenarios);
+		}
+		free(scenarios);
+		free(modifications);
+		return;
+	}
+
+	for (i = 0; i < nbScenarios; i++) {
+		s = modifications[i].sommet;
+		fprintf(sortie,"%s, retard, %s, %d, %d,",projet->chemin,graphePERT->taches[s-1]->nom,
+			modifications[i].duree - graphePERT->duree[s-1],resultats[i].dateFin);
+		for (k = 0; k < resultats[i].nbCritiques; k++) {
+			fprintf(sortie," %s",graphePERT->taches[resultats[i].critiques[k]]->nom);
+		}
+		fprintf(sortie,"\n");
+	}
+	fprintf(sortie,"ok\n");
+
+	deleteResultatsScenarios(resultats,nbScenarios);
+	free(scenarios);
+	free(modifications);
+}
+
+
+	/*
+	* Fonction : chercherProjet
+	*
+	* Paramètres : TypServeur *serveur, l'état partagé
+	*              const char *chemin, le chemin d'un fichier de chantier
+	*
+	* Retour : TypProjet*, le projet associé au chemin, ajouté à la table
+	*              (sans graphe) s'il n'y était pas
+	*
+	* Description : Les projets ne sont jamais retirés de la table, un
+	*               pointeur renvoyé reste donc valide.
+	*/
+static TypProjet* chercherProjet(TypServeur *serveur, const char *chemin) {
+	TypProjet *projet;
+	int       i;
+
+	pthread_mutex_lock(&serveur->verrou);
+
+	projet = NULL;
+	for (i = 0; i < serveur->nbProjets && projet == NULL; i++) {
+		if (strcmp(serveur->projets[i]->chemin,chemin) == 0) {
+			projet = serveur->projets[i];
+		}
+	}
+
+	if (projet == NULL) {
+		projet = malloc(sizeof(TypProjet));
+		projet->chemin = malloc(strlen(chemin) + 1);
+		strcpy(projet->chemin,chemin);
+		projet->graphePERT = NULL;
+		pthread_rwlock_init(&projet->verrou,NULL);
+
+		serveur->projets = realloc(serveur->projets,(serveur->nbProjets + 1) * sizeof(TypProjet*));
+		serveur->projets[serveur->nbProjets] = projet;
+		serveur->nbProjets++;
+	}
+
+	pthread_mutex_unlock(&serveur->verrou);
+
+	return projet;
+}
+
+
+	/*
+	* Fonction : verrouillerProjet
+	*
+	* Paramètres : TypProjet *projet, le projet visé par une requête
+	*              bool ecriture, true pour prendre le verrou en écriture,
+	*                  false en lecture
+	*
+	* Retour : int, 0 si le verrou est pris et le graphe chargé,
+	*              ERREUR_FICHIER si le fichier n'a pu être lu (le verrou
+	*              est alors relâché)
+	*
+	* Description : Charge le fichier à la première requête. Le graphe est
+	*               vérifié une fois le verrou pris : un "charger"
+	*               concurrent peut l'avoir supprimé entre-temps. En lecture,
+	*               le chargement se fait sous le verrou en écriture, puis
+	*               le verrou en lecture est repris et le graphe revérifié.
+	*/
+static int verrouillerProjet(TypProjet *projet, bool ecriture) {
+	int erreur;
+
+	while (true) {
+		if (ecriture) {
+			pthread_rwlock_wrlock(&projet->verrou);
+		}
+		else {
+			pthread_rwlock_rdlock(&projet->verrou);
+		}
+		if (projet->graphePERT != NULL) {
+			return 0;
+		}
+		if (! ecriture) {
+			pthread_rwlock_unlock(&projet->verrou);
+			pthread_rwlock_wrlock(&projet->verrou);
+		}
+		erreur = (projet->graphePERT == NULL) ? chargerProjet(projet) : 0;
+		if (erreur != 0) {
+			pthread_rwlock_unlock(&projet->verrou);
+			return erreur;
+		}
+		if (ecriture) {
+			return 0;
+		}
+		/* Reprise en lecture : le graphe sera revérifié */
+		pthread_rwlock_unlock(&projet->verrou);
+	}
+}
+
+
+	/*
+	* Fonction : chargerProjet
+	*
+	* Paramètres : TypProjet *projet, un projet dont le graphe est NULL et
+	*                  dont le verrou est pris en écriture
+	*
+	* Retour : int, 0 si le fichier a été lu, ERREUR_FICHIER s'il n'existe
+	*              pas ou est invalide
+	*/
+static int chargerProjet(TypProjet *projet) {
+	FILE *fichier;
+
+	if ((fichier = fopen(projet->chemin,"r")) == NULL) {
+		return ERREUR_FICHIER;
+	}
+	projet->graphePERT = lireGraphePERT(fichier);
+	fclose(fichier);
+	if (projet->graphePERT == NULL) {
+		return ERREUR_FICHIER;
+	}
+	calculDates(projet->graphePERT);
+
+	return 0;
+}
@@ -0,0 +1,21 @@
+#ifndef SERVEUR_H
+#define SERVEUR_H
+
+#include <pthread.h>
+#include "pert.h"
+
+
+/*
+* Chantier gardé en mémoire par le serveur. Les requêtes de lecture
+* partagent le verrou ; les mises à jour le prennent en exclusivité.
+*/
+typedef struct TypProjet {
+	char             *chemin;      /* Chemin du fichier, sert de clé */
+	TypGraphePERT    *graphePERT;  /* Graphe dont les dates sont calculées */
+	pthread_rwlock_t verrou;
+} TypProjet;
+
+
+int lancerServeur(const char*,int);
+
+#endif
@@ -0,0 +1,213 @@
+/*
+******************************************************************************
+*
+* Programme : topologie.c
+*
+* Auteurs : Christophe SAUVAGE et Mustafa NDIAYE
+*
+* Résumé : Outils sur l'ordre topologique communs à la mise à jour d'un
+*          graphe PERT (majDates) et à l'évaluation des scénarios :
+*          correction de l'ordre avant l'ajout d'une arête (algorithme de
+*          Pearce et Kelly) et tas de sommets classés par rang.
+*
+* Date : 19/10/2026
+*
+******************************************************************************
+*/
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include "erreurs.h"
+#include "topologie.h"
+
+
+	/*
+	* Fonction : reordonnerRangs
+	*
+	* Paramètres : TypReordonnement *reordonnement, l'ordre à corriger et
+	*                  les zones de travail
+	*              int predecesseur, int sommet, l'arête predecesseur ->
+	*                  sommet qui va être ajoutée, avec
+	*                  rang(predecesseur) > rang(sommet)
+	*
+	* Retour : int, 0 si l'ordre a été corrigé, CIRCUIT si l'arête
+	*             fermerait un circuit (l'ordre est alors inchangé)
+	*
+	* Description : Cherche les descendants de sommet de rang inférieur à
+	*               celui de predecesseur, et les ancêtres de predecesseur
+	*               de rang supérieur à celui de sommet. Les rangs de ces
+	*               sommets sont redistribués : d'abord les ancêtres, puis
+	*               les descendants, chaque groupe gardant son ordre relatif.
+	*               Les sommets déplacés sont laissés dans sommets.
+	*/
+int reordonnerRangs(TypReordonnement *reordonnement, int predecesseur, int sommet) {
+	TypReordonnement *r;   /* Abréviation */
+	int nbPile, nbAval, nbAmont;
+	int nbVoisins;
+	int rangMin;           /* Rang de sommet */
+	int rangMax;           /* Rang de predecesseur */
+	int s, v, i, k;
+
+	r = reordonnement;
+	rangMin = r->rangTopo[sommet-1];
+	rangMax = r->rangTopo[predecesseur-1];
+	r->nbDeplaces = 0;
+
+	/* Descendants de sommet dont le rang est inférieur à rangMax */
+	nbAval = 0;
+	nbPile = 0;
+	r->pile[nbPile++] = sommet;
+	r->vu[sommet-1] = r->parcours;
+	while (nbPile > 0) {
+		s = r->pile[--nbPile];
+		r->rangsAval[nbAval++] = r->rangTopo[s-1];
+		nbVoisins = r->listerVoisins(r->contexte,s,true,r->voisins);
+		for (i = 0; i < nbVoisins; i++) {
+			v = r->voisins[i];
+			if (v == predecesseur) {
+				return CIRCUIT;
+			}
+			if (r->vu[v-1] != r->parcours && r->rangTopo[v-1] < rangMax) {
+				r->vu[v-1] = r->parcours;
+				r->pile[nbPile++] = v;
+			}
+		}
+	}
+
+	/* Ancêtres de predecesseur dont le rang est supérieur à rangMin */
+	nbAmont = 0;
+	r->pile[nbPile++] = predecesseur;
+	r->vu[predecesseur-1] = r->parcours;
+	while (nbPile > 0) {
+		s = r->pile[--nbPile];
+		r->rangsAmont[nbAmont++] = r->rangTopo[s-1];
+		nbVoisins = r->listerVoisins(r->contexte,s,false,r->voisins);
+		for (i = 0; i < nbVoisins; i++) {
+			v = r->voisins[i];
+			if (r->vu[v-1] != r->parcours && r->rangTopo[v-1] > rangMin) {
+				r->vu[v-1] = r->parcours;
+				r->pile[nbPile++] = v;
+			}
+		}
+	}
+
+	/* Redistribution des rangs : les ancêtres puis les descendants */
+	qsort(r->rangsAval,nbAval,sizeof(int),comparerEntiers);
+	qsort(r->rangsAmont,nbAmont,sizeof(int),comparerEntiers);
+	for (k = 0; k < nbAmont; k++) {
+		r->rangs[k] = r->rangsAmont[k];
+		r->sommets[k] = r->ordreTopo[r->rangsAmont[k]];
+	}
+	for (k = 0; k < nbAval; k++) {
+		r->rangs[nbAmont + k] = r->rangsAval[k];
+		r->sommets[nbAmont + k] = r->ordreTopo[r->rangsAval[k]];
+	}
+	qsort(r->rangs,nbAval + nbAmont,sizeof(int),comparerEntiers);
+	for (k = 0; k < nbAval + nbAmont; k++) {
+		r->ordreTopo[r->rangs[k]] = r->sommets[k];
+		r->rangTopo[r->sommets[k]-1] = r->rangs[k];
+	}
+	r->nbDeplaces = nbAval + nbAmont;
+
+	return 0;
+}
+
+
+	/*
+	* Fonction : noterSommet
+	*
+	* Paramètres : int *sommets, tableau de sommets
+	*              int *nbSommets, la taille du tableau
+	*              bool *note, note[s-1] = true si s est dans le tableau
+	*              int sommet, le sommet à ajouter
+	*
+	* Description : Ajoute le sommet au tableau s'il n'y est pas déjà.
+	*/
+void noterSommet(int *sommets, int *nbSommets, bool *note, int sommet) {
+	if (!note[sommet-1]) {
+		note[sommet-1] = true;
+		sommets[(*nbSommets)++] = sommet;
+	}
+}
+
+
+	/*
+	* Fonction : tasInsererRang
+	*
+	* Paramètres : int *tas, un tas binaire de sommets
+	*              int *taille, la taille du tas
+	*              const int *rang, le rang topologique de chaque sommet
+	*              int sens, 1 pour avoir en tête le plus petit rang,
+	*                  -1 pour avoir en tête le plus grand
+	*              int sommet, le sommet à insérer
+	*
+	* Description : Insère un sommet dans le tas.
+	*/
+void tasInsererRang(int *tas, int *taille, const int *rang, int sens, int sommet) {
+	int i;      /* Position courante du sommet inséré */
+	int parent; /* Position du parent */
+
+	i = *taille;
+	(*taille)++;
+
+	while (i > 0) {
+		parent = (i - 1) / 2;
+		if (sens * rang[tas[parent]-1] <= sens * rang[sommet-1]) {
+			break;
+		}
+		tas[i] = tas[parent];
+		i = parent;
+	}
+	tas[i] = sommet;
+}
+
+
+	/*
+	* Fonction : tasExtraireRang
+	*
+	* Paramètres : int *tas, un tas binaire non vide
+	*              int *taille, la taille du tas
+	*              const int *rang, le rang topologique de chaque sommet
+	*              int sens, 1 ou -1 (voir tasInsererRang)
+	*
+	* Retour : int, le sommet en tête du tas, qui en est retiré
+	*/
+int tasExtraireRang(int *tas, int *taille, const int *rang, int sens) {
+	int tete;    /* Le sommet renvoyé */
+	int dernier; /* Le dernier sommet du tas, à replacer */
+	int i;       /* Position courante */
+	int fils;    /* Position du fils à remonter */
+
+	tete = tas[0];
+	(*taille)--;
+	dernier = tas[*taille];
+
+	i = 0;
+	while (2 * i + 1 < *taille) {
+		fils = 2 * i + 1;
+		if (fils + 1 < *taille && sens * rang[tas[fils+1]-1] < sens * rang[tas[fils]-1]) {
+			fils++;
+		}
+		if (sens * rang[dernier-1] <= sens * rang[tas[fils]-1]) {
+			break;
+		}
+		tas[i] = tas[fils];
+		i = fils;
+	}
+	tas[i] = dernier;
+
+	return tete;
+}
+
+
+	/*
+	* Fonction : comparerEntiers
+	*
+	* Paramètres : const void *a, const void *b, deux int
+	*
+	* Retour : int, < 0, 0 ou > 0 selon que a est inférieur, égal ou
+	*             supérieur à b (fonction de comparaison de qsort)
+	*/
+int comparerEntiers(const void *a, const void *b) {
+	return *(const int*) a - *(const int*) b;
+}
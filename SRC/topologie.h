@@ -0,0 +1,43 @@
+#ifndef TOPOLOGIE_H
+#define TOPOLOGIE_H
+
+#include <stdbool.h>
+
+
+/*
+* Correction d'un ordre topologique avant l'ajout d'une arête (voir
+* reordonnerRangs). Les zones de travail ont au moins nbSommets entiers ;
+* la lecture des voisins est fournie par l'appelant, qui peut ainsi
+* travailler sur le graphe PERT ou sur les arêtes d'un scénario.
+*/
+typedef struct TypReordonnement {
+	int  *ordreTopo;   /* Sommets indicés par rang */
+	int  *rangTopo;    /* Rangs indicés par sommet - 1 */
+	int  *vu;          /* vu[s-1] == parcours : s a été atteint */
+	int  parcours;     /* Différent de toutes les valeurs de vu */
+	int  *pile;        /* Zones de travail */
+	int  *rangsAval;
+	int  *rangsAmont;
+	int  *rangs;
+	int  *voisins;
+	int  *sommets;     /* Les sommets déplacés, dans leur nouvel ordre */
+	int  nbDeplaces;   /* Nombre de sommets déplacés */
+	int  (*listerVoisins)(void*,int,bool,int*);
+	                   /* Range dans le tableau les successeurs (true) ou
+	                      les prédécesseurs (false) du sommet et renvoie
+	                      leur nombre */
+	void *contexte;    /* Premier paramètre de listerVoisins */
+} TypReordonnement;
+
+
+int reordonnerRangs(TypReordonnement*,int,int);
+
+void noterSommet(int*,int*,bool*,int);
+
+void tasInsererRang(int*,int*,const int*,int,int);
+
+int tasExtraireRang(int*,int*,const int*,int);
+
+int comparerEntiers(const void*, const void*);
+
+#endif